@@ -12,14 +12,57 @@ namespace detail
 {
 #	if GLM_HAS_CXX11_STL
 		using std::log2;
+		using std::exp2;
 #	else
 		template<typename genType>
 		genType log2(genType Value)
 		{
 			return std::log(Value) * static_cast<genType>(1.4426950408889634073599246810019);
 		}
+
+		template<typename genType>
+		genType exp2(genType Value)
+		{
+			return std::exp(static_cast<genType>(0.69314718055994530941723212145818) * Value);
+		}
 #	endif
 
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
+		{
+			return detail::functor2<vec, L, T, Q>::call(std::pow, base, exponent);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::exp, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::log, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool isFloat, bool Aligned>
 	struct compute_log2
 	{
@@ -71,7 +114,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> pow(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
 	{
-		return detail::functor2<vec, L, T, Q>::call(pow, base, exponent);
+		return detail::compute_pow<L, T, Q, detail::is_aligned<Q>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -79,7 +122,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp, x);
+		return detail::compute_exp<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log
@@ -87,7 +130,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> log(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(log, x);
+		return detail::compute_log<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 #   if GLM_HAS_CXX11_STL
@@ -106,7 +149,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		return detail::compute_exp2<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
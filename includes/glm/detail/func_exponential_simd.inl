@@ -8,6 +8,64 @@
 namespace glm{
 namespace detail
 {
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			if(!glm_vec4_pow_domain(base.data, exponent.data))
+				return detail::functor2<vec, 4, float, Q>::call(std::pow, base, exponent);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_pow(base.data, exponent.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2<4, float, Q, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log2(v.data);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_sqrt<4, float, Q, true>
 	{
@@ -19,6 +77,17 @@ namespace detail
 		}
 	};
 
+	template<qualifier Q>
+	struct compute_inversesqrt<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_inversesqrt(v.data);
+			return Result;
+		}
+	};
+
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 	template<>
 	struct compute_sqrt<4, float, aligned_lowp, true>
@@ -30,6 +99,100 @@ namespace detail
 			return Result;
 		}
 	};
+
+	template<>
+	struct compute_inversesqrt<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_inversesqrt_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_pow<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& base, vec<4, float, aligned_lowp> const& exponent)
+		{
+			if(!glm_vec4_pow_domain(base.data, exponent.data))
+				return detail::functor2<vec, 4, float, aligned_lowp>::call(std::pow, base, exponent);
+
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_pow_lowp(base.data, exponent.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_exp<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_exp_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_log<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_log_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_exp2<4, float, aligned_lowp, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_exp2_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_log2<4, float, aligned_lowp, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_lowp> call(vec<4, float, aligned_lowp> const& v)
+		{
+			vec<4, float, aligned_lowp> Result;
+			Result.data = glm_vec4_log2_lowp(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_inversesqrt<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& v)
+		{
+			vec<4, float, aligned_mediump> Result;
+			Result.data = glm_vec4_inversesqrt_mediump(v.data);
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_pow<4, float, aligned_mediump, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, aligned_mediump> call(vec<4, float, aligned_mediump> const& base, vec<4, float, aligned_mediump> const& exponent)
+		{
+			if(!glm_vec4_pow_domain(base.data, exponent.data))
+				return detail::functor2<vec, 4, float, aligned_mediump>::call(std::pow, base, exponent);
+
+			vec<4, float, aligned_mediump> Result;
+			Result.data = glm_vec4_pow_mediump(base.data, exponent.data);
+			return Result;
+		}
+	};
 #	endif
 }//namespace detail
 }//namespace glm
@@ -35,18 +35,23 @@ namespace detail
 		}
 	};
 
+	template<qualifier Q>
+	struct compute_dot<vec<3, float, Q>, float, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(vec<3, float, Q> const& x, vec<3, float, Q> const& y)
+		{
+			return _mm_cvtss_f32(glm_vec3_dot(x.data, y.data));
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_cross<float, Q, true>
 	{
 		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
 		{
-			__m128 const set0 = _mm_set_ps(0.0f, a.z, a.y, a.x);
-			__m128 const set1 = _mm_set_ps(0.0f, b.z, b.y, b.x);
-			__m128 const xpd0 = glm_vec4_cross(set0, set1);
-
-			vec<4, float, Q> Result;
-			Result.data = xpd0;
-			return vec<3, float, Q>(Result);
+			vec<3, float, Q> Result;
+			Result.data = glm_vec4_cross(a.data, b.data);
+			return Result;
 		}
 	};
 
@@ -136,6 +141,26 @@ namespace detail
 		}
 	};
 
+	template<qualifier Q>
+	struct compute_dot<vec<3, float, Q>, float, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(vec<3, float, Q> const& x, vec<3, float, Q> const& y)
+		{
+			return neon::dot3(x.data, y.data);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cross<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+		{
+			vec<3, float, Q> Result;
+			Result.data = neon::cross(a.data, b.data);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_normalize<4, float, Q, true>
 	{
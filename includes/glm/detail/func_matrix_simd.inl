@@ -26,6 +26,37 @@ namespace detail
 	};
 #	endif
 
+	template<qualifier Q>
+	struct compute_transpose<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			mat<3, 3, float, Q> Result;
+			glm_mat3_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(mat<3, 3, float, Q> const& m)
+		{
+			return _mm_cvtss_f32(glm_mat3_determinant(&m[0].data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			mat<3, 3, float, Q> Result;
+			glm_mat3_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_transpose<4, 4, float, Q, true>
 	{
@@ -56,6 +87,39 @@ namespace detail
 			return Result;
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_transpose(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(mat<4, 4, double, Q> const& m)
+		{
+			return _mm_cvtsd_f64(_mm256_castpd256_pd128(glm_dmat4_determinant(&m[0].data)));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
 }//namespace detail
 
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
@@ -123,6 +187,50 @@ namespace glm {
 
 namespace detail
 {
+	template<qualifier Q>
+	struct compute_transpose<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			mat<3, 3, float, Q> Result;
+			neon::transpose3(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_determinant<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static float call(mat<3, 3, float, Q> const& m)
+		{
+			return neon::dot3(m[0].data, neon::cross(m[1].data, m[2].data));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<3, 3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			// The rows of the adjugate are the cross products of the columns
+			float32x4_t Adj[3];
+			Adj[0] = neon::cross(m[1].data, m[2].data);
+			Adj[1] = neon::cross(m[2].data, m[0].data);
+			Adj[2] = neon::cross(m[0].data, m[1].data);
+
+			float32x4_t const Rcp = vdupq_n_f32(1.0f / neon::dot3(m[0].data, Adj[0]));
+
+			float32x4_t Tmp[3];
+			neon::transpose3(Adj, Tmp);
+
+			mat<3, 3, float, Q> Result;
+			Result[0].data = vmulq_f32(Tmp[0], Rcp);
+			Result[1].data = vmulq_f32(Tmp[1], Rcp);
+			Result[2].data = vmulq_f32(Tmp[2], Rcp);
+			return Result;
+		}
+	};
+
 	template<qualifier Q>
 	struct compute_inverse<4, 4, float, Q, true>
 	{
@@ -247,6 +355,127 @@ namespace detail
 			return r;
 		}
 	};
+
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	struct compute_transpose<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			mat<4, 4, double, Q> Result;
+			for(length_t i = 0; i < 4; i += 2)
+			for(length_t j = 0; j < 4; j += 2)
+			{
+				float64x2_t const a = vld1q_f64(&m[j][i]);
+				float64x2_t const b = vld1q_f64(&m[j + 1][i]);
+				vst1q_f64(&Result[i][j], vzip1q_f64(a, b));
+				vst1q_f64(&Result[i + 1][j], vzip2q_f64(a, b));
+			}
+			return Result;
+		}
+	};
+
+	// Same cofactor expansion as the SSE and AVX versions, each vector is split in 2 float64x2_t halves
+	template<qualifier Q>
+	struct compute_determinant<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(mat<4, 4, double, Q> const& m)
+		{
+			// Rows (2, 2, 1, 1), (3, 3, 3, 2) and (1, 0, 0, 0) of the columns 2 and 3
+			float64x2_t Col2A[2], Col2B[2], Col2C[2], Col3A[2], Col3B[2], Col3C[2];
+			Col2A[0] = vdupq_n_f64(m[2][2]);
+			Col2A[1] = vdupq_n_f64(m[2][1]);
+			Col2B[0] = vdupq_n_f64(m[2][3]);
+			Col2B[1] = vsetq_lane_f64(m[2][2], vdupq_n_f64(m[2][3]), 1);
+			Col2C[0] = vsetq_lane_f64(m[2][1], vdupq_n_f64(m[2][0]), 0);
+			Col2C[1] = vdupq_n_f64(m[2][0]);
+			Col3A[0] = vdupq_n_f64(m[3][2]);
+			Col3A[1] = vdupq_n_f64(m[3][1]);
+			Col3B[0] = vdupq_n_f64(m[3][3]);
+			Col3B[1] = vsetq_lane_f64(m[3][2], vdupq_n_f64(m[3][3]), 1);
+			Col3C[0] = vsetq_lane_f64(m[3][1], vdupq_n_f64(m[3][0]), 0);
+			Col3C[1] = vdupq_n_f64(m[3][0]);
+
+			// (m[1][1], m[1][0], m[1][0], m[1][0]), (m[1][2], m[1][2], m[1][1], m[1][1]) and (m[1][3], m[1][3], m[1][3], m[1][2])
+			float64x2_t SwpFacA[2], SwpFacB[2], SwpFacC[2];
+			SwpFacA[0] = vsetq_lane_f64(m[1][1], vdupq_n_f64(m[1][0]), 0);
+			SwpFacA[1] = vdupq_n_f64(m[1][0]);
+			SwpFacB[0] = vdupq_n_f64(m[1][2]);
+			SwpFacB[1] = vdupq_n_f64(m[1][1]);
+			SwpFacC[0] = vdupq_n_f64(m[1][3]);
+			SwpFacC[1] = vsetq_lane_f64(m[1][2], vdupq_n_f64(m[1][3]), 1);
+
+			float64x2_t const Sign = vsetq_lane_f64(-1.0, vdupq_n_f64(1.0), 1);
+
+			float64x2_t Sum = vdupq_n_f64(0.0);
+			for(int h = 0; h < 2; ++h)
+			{
+				float64x2_t const SubFacA = vfmsq_f64(vmulq_f64(Col2A[h], Col3B[h]), Col3A[h], Col2B[h]);
+				float64x2_t const SubFacB = vfmsq_f64(vmulq_f64(Col2C[h], Col3B[h]), Col3C[h], Col2B[h]);
+				float64x2_t const SubFacC = vfmsq_f64(vmulq_f64(Col2C[h], Col3A[h]), Col3C[h], Col2A[h]);
+
+				float64x2_t const SubRes = vfmsq_f64(vmulq_f64(SwpFacA[h], SubFacA), SwpFacB[h], SubFacB);
+				float64x2_t const DetCof = vmulq_f64(vfmaq_f64(SubRes, SwpFacC[h], SubFacC), Sign);
+				Sum = vfmaq_f64(Sum, vld1q_f64(&m[0][h * 2]), DetCof);
+			}
+			return vaddvq_f64(Sum);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverse<4, 4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			// Swp0[k] = (m[2][k], m[2][k], m[1][k], m[1][k])
+			// Swp1[k] = (m[3][k], m[3][k], m[3][k], m[2][k])
+			// Vec[k] = (m[1][k], m[0][k], m[0][k], m[0][k])
+			float64x2_t Swp0[4][2], Swp1[4][2], Vec[4][2];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				Swp0[k][0] = vdupq_n_f64(m[2][k]);
+				Swp0[k][1] = vdupq_n_f64(m[1][k]);
+				Swp1[k][0] = vdupq_n_f64(m[3][k]);
+				Swp1[k][1] = vsetq_lane_f64(m[2][k], vdupq_n_f64(m[3][k]), 1);
+				Vec[k][0] = vsetq_lane_f64(m[1][k], vdupq_n_f64(m[0][k]), 0);
+				Vec[k][1] = vdupq_n_f64(m[0][k]);
+			}
+
+			float64x2_t const SignA = vsetq_lane_f64(-1.0, vdupq_n_f64(1.0), 0);
+			float64x2_t const SignB = vsetq_lane_f64(-1.0, vdupq_n_f64(1.0), 1);
+
+			float64x2_t Inv[4][2];
+			for(int h = 0; h < 2; ++h)
+			{
+				float64x2_t const Fac0 = vfmsq_f64(vmulq_f64(Swp0[2][h], Swp1[3][h]), Swp1[2][h], Swp0[3][h]);
+				float64x2_t const Fac1 = vfmsq_f64(vmulq_f64(Swp0[1][h], Swp1[3][h]), Swp1[1][h], Swp0[3][h]);
+				float64x2_t const Fac2 = vfmsq_f64(vmulq_f64(Swp0[1][h], Swp1[2][h]), Swp1[1][h], Swp0[2][h]);
+				float64x2_t const Fac3 = vfmsq_f64(vmulq_f64(Swp0[0][h], Swp1[3][h]), Swp1[0][h], Swp0[3][h]);
+				float64x2_t const Fac4 = vfmsq_f64(vmulq_f64(Swp0[0][h], Swp1[2][h]), Swp1[0][h], Swp0[2][h]);
+				float64x2_t const Fac5 = vfmsq_f64(vmulq_f64(Swp0[0][h], Swp1[1][h]), Swp1[0][h], Swp0[1][h]);
+
+				Inv[0][h] = vmulq_f64(SignB, vfmaq_f64(vfmsq_f64(vmulq_f64(Vec[1][h], Fac0), Vec[2][h], Fac1), Vec[3][h], Fac2));
+				Inv[1][h] = vmulq_f64(SignA, vfmaq_f64(vfmsq_f64(vmulq_f64(Vec[0][h], Fac0), Vec[2][h], Fac3), Vec[3][h], Fac4));
+				Inv[2][h] = vmulq_f64(SignB, vfmaq_f64(vfmsq_f64(vmulq_f64(Vec[0][h], Fac1), Vec[1][h], Fac3), Vec[3][h], Fac5));
+				Inv[3][h] = vmulq_f64(SignA, vfmaq_f64(vfmsq_f64(vmulq_f64(Vec[0][h], Fac2), Vec[1][h], Fac4), Vec[2][h], Fac5));
+			}
+
+			// (Inv[0][0], Inv[1][0], Inv[2][0], Inv[3][0])
+			float64x2_t const Row0 = vzip1q_f64(Inv[0][0], Inv[1][0]);
+			float64x2_t const Row1 = vzip1q_f64(Inv[2][0], Inv[3][0]);
+			float64x2_t const Dot0 = vfmaq_f64(vmulq_f64(vld1q_f64(&m[0][0]), Row0), vld1q_f64(&m[0][2]), Row1);
+			float64x2_t const Rcp0 = vdupq_n_f64(1.0 / vaddvq_f64(Dot0));
+
+			mat<4, 4, double, Q> Result;
+			for(length_t i = 0; i < 4; ++i)
+			{
+				vst1q_f64(&Result[i][0], vmulq_f64(Inv[i][0], Rcp0));
+				vst1q_f64(&Result[i][2], vmulq_f64(Inv[i][1], Rcp0));
+			}
+			return Result;
+		}
+	};
+#endif
 }//namespace detail
 }//namespace glm
 #endif
@@ -1,6 +1,247 @@
+/// @ref core
+/// @file glm/detail/func_packing_simd.inl
+
+#include "../simd/packing.h"
+
 namespace glm{
 namespace detail
 {
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_packUnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			glm_ivec4 const i = glm_vec4_to_unorm(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f), _mm_set1_ps(65535.0f));
+			return static_cast<uint>(glm_ivec4_pack_16x2(i));
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_unpack_u16(_mm_cvtsi32_si128(static_cast<int>(p)));
+			glm_vec4 const f = glm_vec4_mul(_mm_cvtepi32_ps(i), _mm_set1_ps(1.5259021896696421759365224689097e-5f));
+			return vec2(_mm_cvtss_f32(f), _mm_cvtss_f32(_mm_shuffle_ps(f, f, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+	};
+
+	template<>
+	struct compute_packSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			glm_ivec4 const i = glm_vec4_to_snorm(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f), _mm_set1_ps(32767.0f));
+			return static_cast<uint>(glm_ivec4_pack_16x2(i));
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_unpack_i16(_mm_cvtsi32_si128(static_cast<int>(p)));
+			glm_vec4 const f = glm_vec4_from_snorm(i, _mm_set1_ps(3.0518509475997192297128208258309e-5f));
+			return vec2(_mm_cvtss_f32(f), _mm_cvtss_f32(_mm_shuffle_ps(f, f, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+	};
+
+	template<>
+	struct compute_packUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			glm_ivec4 const i = glm_vec4_to_unorm(_mm_loadu_ps(&v.x), _mm_set1_ps(255.0f));
+			glm_ivec4 const i16 = _mm_packs_epi32(i, i);
+			return static_cast<uint>(_mm_cvtsi128_si32(_mm_packus_epi16(i16, i16)));
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_unpack_u8(_mm_cvtsi32_si128(static_cast<int>(p)));
+
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_mul(_mm_cvtepi32_ps(i), _mm_set1_ps(0.0039215686274509803921568627451f)));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			glm_ivec4 const i = glm_vec4_to_snorm(_mm_loadu_ps(&v.x), _mm_set1_ps(127.0f));
+			glm_ivec4 const i16 = _mm_packs_epi32(i, i);
+			return static_cast<uint>(_mm_cvtsi128_si32(_mm_packs_epi16(i16, i16)));
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			glm_ivec4 const i = glm_ivec4_unpack_i8(_mm_cvtsi32_si128(static_cast<int>(p)));
+
+			vec4 Result;
+			_mm_storeu_ps(&Result.x, glm_vec4_from_snorm(i, _mm_set1_ps(0.0078740157480315f)));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+#			if GLM_HAS_F16C
+				return static_cast<uint>(_mm_cvtsi128_si32(_mm_cvtps_ph(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f), _MM_FROUND_TO_NEAREST_INT)));
+#			else
+				return static_cast<uint>(glm_ivec4_pack_16x2(glm_vec4_to_half(_mm_setr_ps(v.x, v.y, 0.0f, 0.0f))));
+#			endif
+		}
+	};
+
+	template<>
+	struct compute_unpackHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint v)
+		{
+#			if GLM_HAS_F16C
+				glm_vec4 const f = _mm_cvtph_ps(_mm_cvtsi32_si128(static_cast<int>(v)));
+#			else
+				glm_vec4 const f = glm_vec4_from_half(glm_ivec4_unpack_u16(_mm_cvtsi32_si128(static_cast<int>(v))));
+#			endif
+			return vec2(_mm_cvtss_f32(f), _mm_cvtss_f32(_mm_shuffle_ps(f, f, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<>
+	struct compute_packUnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			float32x2_t const c = vmin_f32(vmax_f32(vld1_f32(&v.x), vdup_n_f32(0.0f)), vdup_n_f32(1.0f));
+			uint32x2_t const i = vcvta_u32_f32(vmul_f32(c, vdup_n_f32(65535.0f)));
+			uint16x4_t const i16 = vmovn_u32(vcombine_u32(i, i));
+			return vget_lane_u32(vreinterpret_u32_u16(i16), 0);
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			uint32x2_t const i = vget_low_u32(vmovl_u16(vreinterpret_u16_u32(vdup_n_u32(p))));
+			float32x2_t const f = vmul_f32(vcvt_f32_u32(i), vdup_n_f32(1.5259021896696421759365224689097e-5f));
+			return vec2(vget_lane_f32(f, 0), vget_lane_f32(f, 1));
+		}
+	};
+
+	template<>
+	struct compute_packSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			float32x2_t const c = vmin_f32(vmax_f32(vld1_f32(&v.x), vdup_n_f32(-1.0f)), vdup_n_f32(1.0f));
+			int32x2_t const i = vcvta_s32_f32(vmul_f32(c, vdup_n_f32(32767.0f)));
+			int16x4_t const i16 = vmovn_s32(vcombine_s32(i, i));
+			return vget_lane_u32(vreinterpret_u32_s16(i16), 0);
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint p)
+		{
+			int32x2_t const i = vget_low_s32(vmovl_s16(vreinterpret_s16_u32(vdup_n_u32(p))));
+			float32x2_t const f = vmul_f32(vcvt_f32_s32(i), vdup_n_f32(3.0518509475997192297128208258309e-5f));
+			float32x2_t const c = vmin_f32(vmax_f32(f, vdup_n_f32(-1.0f)), vdup_n_f32(1.0f));
+			return vec2(vget_lane_f32(c, 0), vget_lane_f32(c, 1));
+		}
+	};
+
+	template<>
+	struct compute_packUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			float32x4_t const c = vminq_f32(vmaxq_f32(vld1q_f32(&v.x), vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+			uint16x4_t const i16 = vmovn_u32(vcvtaq_u32_f32(vmulq_f32(c, vdupq_n_f32(255.0f))));
+			uint8x8_t const i8 = vmovn_u16(vcombine_u16(i16, i16));
+			return vget_lane_u32(vreinterpret_u32_u8(i8), 0);
+		}
+	};
+
+	template<>
+	struct compute_unpackUnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			uint32x4_t const i = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(p)))));
+
+			vec4 Result;
+			vst1q_f32(&Result.x, vmulq_f32(vcvtq_f32_u32(i), vdupq_n_f32(0.0039215686274509803921568627451f)));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec4 const& v)
+		{
+			float32x4_t const c = vminq_f32(vmaxq_f32(vld1q_f32(&v.x), vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f));
+			int16x4_t const i16 = vmovn_s32(vcvtaq_s32_f32(vmulq_f32(c, vdupq_n_f32(127.0f))));
+			int8x8_t const i8 = vmovn_s16(vcombine_s16(i16, i16));
+			return vget_lane_u32(vreinterpret_u32_s8(i8), 0);
+		}
+	};
+
+	template<>
+	struct compute_unpackSnorm4x8<true>
+	{
+		GLM_FUNC_QUALIFIER static vec4 call(uint p)
+		{
+			int32x4_t const i = vmovl_s16(vget_low_s16(vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(p)))));
+			float32x4_t const f = vmulq_f32(vcvtq_f32_s32(i), vdupq_n_f32(0.0078740157480315f));
+
+			vec4 Result;
+			vst1q_f32(&Result.x, vminq_f32(vmaxq_f32(f, vdupq_n_f32(-1.0f)), vdupq_n_f32(1.0f)));
+			return Result;
+		}
+	};
+
+	template<>
+	struct compute_packHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static uint call(vec2 const& v)
+		{
+			float16x4_t const h = vcvt_f16_f32(vcombine_f32(vld1_f32(&v.x), vdup_n_f32(0.0f)));
+			return vget_lane_u32(vreinterpret_u32_f16(h), 0);
+		}
+	};
 
+	template<>
+	struct compute_unpackHalf2x16<true>
+	{
+		GLM_FUNC_QUALIFIER static vec2 call(uint v)
+		{
+			float32x4_t const f = vcvt_f32_f16(vreinterpret_f16_u32(vdup_n_u32(v)));
+			return vec2(vgetq_lane_f32(f, 0), vgetq_lane_f32(f, 1));
+		}
+	};
+#endif
 }//namespace detail
 }//namespace glm
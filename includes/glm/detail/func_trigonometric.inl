@@ -2,8 +2,46 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::sin, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::cos, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_tan
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::tan, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_atan2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& y, vec<L, T, Q> const& x)
+		{
+			return detail::functor2<vec, L, T, Q>::call(::std::atan2, y, x);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template<typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -40,7 +78,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> sin(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(sin, v);
+		return detail::compute_sin<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// cos
@@ -49,7 +87,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> cos(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(cos, v);
+		return detail::compute_cos<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// tan
@@ -58,7 +96,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> tan(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(tan, v);
+		return detail::compute_tan<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// asin
@@ -91,7 +129,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> atan(vec<L, T, Q> const& y, vec<L, T, Q> const& x)
 	{
-		return detail::functor2<vec, L, T, Q>::call(::std::atan2, y, x);
+		return detail::compute_atan2<L, T, Q, detail::is_aligned<Q>::value>::call(y, x);
 	}
 
 	using std::atan;
@@ -0,0 +1,67 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
+{
+	// Inputs beyond GLM_SIMD_SINCOS_MAX_INPUT, infinities and NaNs take the scalar path
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_sincos_domain(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::sin, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_sincos_domain(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::cos, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(!glm_vec4_sincos_domain(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::tan, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& y, vec<4, float, Q> const& x)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan2(y.data, x.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
@@ -108,6 +108,12 @@ namespace detail
 #	endif
 
 #	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct storage<3, float, true>
+	{
+		typedef glm_f32vec4 type;
+	};
+
 	template<>
 	struct storage<4, float, true>
 	{
@@ -167,6 +173,12 @@ namespace detail
 #	endif
 
 #	if GLM_ARCH & GLM_ARCH_NEON_BIT
+	template<>
+	struct storage<3, float, true>
+	{
+		typedef glm_f32vec4 type;
+	};
+
 	template<>
 	struct storage<4, float, true>
 	{
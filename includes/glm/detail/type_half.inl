@@ -77,11 +77,12 @@ namespace detail
 			else
 			{
 				//
-				// Nan -- preserve sign and significand bits
+				// Nan -- preserve sign and significand bits and
+				// make it quiet, as the F16C and NEON conversions do
 				//
 
 				uif32 result;
-				result.i = static_cast<unsigned int>((s << 31) | 0x7f800000 | (m << 13));
+				result.i = static_cast<unsigned int>((s << 31) | 0x7fc00000 | (m << 13));
 				return result.f;
 			}
 		}
@@ -148,10 +149,14 @@ namespace detail
 			// We convert f to a denormalized half.
 			//
 
-			m = (m | 0x00800000) >> (1 - e);
+			m = m | 0x00800000;
+			int const shift = 14 - e;
+			int const half = 1 << (shift - 1);
+			int const rem = m & ((1 << shift) - 1);
+			m >>= shift;
 
 			//
-			// Round to nearest, round "0.5" up.
+			// Round to nearest, ties to even.
 			//
 			// Rounding may cause the significand to overflow and make
 			// our number normalized.  Because of the way a half's bits
@@ -159,14 +164,14 @@ namespace detail
 			// the code below will handle it correctly.
 			//
 
-			if(m & 0x00001000)
-				m += 0x00002000;
+			if(rem > half || (rem == half && (m & 1)))
+				m += 1;
 
 			//
 			// Assemble the half from s, e (zero) and m.
 			//
 
-			return hdata(s | (m >> 13));
+			return hdata(s | m);
 		}
 		else if(e == 0xff - (127 - 15))
 		{
@@ -182,17 +187,15 @@ namespace detail
 			else
 			{
 				//
-				// F is a NAN; we produce a half NAN that preserves
-				// the sign bit and the 10 leftmost bits of the
-				// significand of f, with one exception: If the 10
-				// leftmost bits are all zero, the NAN would turn
-				// into an infinity, so we have to set at least one
-				// bit in the significand.
+				// F is a NAN; we produce a quiet half NAN that
+				// preserves the sign bit and the 10 leftmost bits
+				// of the significand of f, as the F16C and NEON
+				// conversions do.
 				//
 
 				m >>= 13;
 
-				return hdata(s | 0x7c00 | m | (m == 0));
+				return hdata(s | 0x7e00 | m);
 			}
 		}
 		else
@@ -203,10 +206,10 @@ namespace detail
 			//
 
 			//
-			// Round to nearest, round "0.5" up
+			// Round to nearest, ties to even
 			//
 
-			if(m &  0x00001000)
+			if((m & 0x00001fff) > 0x00001000 || (m & 0x00003fff) == 0x00003000)
 			{
 				m += 0x00002000;
 
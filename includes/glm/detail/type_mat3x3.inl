@@ -2,6 +2,72 @@
 
 namespace glm
 {
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_mat3_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<3, T, Q> call(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& v)
+		{
+			return vec<3, T, Q>(
+				m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z,
+				m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z,
+				m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z);
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_vec3_mul_mat3
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<3, T, Q> call(vec<3, T, Q> const& v, mat<3, 3, T, Q> const& m)
+		{
+			return vec<3, T, Q>(
+				m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+				m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+				m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_mat3_mul
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<3, 3, T, Q> call(mat<3, 3, T, Q> const& m1, mat<3, 3, T, Q> const& m2)
+		{
+			T const SrcA00 = m1[0][0];
+			T const SrcA01 = m1[0][1];
+			T const SrcA02 = m1[0][2];
+			T const SrcA10 = m1[1][0];
+			T const SrcA11 = m1[1][1];
+			T const SrcA12 = m1[1][2];
+			T const SrcA20 = m1[2][0];
+			T const SrcA21 = m1[2][1];
+			T const SrcA22 = m1[2][2];
+
+			T const SrcB00 = m2[0][0];
+			T const SrcB01 = m2[0][1];
+			T const SrcB02 = m2[0][2];
+			T const SrcB10 = m2[1][0];
+			T const SrcB11 = m2[1][1];
+			T const SrcB12 = m2[1][2];
+			T const SrcB20 = m2[2][0];
+			T const SrcB21 = m2[2][1];
+			T const SrcB22 = m2[2][2];
+
+			mat<3, 3, T, Q> Result;
+			Result[0][0] = SrcA00 * SrcB00 + SrcA10 * SrcB01 + SrcA20 * SrcB02;
+			Result[0][1] = SrcA01 * SrcB00 + SrcA11 * SrcB01 + SrcA21 * SrcB02;
+			Result[0][2] = SrcA02 * SrcB00 + SrcA12 * SrcB01 + SrcA22 * SrcB02;
+			Result[1][0] = SrcA00 * SrcB10 + SrcA10 * SrcB11 + SrcA20 * SrcB12;
+			Result[1][1] = SrcA01 * SrcB10 + SrcA11 * SrcB11 + SrcA21 * SrcB12;
+			Result[1][2] = SrcA02 * SrcB10 + SrcA12 * SrcB11 + SrcA22 * SrcB12;
+			Result[2][0] = SrcA00 * SrcB20 + SrcA10 * SrcB21 + SrcA20 * SrcB22;
+			Result[2][1] = SrcA01 * SrcB20 + SrcA11 * SrcB21 + SrcA21 * SrcB22;
+			Result[2][2] = SrcA02 * SrcB20 + SrcA12 * SrcB21 + SrcA22 * SrcB22;
+			return Result;
+		}
+	};
+}//namespace detail
+
 	// -- Constructors --
 
 #	if GLM_CONFIG_DEFAULTED_DEFAULT_CTOR == GLM_DISABLE
@@ -467,55 +533,19 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename mat<3, 3, T, Q>::col_type operator*(mat<3, 3, T, Q> const& m, typename mat<3, 3, T, Q>::row_type const& v)
 	{
-		return typename mat<3, 3, T, Q>::col_type(
-			m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z,
-			m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z,
-			m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z);
+		return detail::compute_mat3_mul_vec3<T, Q, detail::is_aligned<Q>::value>::call(m, v);
 	}
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR typename mat<3, 3, T, Q>::row_type operator*(typename mat<3, 3, T, Q>::col_type const& v, mat<3, 3, T, Q> const& m)
 	{
-		return typename mat<3, 3, T, Q>::row_type(
-			m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
-			m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
-			m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+		return detail::compute_vec3_mul_mat3<T, Q, detail::is_aligned<Q>::value>::call(v, m);
 	}
 
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 3, T, Q> operator*(mat<3, 3, T, Q> const& m1, mat<3, 3, T, Q> const& m2)
 	{
-		T const SrcA00 = m1[0][0];
-		T const SrcA01 = m1[0][1];
-		T const SrcA02 = m1[0][2];
-		T const SrcA10 = m1[1][0];
-		T const SrcA11 = m1[1][1];
-		T const SrcA12 = m1[1][2];
-		T const SrcA20 = m1[2][0];
-		T const SrcA21 = m1[2][1];
-		T const SrcA22 = m1[2][2];
-
-		T const SrcB00 = m2[0][0];
-		T const SrcB01 = m2[0][1];
-		T const SrcB02 = m2[0][2];
-		T const SrcB10 = m2[1][0];
-		T const SrcB11 = m2[1][1];
-		T const SrcB12 = m2[1][2];
-		T const SrcB20 = m2[2][0];
-		T const SrcB21 = m2[2][1];
-		T const SrcB22 = m2[2][2];
-
-		mat<3, 3, T, Q> Result;
-		Result[0][0] = SrcA00 * SrcB00 + SrcA10 * SrcB01 + SrcA20 * SrcB02;
-		Result[0][1] = SrcA01 * SrcB00 + SrcA11 * SrcB01 + SrcA21 * SrcB02;
-		Result[0][2] = SrcA02 * SrcB00 + SrcA12 * SrcB01 + SrcA22 * SrcB02;
-		Result[1][0] = SrcA00 * SrcB10 + SrcA10 * SrcB11 + SrcA20 * SrcB12;
-		Result[1][1] = SrcA01 * SrcB10 + SrcA11 * SrcB11 + SrcA21 * SrcB12;
-		Result[1][2] = SrcA02 * SrcB10 + SrcA12 * SrcB11 + SrcA22 * SrcB12;
-		Result[2][0] = SrcA00 * SrcB20 + SrcA10 * SrcB21 + SrcA20 * SrcB22;
-		Result[2][1] = SrcA01 * SrcB20 + SrcA11 * SrcB21 + SrcA21 * SrcB22;
-		Result[2][2] = SrcA02 * SrcB20 + SrcA12 * SrcB21 + SrcA22 * SrcB22;
-		return Result;
+		return detail::compute_mat3_mul<T, Q, detail::is_aligned<Q>::value>::call(m1, m2);
 	}
 
 	template<typename T, qualifier Q>
@@ -599,3 +629,7 @@ namespace glm
 		return (m1[0] != m2[0]) || (m1[1] != m2[1]) || (m1[2] != m2[2]);
 	}
 } //namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "type_mat3x3_simd.inl"
+#endif
@@ -0,0 +1,103 @@
+/// @ref core
+/// @file glm/detail/type_mat3x3_simd.inl
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_mat3_mul_vec3<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(mat<3, 3, float, Q> const& m, vec<3, float, Q> const& v)
+		{
+			vec<3, float, Q> Result;
+			Result.data = glm_mat3_mul_vec3(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_vec3_mul_mat3<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(vec<3, float, Q> const& v, mat<3, 3, float, Q> const& m)
+		{
+			vec<3, float, Q> Result;
+			Result.data = glm_vec3_mul_mat3(v.data, &m[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat3_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m1, mat<3, 3, float, Q> const& m2)
+		{
+			mat<3, 3, float, Q> Result;
+			glm_mat3_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_mat3_mul_vec3<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(mat<3, 3, float, Q> const& m, vec<3, float, Q> const& v)
+		{
+			float32x4_t r = neon::mul_lane(m[0].data, v.data, 0);
+			r = neon::madd_lane(r, m[1].data, v.data, 1);
+			r = neon::madd_lane(r, m[2].data, v.data, 2);
+
+			vec<3, float, Q> Result;
+			Result.data = r;
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_vec3_mul_mat3<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> call(vec<3, float, Q> const& v, mat<3, 3, float, Q> const& m)
+		{
+			float32x4_t Rows[3];
+			neon::transpose3(&m[0].data, Rows);
+
+			float32x4_t r = neon::mul_lane(Rows[0], v.data, 0);
+			r = neon::madd_lane(r, Rows[1], v.data, 1);
+			r = neon::madd_lane(r, Rows[2], v.data, 2);
+
+			vec<3, float, Q> Result;
+			Result.data = r;
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat3_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m1, mat<3, 3, float, Q> const& m2)
+		{
+			mat<3, 3, float, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				float32x4_t r = neon::mul_lane(m1[0].data, m2[i].data, 0);
+				r = neon::madd_lane(r, m1[1].data, m2[i].data, 1);
+				r = neon::madd_lane(r, m1[2].data, m2[i].data, 2);
+				Result[i].data = r;
+			}
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
@@ -2,6 +2,53 @@
 
 namespace glm
 {
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_mat4_mul_vec4
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<4, T, Q> call(mat<4, 4, T, Q> const& m, vec<4, T, Q> const& v)
+		{
+			typename mat<4, 4, T, Q>::col_type const Mov0(v[0]);
+			typename mat<4, 4, T, Q>::col_type const Mov1(v[1]);
+			typename mat<4, 4, T, Q>::col_type const Mul0 = m[0] * Mov0;
+			typename mat<4, 4, T, Q>::col_type const Mul1 = m[1] * Mov1;
+			typename mat<4, 4, T, Q>::col_type const Add0 = Mul0 + Mul1;
+			typename mat<4, 4, T, Q>::col_type const Mov2(v[2]);
+			typename mat<4, 4, T, Q>::col_type const Mov3(v[3]);
+			typename mat<4, 4, T, Q>::col_type const Mul2 = m[2] * Mov2;
+			typename mat<4, 4, T, Q>::col_type const Mul3 = m[3] * Mov3;
+			typename mat<4, 4, T, Q>::col_type const Add1 = Mul2 + Mul3;
+			typename mat<4, 4, T, Q>::col_type const Add2 = Add0 + Add1;
+			return Add2;
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_mat4_mul
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2)
+		{
+			typename mat<4, 4, T, Q>::col_type const SrcA0 = m1[0];
+			typename mat<4, 4, T, Q>::col_type const SrcA1 = m1[1];
+			typename mat<4, 4, T, Q>::col_type const SrcA2 = m1[2];
+			typename mat<4, 4, T, Q>::col_type const SrcA3 = m1[3];
+
+			typename mat<4, 4, T, Q>::col_type const SrcB0 = m2[0];
+			typename mat<4, 4, T, Q>::col_type const SrcB1 = m2[1];
+			typename mat<4, 4, T, Q>::col_type const SrcB2 = m2[2];
+			typename mat<4, 4, T, Q>::col_type const SrcB3 = m2[3];
+
+			mat<4, 4, T, Q> Result;
+			Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
+			Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
+			Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
+			Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
+			return Result;
+		}
+	};
+}//namespace detail
+
 	// -- Constructors --
 
 #	if GLM_CONFIG_DEFAULTED_DEFAULT_CTOR == GLM_DISABLE
@@ -539,45 +586,7 @@ namespace glm
 		typename mat<4, 4, T, Q>::row_type const& v
 	)
 	{
-/*
-		__m128 v0 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(0, 0, 0, 0));
-		__m128 v1 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(1, 1, 1, 1));
-		__m128 v2 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(2, 2, 2, 2));
-		__m128 v3 = _mm_shuffle_ps(v.data, v.data, _MM_SHUFFLE(3, 3, 3, 3));
-
-		__m128 m0 = _mm_mul_ps(m[0].data, v0);
-		__m128 m1 = _mm_mul_ps(m[1].data, v1);
-		__m128 a0 = _mm_add_ps(m0, m1);
-
-		__m128 m2 = _mm_mul_ps(m[2].data, v2);
-		__m128 m3 = _mm_mul_ps(m[3].data, v3);
-		__m128 a1 = _mm_add_ps(m2, m3);
-
-		__m128 a2 = _mm_add_ps(a0, a1);
-
-		return typename mat<4, 4, T, Q>::col_type(a2);
-*/
-
-		typename mat<4, 4, T, Q>::col_type const Mov0(v[0]);
-		typename mat<4, 4, T, Q>::col_type const Mov1(v[1]);
-		typename mat<4, 4, T, Q>::col_type const Mul0 = m[0] * Mov0;
-		typename mat<4, 4, T, Q>::col_type const Mul1 = m[1] * Mov1;
-		typename mat<4, 4, T, Q>::col_type const Add0 = Mul0 + Mul1;
-		typename mat<4, 4, T, Q>::col_type const Mov2(v[2]);
-		typename mat<4, 4, T, Q>::col_type const Mov3(v[3]);
-		typename mat<4, 4, T, Q>::col_type const Mul2 = m[2] * Mov2;
-		typename mat<4, 4, T, Q>::col_type const Mul3 = m[3] * Mov3;
-		typename mat<4, 4, T, Q>::col_type const Add1 = Mul2 + Mul3;
-		typename mat<4, 4, T, Q>::col_type const Add2 = Add0 + Add1;
-		return Add2;
-
-/*
-		return typename mat<4, 4, T, Q>::col_type(
-			m[0][0] * v[0] + m[1][0] * v[1] + m[2][0] * v[2] + m[3][0] * v[3],
-			m[0][1] * v[0] + m[1][1] * v[1] + m[2][1] * v[2] + m[3][1] * v[3],
-			m[0][2] * v[0] + m[1][2] * v[1] + m[2][2] * v[2] + m[3][2] * v[3],
-			m[0][3] * v[0] + m[1][3] * v[1] + m[2][3] * v[2] + m[3][3] * v[3]);
-*/
+		return detail::compute_mat4_mul_vec4<T, Q, detail::is_aligned<Q>::value>::call(m, v);
 	}
 
 	template<typename T, qualifier Q>
@@ -629,22 +638,7 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> operator*(mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2)
 	{
-		typename mat<4, 4, T, Q>::col_type const SrcA0 = m1[0];
-		typename mat<4, 4, T, Q>::col_type const SrcA1 = m1[1];
-		typename mat<4, 4, T, Q>::col_type const SrcA2 = m1[2];
-		typename mat<4, 4, T, Q>::col_type const SrcA3 = m1[3];
-
-		typename mat<4, 4, T, Q>::col_type const SrcB0 = m2[0];
-		typename mat<4, 4, T, Q>::col_type const SrcB1 = m2[1];
-		typename mat<4, 4, T, Q>::col_type const SrcB2 = m2[2];
-		typename mat<4, 4, T, Q>::col_type const SrcB3 = m2[3];
-
-		mat<4, 4, T, Q> Result;
-		Result[0] = SrcA0 * SrcB0[0] + SrcA1 * SrcB0[1] + SrcA2 * SrcB0[2] + SrcA3 * SrcB0[3];
-		Result[1] = SrcA0 * SrcB1[0] + SrcA1 * SrcB1[1] + SrcA2 * SrcB1[2] + SrcA3 * SrcB1[3];
-		Result[2] = SrcA0 * SrcB2[0] + SrcA1 * SrcB2[1] + SrcA2 * SrcB2[2] + SrcA3 * SrcB2[3];
-		Result[3] = SrcA0 * SrcB3[0] + SrcA1 * SrcB3[1] + SrcA2 * SrcB3[2] + SrcA3 * SrcB3[3];
-		return Result;
+		return detail::compute_mat4_mul<T, Q, detail::is_aligned<Q>::value>::call(m1, m2);
 	}
 
 	template<typename T, qualifier Q>
@@ -1,6 +1,92 @@
 /// @ref core
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(mat<4, 4, double, Q> const& m, vec<4, double, Q> const& v)
+		{
+			vec<4, double, Q> Result;
+			Result.data = glm_dmat4_mul_dvec4(&m[0].data, v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_mat4_mul<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
+
+#elif (GLM_ARCH & GLM_ARCH_NEON_BIT) && (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
 {
+	template<qualifier Q>
+	struct compute_mat4_mul_vec4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(mat<4, 4, double, Q> const& m, vec<4, double, Q> const& v)
+		{
+			float64x2_t Lo = vmulq_n_f64(vld1q_f64(&m[0][0]), v[0]);
+			float64x2_t Hi = vmulq_n_f64(vld1q_f64(&m[0][2]), v[0]);
+			for(length_t k = 1; k < 4; ++k)
+			{
+				Lo = vfmaq_n_f64(Lo, vld1q_f64(&m[k][0]), v[k]);
+				Hi = vfmaq_n_f64(Hi, vld1q_f64(&m[k][2]), v[k]);
+			}
+
+			vec<4, double, Q> Result;
+			vst1q_f64(&Result[0], Lo);
+			vst1q_f64(&Result[2], Hi);
+			return Result;
+		}
+	};
 
+	template<qualifier Q>
+	struct compute_mat4_mul<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			float64x2_t Col[4][2];
+			for(length_t k = 0; k < 4; ++k)
+			{
+				Col[k][0] = vld1q_f64(&m1[k][0]);
+				Col[k][1] = vld1q_f64(&m1[k][2]);
+			}
+
+			mat<4, 4, double, Q> Result;
+			for(length_t i = 0; i < 4; ++i)
+			{
+				float64x2_t Lo = vmulq_n_f64(Col[0][0], m2[i][0]);
+				float64x2_t Hi = vmulq_n_f64(Col[0][1], m2[i][0]);
+				for(length_t k = 1; k < 4; ++k)
+				{
+					Lo = vfmaq_n_f64(Lo, Col[k][0], m2[i][k]);
+					Hi = vfmaq_n_f64(Hi, Col[k][1], m2[i][k]);
+				}
+				vst1q_f64(&Result[i][0], Lo);
+				vst1q_f64(&Result[i][2], Hi);
+			}
+			return Result;
+		}
+	};
+}//namespace detail
 }//namespace glm
+
+#endif
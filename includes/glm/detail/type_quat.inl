@@ -67,6 +67,19 @@ namespace detail
 			return vec<4, T, Q>(q * vec<3, T, Q>(v), v.w);
 		}
 	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_quat_mul_vec3
+	{
+		GLM_FUNC_QUALIFIER GLM_CONSTEXPR static vec<3, T, Q> call(qua<T, Q> const& q, vec<3, T, Q> const& v)
+		{
+			vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
+			vec<3, T, Q> const uv(glm::cross(QuatVector, v));
+			vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
+
+			return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		}
+	};
 }//namespace detail
 
 	// -- Component accesses --
@@ -358,11 +371,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> operator*(qua<T, Q> const& q, vec<3, T, Q> const& v)
 	{
-		vec<3, T, Q> const QuatVector(q.x, q.y, q.z);
-		vec<3, T, Q> const uv(glm::cross(QuatVector, v));
-		vec<3, T, Q> const uuv(glm::cross(QuatVector, uv));
-
-		return v + ((uv * q.w) + uuv) * static_cast<T>(2);
+		return detail::compute_quat_mul_vec3<T, Q, detail::is_aligned<Q>::value>::call(q, v);
 	}
 
 	template<typename T, qualifier Q>
@@ -386,8 +395,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> operator*(qua<T, Q> const& q, T const& s)
 	{
-		return qua<T, Q>::wxyz(
-			q.w * s, q.x * s, q.y * s, q.z * s);
+		return qua<T, Q>(q) *= s;
 	}
 
 	template<typename T, qualifier Q>
@@ -399,8 +407,7 @@ namespace detail
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR qua<T, Q> operator/(qua<T, Q> const& q, T const& s)
 	{
-		return qua<T, Q>::wxyz(
-			q.w / s, q.x / s, q.y / s, q.z / s);
+		return qua<T, Q>(q) /= s;
 	}
 
 	// -- Boolean operators --
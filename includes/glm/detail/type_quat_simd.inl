@@ -113,7 +113,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_mul_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -126,7 +126,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_mul_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_mul_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -137,7 +137,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_div_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -150,7 +150,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_div_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_div_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -202,6 +202,101 @@ namespace detail
 #			endif
 		}
 	};
+
+	template<qualifier Q>
+	struct compute_quat_mul_vec3<float, Q, true>
+	{
+		static vec<3, float, Q> call(qua<float, Q> const& q, vec<3, float, Q> const& v)
+		{
+			vec<4, float, Q> v4;
+			v4.data = v.data;
+
+			vec<3, float, Q> Result;
+			Result.data = compute_quat_mul_vec4<float, Q, true>::call(q, v4).data;
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_add<float, Q, true>
+	{
+		static qua<float, Q> call(qua<float, Q> const& q, qua<float, Q> const& p)
+		{
+			qua<float, Q> Result;
+			Result.data = vaddq_f32(q.data, p.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_sub<float, Q, true>
+	{
+		static qua<float, Q> call(qua<float, Q> const& q, qua<float, Q> const& p)
+		{
+			qua<float, Q> Result;
+			Result.data = vsubq_f32(q.data, p.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mul_scalar<float, Q, true>
+	{
+		static qua<float, Q> call(qua<float, Q> const& q, float s)
+		{
+			qua<float, Q> Result;
+			Result.data = vmulq_n_f32(q.data, s);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mul_vec4<float, Q, true>
+	{
+		static vec<4, float, Q> call(qua<float, Q> const& q, vec<4, float, Q> const& v)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				float32x4_t const u = vextq_f32(q.data, q.data, 1);
+#			else
+				float32x4_t const u = q.data;
+#			endif
+
+			float32x4_t const uv = neon::cross(u, v.data);
+			float32x4_t const uuv = neon::cross(u, uv);
+			float32x4_t const r = vaddq_f32(v.data, vmulq_n_f32(vaddq_f32(neon::mul_lane(uv, u, 3), uuv), 2.0f));
+
+			vec<4, float, Q> Result;
+			Result.data = neon::copy_lane(r, 3, v.data, 3);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mul_vec3<float, Q, true>
+	{
+		static vec<3, float, Q> call(qua<float, Q> const& q, vec<3, float, Q> const& v)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				float32x4_t const u = vextq_f32(q.data, q.data, 1);
+#			else
+				float32x4_t const u = q.data;
+#			endif
+
+			float32x4_t const uv = neon::cross(u, v.data);
+			float32x4_t const uuv = neon::cross(u, uv);
+
+			vec<3, float, Q> Result;
+			Result.data = vaddq_f32(v.data, vmulq_n_f32(vaddq_f32(neon::mul_lane(uv, u, 3), uuv), 2.0f));
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
@@ -0,0 +1,169 @@
+/// @ref core
+/// @file glm/detail/type_vec3_simd.inl
+
+// Aligned float vec3 are stored in a glm_f32vec4 whose w lane is unused, so that arithmetic stays in registers.
+// Constructors replicate z in the w lane to keep it finite through divisions.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm {
+	namespace detail
+	{
+		template<qualifier Q>
+		struct compute_vec3_add<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = _mm_add_ps(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_sub<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = _mm_sub_ps(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_mul<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = _mm_mul_ps(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_div<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = _mm_div_ps(a.data, b.data);
+				return Result;
+			}
+		};
+	}//namespace detail
+
+	// Specializing a constructor instantiates vec3, and with it the vec4 swizzles before type_vec4_simd.inl specializes them
+#	if GLM_CONFIG_SWIZZLE != GLM_SWIZZLE_OPERATOR
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_lowp>::vec(float _s) :
+		data(_mm_set1_ps(_s))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_mediump>::vec(float _s) :
+		data(_mm_set1_ps(_s))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_highp>::vec(float _s) :
+		data(_mm_set1_ps(_s))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_lowp>::vec(float _x, float _y, float _z) :
+		data(_mm_set_ps(_z, _z, _y, _x))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_mediump>::vec(float _x, float _y, float _z) :
+		data(_mm_set_ps(_z, _z, _y, _x))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_highp>::vec(float _x, float _y, float _z) :
+		data(_mm_set_ps(_z, _z, _y, _x))
+	{}
+#	endif
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm {
+	namespace detail
+	{
+		template<qualifier Q>
+		struct compute_vec3_add<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = vaddq_f32(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_sub<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = vsubq_f32(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_mul<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+				Result.data = vmulq_f32(a.data, b.data);
+				return Result;
+			}
+		};
+
+		template<qualifier Q>
+		struct compute_vec3_div<float, Q, true>
+		{
+			static vec<3, float, Q> call(vec<3, float, Q> const& a, vec<3, float, Q> const& b)
+			{
+				vec<3, float, Q> Result;
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+				Result.data = vdivq_f32(a.data, b.data);
+#else
+				// Two Newton-Raphson steps on the VRECPE estimate, as for vec4
+				float32x4_t x = vrecpeq_f32(b.data);
+				x = vmulq_f32(vrecpsq_f32(b.data, x), x);
+				x = vmulq_f32(vrecpsq_f32(b.data, x), x);
+				Result.data = vmulq_f32(a.data, x);
+#endif
+				return Result;
+			}
+		};
+	}//namespace detail
+
+#if !GLM_CONFIG_XYZW_ONLY && GLM_CONFIG_SWIZZLE != GLM_SWIZZLE_OPERATOR
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_lowp>::vec(float _s) :
+		data(vdupq_n_f32(_s))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_mediump>::vec(float _s) :
+		data(vdupq_n_f32(_s))
+	{}
+
+	template<>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, float, aligned_highp>::vec(float _s) :
+		data(vdupq_n_f32(_s))
+	{}
+#endif
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_NEON_BIT
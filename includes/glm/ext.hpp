@@ -194,8 +194,13 @@
 #endif
 
 #ifdef GLM_ENABLE_EXPERIMENTAL
+#include "./gtx/aabb.hpp"
+#include "./gtx/array_arithmetic.hpp"
+#include "./gtx/array_packing.hpp"
+#include "./gtx/array_transform.hpp"
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
@@ -211,18 +216,16 @@
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/frustum_culling.hpp"
 #include "./gtx/functions.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
-
-#if __cplusplus >= 201103L
 #include "./gtx/hash.hpp"
-#endif
-
 #include "./gtx/integer.hpp"
 #include "./gtx/intersect.hpp"
 #include "./gtx/io.hpp"
 #include "./gtx/log_base.hpp"
+#include "./gtx/matrix_affine.hpp"
 #include "./gtx/matrix_cross_product.hpp"
 #include "./gtx/matrix_decompose.hpp"
 #include "./gtx/matrix_factorisation.hpp"
@@ -230,7 +233,10 @@
 #include "./gtx/matrix_major_storage.hpp"
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
+#include "./gtx/mesh_weld.hpp"
 #include "./gtx/mixed_product.hpp"
+#include "./gtx/morton.hpp"
+#include "./gtx/noise_field.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
 #include "./gtx/normalize_dot.hpp"
@@ -240,11 +246,16 @@
 #include "./gtx/pca.hpp"
 #include "./gtx/perpendicular.hpp"
 #include "./gtx/polar_coordinates.hpp"
+#include "./gtx/pose.hpp"
 #include "./gtx/projection.hpp"
 #include "./gtx/quaternion.hpp"
+#include "./gtx/random.hpp"
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_normalized_axis.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/skinning.hpp"
+#include "./gtx/soa.hpp"
+#include "./gtx/spatial_hash.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
@@ -1,3 +1,5 @@
+#include "../simd/trigonometric.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
 namespace glm{
@@ -11,8 +13,153 @@ namespace detail
 			return _mm_cvtss_f32(glm_vec1_dot(x.data, y.data));
 		}
 	};
+
+	template<qualifier Q>
+	struct compute_quat_conjugate<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& q)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				glm_vec4 const sgn = _mm_set_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+#			else
+				glm_vec4 const sgn = _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f);
+#			endif
+
+			qua<float, Q> Result;
+			Result.data = _mm_xor_ps(q.data, sgn);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mix<float, Q, true>
+	{
+		// Interpolates along the arc from x to y, cosTheta holds dot(x, y) in every lane.
+		// sin(angle) is recovered from cosTheta and the 2 remaining sines share a single glm_vec4_sin.
+		GLM_FUNC_QUALIFIER static glm_vec4 arc(glm_vec4 x, glm_vec4 y, glm_vec4 cosTheta, float a)
+		{
+			glm_vec4 const wx = _mm_set1_ps(1.0f - a);
+			glm_vec4 const wy = _mm_set1_ps(a);
+
+			// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+			if(_mm_cvtss_f32(cosTheta) > 1.0f - glm::epsilon<float>())
+				return glm_vec4_add(glm_vec4_mul(x, wx), glm_vec4_mul(y, wy));
+
+			glm_vec4 const one = _mm_set1_ps(1.0f);
+			glm_vec4 const sinTheta = _mm_sqrt_ps(glm_vec4_mul(glm_vec4_sub(one, cosTheta), glm_vec4_add(one, cosTheta)));
+			glm_vec4 const angle = glm_vec4_atan2(sinTheta, cosTheta);
+			glm_vec4 const t = glm_vec4_mul(_mm_unpacklo_ps(wx, wy), angle);
+
+			glm_vec4 s;
+			if(glm_vec4_sincos_domain(t))
+				s = glm_vec4_sin(t);
+			else
+				s = _mm_setr_ps(std::sin(_mm_cvtss_f32(t)), std::sin(_mm_cvtss_f32(_mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)))), 0.0f, 0.0f);
+
+			glm_vec4 const sx = _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0));
+			glm_vec4 const sy = _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1));
+			return glm_vec4_div(glm_vec4_add(glm_vec4_mul(x, sx), glm_vec4_mul(y, sy)), sinTheta);
+		}
+
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			qua<float, Q> Result;
+			Result.data = arc(x.data, y.data, glm_vec4_dot(x.data, y.data), a);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_slerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			glm_vec4 const dot0 = glm_vec4_dot(x.data, y.data);
+
+			// If cosTheta < 0, y and cosTheta are negated so that the interpolation takes the short way around the sphere
+			glm_vec4 const sgn = _mm_and_ps(_mm_cmplt_ps(dot0, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+			qua<float, Q> Result;
+			Result.data = compute_quat_mix<float, Q, true>::arc(x.data, _mm_xor_ps(y.data, sgn), _mm_xor_ps(dot0, sgn), a);
+			return Result;
+		}
+	};
 }//namespace detail
 }//namespace glm
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_conjugate<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& q)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				uint32x4_t const sgn = vsetq_lane_u32(0u, vdupq_n_u32(0x80000000u), 0);
+#			else
+				uint32x4_t const sgn = vsetq_lane_u32(0u, vdupq_n_u32(0x80000000u), 3);
+#			endif
+
+			qua<float, Q> Result;
+			Result.data = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(q.data), sgn));
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	struct compute_quat_mix<float, Q, true>
+	{
+		// Interpolates along the arc from x to y given cosTheta = dot(x, y).
+		// sin(angle) is recovered from cosTheta and the 2 remaining sines share a single glm_vec4_sin.
+		GLM_FUNC_QUALIFIER static float32x4_t arc(float32x4_t x, float32x4_t y, float cosTheta, float a)
+		{
+			// Perform a linear interpolation when cosTheta is close to 1 to avoid side effect of sin(angle) becoming a zero denominator
+			if(cosTheta > 1.0f - glm::epsilon<float>())
+				return vaddq_f32(vmulq_n_f32(x, 1.0f - a), vmulq_n_f32(y, a));
+
+			float32x4_t const c = vdupq_n_f32(cosTheta);
+			float32x4_t const sinTheta = vdupq_n_f32(std::sqrt((1.0f - cosTheta) * (1.0f + cosTheta)));
+			float32x4_t const angle = glm_vec4_atan2(sinTheta, c);
+			float32x4_t const t = vmulq_f32(vsetq_lane_f32(a, vdupq_n_f32(1.0f - a), 1), angle);
 
+			float32x4_t s;
+			if(glm_vec4_sincos_domain(t))
+				s = glm_vec4_sin(t);
+			else
+				s = vsetq_lane_f32(std::sin(vgetq_lane_f32(t, 1)), vdupq_n_f32(std::sin(vgetq_lane_f32(t, 0))), 1);
+
+			return vdivq_f32(vaddq_f32(vmulq_laneq_f32(x, s, 0), vmulq_laneq_f32(y, s, 1)), sinTheta);
+		}
+
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			qua<float, Q> Result;
+			Result.data = arc(x.data, y.data, vaddvq_f32(vmulq_f32(x.data, y.data)), a);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_slerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			float const cosTheta = vaddvq_f32(vmulq_f32(x.data, y.data));
+
+			// If cosTheta < 0, y and cosTheta are negated so that the interpolation takes the short way around the sphere
+			qua<float, Q> Result;
+			Result.data = cosTheta < 0.0f
+				? compute_quat_mix<float, Q, true>::arc(x.data, vnegq_f32(y.data), -cosTheta, a)
+				: compute_quat_mix<float, Q, true>::arc(x.data, y.data, cosTheta, a);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,54 @@
+#include "../simd/geometric.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_normalize<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& q)
+		{
+			glm_vec4 const dot0 = glm_vec4_dot(q.data, q.data);
+			if(_mm_cvtss_f32(dot0) <= 0.0f) // Problem
+				return qua<float, Q>::wxyz(1.0f, 0.0f, 0.0f, 0.0f);
+
+			qua<float, Q> Result;
+			Result.data = _mm_div_ps(q.data, _mm_sqrt_ps(dot0));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_normalize<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& q)
+		{
+			float32x4_t const p = vmulq_f32(q.data, q.data);
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			float const dot0 = vaddvq_f32(p);
+#else
+			float32x2_t v = vpadd_f32(vget_low_f32(p), vget_high_f32(p));
+			v = vpadd_f32(v, v);
+			float const dot0 = vget_lane_f32(v, 0);
+#endif
+			if(dot0 <= 0.0f) // Problem
+				return qua<float, Q>::wxyz(1.0f, 0.0f, 0.0f, 0.0f);
+
+			qua<float, Q> Result;
+			Result.data = vmulq_n_f32(q.data, 1.0f / std::sqrt(dot0));
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -1695,6 +1695,8 @@ export namespace glm {
 		using glm::ballRand;
 		using glm::bitCount;
 		using glm::bitfieldDeinterleave;
+		using glm::bitfieldDeinterleave3;
+		using glm::bitfieldDeinterleave4;
 		using glm::bitfieldExtract;
 		using glm::bitfieldFillOne;
 		using glm::bitfieldFillZero;
@@ -2206,6 +2208,10 @@ export namespace glm {
 		using glm::io::operator<<;
 		using glm::operator<<;
 		using glm::tdualquat;
+#       if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		using glm::aligned_affine_mat4;
+		using glm::aligned_aabb3;
+#       endif
 
 #       if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
 		using glm::to_string;
@@ -2220,14 +2226,23 @@ export namespace glm {
 		using glm::end;
 #       endif
 
+		using glm::aabb;
+		using glm::aabb2;
+		using glm::aabb3;
 		using glm::abs;
+		using glm::accumulateCovariance;
 		using glm::acos;
 		using glm::acosh;
+		using glm::addArray;
 		using glm::adjugate;
+		using glm::affineMultiply;
+		using glm::affine_identity;
+		using glm::affine_mat4;
 		using glm::all;
 		using glm::angle;
 		using glm::angleAxis;
 		using glm::any;
+		using glm::aosToSoa;
 		using glm::areCollinear;
 		using glm::areOrthogonal;
 		using glm::areOrthonormal;
@@ -2243,24 +2258,36 @@ export namespace glm {
 		using glm::backEaseIn;
 		using glm::backEaseInOut;
 		using glm::backEaseOut;
+		using glm::ballRandArray;
 		using glm::bitCount;
 		using glm::bitfieldDeinterleave;
+		using glm::bitfieldDeinterleave3;
+		using glm::bitfieldDeinterleave4;
+		using glm::bitfieldDeinterleaveArray;
 		using glm::bitfieldExtract;
 		using glm::bitfieldFillOne;
 		using glm::bitfieldFillZero;
 		using glm::bitfieldInsert;
 		using glm::bitfieldInterleave;
+		using glm::bitfieldInterleaveArray;
 		using glm::bitfieldReverse;
 		using glm::bitfieldRotateLeft;
 		using glm::bitfieldRotateRight;
+		using glm::blendRotations;
+		using glm::blendVectors;
 		using glm::bounceEaseIn;
 		using glm::bounceEaseInOut;
 		using glm::bounceEaseOut;
+		using glm::buildBVH;
+		using glm::buildLBVH;
+		using glm::buildSpatialHash;
+		using glm::bvh;
 		using glm::catmullRom;
 		using glm::ceil;
 		using glm::circularEaseIn;
 		using glm::circularEaseInOut;
 		using glm::circularEaseOut;
+		using glm::circularRandArray;
 		using glm::clamp;
 		using glm::closeBounded;
 		using glm::closestPointOnLine;
@@ -2273,20 +2300,31 @@ export namespace glm {
 		using glm::compMul;
 		using glm::compNormalize;
 		using glm::compScale;
+		using glm::compactVertices;
+		using glm::composeTransforms;
 		using glm::computeCovarianceMatrix;
 		using glm::conjugate;
 		using glm::convertD65XYZToD50XYZ;
 		using glm::convertD65XYZToLinearSRGB;
+		using glm::convertFloatToHalf;
+		using glm::convertHalfToFloat;
 		using glm::convertLinearSRGBToD50XYZ;
 		using glm::convertLinearSRGBToD65XYZ;
 		using glm::cos;
 		using glm::cos_one_over_two;
 		using glm::cosh;
+		using glm::covariance_accumulator;
 		using glm::cross;
 		using glm::cubic;
 		using glm::cubicEaseIn;
 		using glm::cubicEaseInOut;
 		using glm::cubicEaseOut;
+		using glm::cullBoxes;
+		using glm::cullSpheres;
+		using glm::daabb2;
+		using glm::daabb3;
+		using glm::daffine_mat4;
+		using glm::dbvh;
 		using glm::decompose;
 		using glm::degrees;
 		using glm::derivedEulerAngleX;
@@ -2302,9 +2340,14 @@ export namespace glm {
 		using glm::diagonal4x2;
 		using glm::diagonal4x3;
 		using glm::diagonal4x4;
+		using glm::diskRandArray;
 		using glm::distance;
 		using glm::distance2;
+		using glm::divArray;
+		using glm::dlbvh;
 		using glm::dot;
+		using glm::dspatial_hash;
+		using glm::dualQuaternionSkinning;
 		using glm::dual_quat_identity;
 		using glm::dualquat_cast;
 		using glm::e;
@@ -2380,12 +2423,18 @@ export namespace glm {
 		using glm::fastSqrt;
 		using glm::fastTan;
 		using glm::fclamp;
+		using glm::findEigenvaluesSymReal;
+		using glm::findEigenvaluesSymReal3;
 		using glm::findLSB;
 		using glm::findMSB;
+		using glm::findSpatialHash;
 		using glm::fliplr;
 		using glm::flipud;
 		using glm::floatBitsToInt;
 		using glm::floatBitsToUint;
+		using glm::float_soa;
+		using glm::float_soa4;
+		using glm::float_soa8;
 		using glm::floor;
 		using glm::floor_log2;
 		using glm::fma;
@@ -2400,15 +2449,21 @@ export namespace glm {
 		using glm::frustumLH_NO;
 		using glm::frustumLH_ZO;
 		using glm::frustumNO;
+		using glm::frustumPlanes;
+		using glm::frustumPlanesNO;
+		using glm::frustumPlanesZO;
 		using glm::frustumRH;
 		using glm::frustumRH_NO;
 		using glm::frustumRH_ZO;
 		using glm::frustumZO;
 		using glm::gauss;
+		using glm::gaussRandArray;
 		using glm::golden_ratio;
 		using glm::greaterThan;
 		using glm::greaterThanEqual;
 		using glm::half_pi;
+		using glm::hashArray;
+		using glm::hashValue;
 		using glm::hermite;
 		using glm::highestBitValue;
 		using glm::hsvColor;
@@ -2420,11 +2475,16 @@ export namespace glm {
 		using glm::intBitsToFloat;
 		using glm::intermediate;
 		using glm::interpolate;
+		using glm::intersectFrustumBox;
+		using glm::intersectFrustumSphere;
 		using glm::intersectLineSphere;
 		using glm::intersectLineTriangle;
+		using glm::intersectRayBVH;
 		using glm::intersectRayPlane;
 		using glm::intersectRaySphere;
 		using glm::intersectRayTriangle;
+		using glm::intersectRayTriangles;
+		using glm::intersectRaysBVH;
 		using glm::inverse;
 		using glm::inversesqrt;
 		using glm::iround;
@@ -2440,6 +2500,7 @@ export namespace glm {
 		using glm::l1Norm;
 		using glm::l2Norm;
 		using glm::lMaxNorm;
+		using glm::lbvh;
 		using glm::ldexp;
 		using glm::leftHanded;
 		using glm::length;
@@ -2447,11 +2508,15 @@ export namespace glm {
 		using glm::lerp;
 		using glm::lessThan;
 		using glm::lessThanEqual;
+		using glm::linearBlendSkinning;
 		using glm::linearGradient;
 		using glm::linearInterpolation;
+		using glm::linearRandArray;
 		using glm::ln_ln_two;
 		using glm::ln_ten;
 		using glm::ln_two;
+		using glm::loadSoa;
+		using glm::localToModel;
 		using glm::log;
 		using glm::log2;
 		using glm::lookAt;
@@ -2486,6 +2551,9 @@ export namespace glm {
 		using glm::matrixCross3;
 		using glm::matrixCross4;
 		using glm::max;
+		using glm::merge;
+		using glm::mergeBoxes;
+		using glm::mergeCovariance;
 		using glm::min;
 		using glm::mirrorClamp;
 		using glm::mirrorRepeat;
@@ -2493,6 +2561,9 @@ export namespace glm {
 		using glm::mixedProduct;
 		using glm::mod;
 		using glm::modf;
+		using glm::mortonCodes;
+		using glm::mortonSort;
+		using glm::mulArray;
 		using glm::nlz;
 		using glm::normalize;
 		using glm::normalizeDot;
@@ -2523,10 +2594,27 @@ export namespace glm {
 		using glm::outerProduct;
 		using glm::packDouble2x32;
 		using glm::packHalf2x16;
+		using glm::packHalf2x16Array;
+		using glm::packOct16;
+		using glm::packOct16Array;
+		using glm::packOct24;
+		using glm::packOct24Array;
+		using glm::packOct32;
+		using glm::packOct32Array;
+		using glm::packPosition3x16;
+		using glm::packPosition3x16Array;
+		using glm::packQTangent;
+		using glm::packQTangentArray;
 		using glm::packSnorm2x16;
+		using glm::packSnorm2x16Array;
 		using glm::packSnorm4x8;
+		using glm::packSnorm4x8Array;
 		using glm::packUnorm2x16;
+		using glm::packUnorm2x16Array;
 		using glm::packUnorm4x8;
+		using glm::packUnorm4x8Array;
+		using glm::perlinArray;
+		using glm::perlinGrid;
 		using glm::perp;
 		using glm::perspective;
 		using glm::perspectiveFov;
@@ -2576,6 +2664,7 @@ export namespace glm {
 		using glm::quatLookAtRH;
 		using glm::quat_cast;
 		using glm::quat_identity;
+		using glm::querySpatialHash;
 		using glm::quinticEaseIn;
 		using glm::quinticEaseInOut;
 		using glm::quinticEaseOut;
@@ -2589,6 +2678,7 @@ export namespace glm {
 		using glm::rgb2YCoCgR;
 		using glm::rgbColor;
 		using glm::rightHanded;
+		using glm::rigidInverse;
 		using glm::roll;
 		using glm::root_five;
 		using glm::root_half_pi;
@@ -2619,25 +2709,45 @@ export namespace glm {
 		using glm::shearZ3D;
 		using glm::shortMix;
 		using glm::sign;
+		using glm::simplexArray;
+		using glm::simplexGrid;
 		using glm::sin;
 		using glm::sineEaseIn;
 		using glm::sineEaseInOut;
 		using glm::sineEaseOut;
 		using glm::sinh;
+		using glm::skinningPalette;
 		using glm::slerp;
+		using glm::slerpRotations;
 		using glm::smoothstep;
+		using glm::soa;
+		using glm::soaToAos;
 		using glm::sortEigenvalues;
+		using glm::spatialHashKey;
+		using glm::spatial_hash;
+		using glm::sphericalRandArray;
 		using glm::sqrt;
 		using glm::squad;
 		using glm::step;
+		using glm::storeSoa;
+		using glm::subArray;
+		using glm::taffine;
 		using glm::tan;
 		using glm::tanh;
+		using glm::tbvh;
 		using glm::third;
 		using glm::three_over_two_pi;
+		using glm::tlbvh;
+		using glm::transformBox;
+		using glm::transformBoxes;
+		using glm::transformNormals;
+		using glm::transformPoints;
+		using glm::transformVectors;
 		using glm::translate;
 		using glm::transpose;
 		using glm::triangleNormal;
 		using glm::trunc;
+		using glm::tspatial_hash;
 		using glm::tweakedInfinitePerspective;
 		using glm::two_over_pi;
 		using glm::two_over_root_pi;
@@ -2651,15 +2761,41 @@ export namespace glm {
 		using glm::unProjectZO;
 		using glm::unpackDouble2x32;
 		using glm::unpackHalf2x16;
+		using glm::unpackHalf2x16Array;
+		using glm::unpackOct16;
+		using glm::unpackOct16Array;
+		using glm::unpackOct24;
+		using glm::unpackOct24Array;
+		using glm::unpackOct32;
+		using glm::unpackOct32Array;
+		using glm::unpackPosition3x16;
+		using glm::unpackPosition3x16Array;
+		using glm::unpackQTangent;
+		using glm::unpackQTangentArray;
 		using glm::unpackSnorm2x16;
+		using glm::unpackSnorm2x16Array;
 		using glm::unpackSnorm4x8;
+		using glm::unpackSnorm4x8Array;
 		using glm::unpackUnorm2x16;
+		using glm::unpackUnorm2x16Array;
 		using glm::unpackUnorm4x8;
+		using glm::unpackUnorm4x8Array;
 		using glm::uround;
 		using glm::usubBorrow;
 		using glm::value_ptr;
+		using glm::vec2_soa;
+		using glm::vec2_soa4;
+		using glm::vec2_soa8;
+		using glm::vec3_soa;
+		using glm::vec3_soa4;
+		using glm::vec3_soa8;
+		using glm::vec4_soa;
+		using glm::vec4_soa4;
+		using glm::vec4_soa8;
+		using glm::weldVertices;
 		using glm::wrapAngle;
 		using glm::wxyz;
+		using glm::xoshiro128;
 		using glm::yaw;
 		using glm::yawPitchRoll;
 		using glm::zero;
@@ -232,6 +232,19 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint32 x, uint32 y, uint32 z);
 
+	/// Deinterleaves the bits of x, the inverse of bitfieldInterleave of 3 values of up to 8 bits.
+	/// The bits 0, 3, 6... of x are returned in the first component, the bits 1, 4, 7... in the second and the bits 2, 5, 8... in the third,
+	/// so the 30 bits Morton codes of 10 bits coordinates are decoded too.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u16vec3 bitfieldDeinterleave3(glm::uint32 x);
+
+	/// Deinterleaves the bits of x, the inverse of bitfieldInterleave of 3 values of up to 16 or 21 bits.
+	/// The bits 0, 3, 6... of x are returned in the first component, the bits 1, 4, 7... in the second and the bits 2, 5, 8... in the third.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u32vec3 bitfieldDeinterleave3(glm::uint64 x);
+
 	/// Interleaves the bits of x, y, z and w.
 	/// The first bit is the first bit of x followed by the first bit of y, the first bit of z and finally the first bit of w.
 	/// The other bits are interleaved following the previous sequence.
@@ -260,6 +273,16 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Deinterleaves the bits of x, the inverse of bitfieldInterleave of 4 values of 8 bits.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u8vec4 bitfieldDeinterleave4(glm::uint32 x);
+
+	/// Deinterleaves the bits of x, the inverse of bitfieldInterleave of 4 values of 16 bits.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL glm::u16vec4 bitfieldDeinterleave4(glm::uint64 x);
+
 	/// @}
 } //namespace glm
 
@@ -14,6 +14,81 @@ namespace detail
 	template<typename PARAM, typename RET>
 	GLM_FUNC_DECL RET bitfieldInterleave(PARAM x, PARAM y, PARAM z, PARAM w);
 
+#if GLM_HAS_BMI2
+	// Bit deposit scatters the bits of each value to its positions of the interleaved result in a single instruction
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
+	{
+		return static_cast<glm::uint16>(
+			_pdep_u64(x, static_cast<glm::uint64>(0x5555ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0xAAAAull)));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
+	{
+		return static_cast<glm::uint32>(
+			_pdep_u64(x, static_cast<glm::uint64>(0x55555555ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0xAAAAAAAAull)));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
+	{
+		return
+			_pdep_u64(x, static_cast<glm::uint64>(0x5555555555555555ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0xAAAAAAAAAAAAAAAAull));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
+	{
+		return static_cast<glm::uint32>(
+			_pdep_u64(x, static_cast<glm::uint64>(0x49249249ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0x92492492ull)) |
+			_pdep_u64(z, static_cast<glm::uint64>(0x24924924ull)));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
+	{
+		return
+			_pdep_u64(x, static_cast<glm::uint64>(0x9249249249249249ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0x2492492492492492ull)) |
+			_pdep_u64(z, static_cast<glm::uint64>(0x4924924924924924ull));
+	}
+
+	// As the shift and mask version, the 22 first bits of x and the 21 first bits of y and z are kept
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
+	{
+		return
+			_pdep_u64(x, static_cast<glm::uint64>(0x9249249249249249ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0x2492492492492492ull)) |
+			_pdep_u64(z, static_cast<glm::uint64>(0x4924924924924924ull));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
+	{
+		return static_cast<glm::uint32>(
+			_pdep_u64(x, static_cast<glm::uint64>(0x11111111ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0x22222222ull)) |
+			_pdep_u64(z, static_cast<glm::uint64>(0x44444444ull)) |
+			_pdep_u64(w, static_cast<glm::uint64>(0x88888888ull)));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
+	{
+		return
+			_pdep_u64(x, static_cast<glm::uint64>(0x1111111111111111ull)) |
+			_pdep_u64(y, static_cast<glm::uint64>(0x2222222222222222ull)) |
+			_pdep_u64(z, static_cast<glm::uint64>(0x4444444444444444ull)) |
+			_pdep_u64(w, static_cast<glm::uint64>(0x8888888888888888ull));
+	}
+#else
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
@@ -219,6 +294,7 @@ namespace detail
 
 		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
 	}
+#endif//GLM_HAS_BMI2
 }//namespace detail
 
 #if GLM_COMPILER & GLM_COMPILER_CLANG
@@ -339,6 +415,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
 	{
+#		if GLM_HAS_BMI2
+		return glm::u8vec2(
+			_pext_u64(x, static_cast<glm::uint64>(0x5555ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0xAAAAull)));
+#		else
 		uint16 REG1(x);
 		uint16 REG2(x >>= 1);
 
@@ -358,6 +439,7 @@ namespace detail
 		REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
 
 		return glm::u8vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
@@ -393,6 +475,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
 	{
+#		if GLM_HAS_BMI2
+		return glm::u16vec2(
+			_pext_u64(x, static_cast<glm::uint64>(0x55555555ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0xAAAAAAAAull)));
+#		else
 		glm::uint32 REG1(x);
 		glm::uint32 REG2(x >>= 1);
 
@@ -412,6 +499,7 @@ namespace detail
 		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
 
 		return glm::u16vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
@@ -447,6 +535,11 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
 	{
+#		if GLM_HAS_BMI2
+		return glm::u32vec2(
+			_pext_u64(x, static_cast<glm::uint64>(0x5555555555555555ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0xAAAAAAAAAAAAAAAAull)));
+#		else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(x >>= 1);
 
@@ -469,6 +562,7 @@ namespace detail
 		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
 
 		return glm::u32vec2(REG1, REG2);
+#		endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
@@ -632,4 +726,161 @@ namespace detail
 	{
 		return detail::bitfieldInterleave<uint16, uint64>(v.x, v.y, v.z, v.w);
 	}
+
+	GLM_FUNC_QUALIFIER glm::u16vec3 bitfieldDeinterleave3(glm::uint32 x)
+	{
+#		if GLM_HAS_BMI2
+		return glm::u16vec3(
+			_pext_u64(x, static_cast<glm::uint64>(0x49249249ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x92492492ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x24924924ull)));
+#		else
+		glm::uint32 REG1(x);
+		glm::uint32 REG2(x >> 1);
+		glm::uint32 REG3(x >> 2);
+
+		REG1 = REG1 & static_cast<glm::uint32>(0x49249249u);
+		REG2 = REG2 & static_cast<glm::uint32>(0x49249249u);
+		REG3 = REG3 & static_cast<glm::uint32>(0x09249249u);
+
+		REG1 = ((REG1 >>  2) | REG1) & static_cast<glm::uint32>(0xC30C30C3u);
+		REG2 = ((REG2 >>  2) | REG2) & static_cast<glm::uint32>(0xC30C30C3u);
+		REG3 = ((REG3 >>  2) | REG3) & static_cast<glm::uint32>(0xC30C30C3u);
+
+		REG1 = ((REG1 >>  4) | REG1) & static_cast<glm::uint32>(0x0F00F00Fu);
+		REG2 = ((REG2 >>  4) | REG2) & static_cast<glm::uint32>(0x0F00F00Fu);
+		REG3 = ((REG3 >>  4) | REG3) & static_cast<glm::uint32>(0x0F00F00Fu);
+
+		REG1 = ((REG1 >>  8) | REG1) & static_cast<glm::uint32>(0xFF0000FFu);
+		REG2 = ((REG2 >>  8) | REG2) & static_cast<glm::uint32>(0xFF0000FFu);
+		REG3 = ((REG3 >>  8) | REG3) & static_cast<glm::uint32>(0xFF0000FFu);
+
+		REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint32>(0x0000FFFFu);
+		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint32>(0x0000FFFFu);
+		REG3 = ((REG3 >> 16) | REG3) & static_cast<glm::uint32>(0x0000FFFFu);
+
+		return glm::u16vec3(REG1, REG2, REG3);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::u32vec3 bitfieldDeinterleave3(glm::uint64 x)
+	{
+#		if GLM_HAS_BMI2
+		return glm::u32vec3(
+			_pext_u64(x, static_cast<glm::uint64>(0x9249249249249249ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x2492492492492492ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x4924924924924924ull)));
+#		else
+		glm::uint64 REG1(x);
+		glm::uint64 REG2(x >> 1);
+		glm::uint64 REG3(x >> 2);
+
+		REG1 = REG1 & static_cast<glm::uint64>(0x9249249249249249ull);
+		REG2 = REG2 & static_cast<glm::uint64>(0x1249249249249249ull);
+		REG3 = REG3 & static_cast<glm::uint64>(0x1249249249249249ull);
+
+		REG1 = ((REG1 >>  2) | REG1) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+		REG2 = ((REG2 >>  2) | REG2) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+		REG3 = ((REG3 >>  2) | REG3) & static_cast<glm::uint64>(0x30C30C30C30C30C3ull);
+
+		REG1 = ((REG1 >>  4) | REG1) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+		REG2 = ((REG2 >>  4) | REG2) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+		REG3 = ((REG3 >>  4) | REG3) & static_cast<glm::uint64>(0xF00F00F00F00F00Full);
+
+		REG1 = ((REG1 >>  8) | REG1) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+		REG2 = ((REG2 >>  8) | REG2) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+		REG3 = ((REG3 >>  8) | REG3) & static_cast<glm::uint64>(0x00FF0000FF0000FFull);
+
+		REG1 = ((REG1 >> 16) | REG1) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+		REG3 = ((REG3 >> 16) | REG3) & static_cast<glm::uint64>(0xFFFF00000000FFFFull);
+
+		REG1 = ((REG1 >> 32) | REG1) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+		REG2 = ((REG2 >> 32) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+		REG3 = ((REG3 >> 32) | REG3) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
+
+		return glm::u32vec3(REG1, REG2, REG3);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::u8vec4 bitfieldDeinterleave4(glm::uint32 x)
+	{
+#		if GLM_HAS_BMI2
+		return glm::u8vec4(
+			_pext_u64(x, static_cast<glm::uint64>(0x11111111ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x22222222ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x44444444ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x88888888ull)));
+#		else
+		glm::uint32 REG1(x);
+		glm::uint32 REG2(x >> 1);
+		glm::uint32 REG3(x >> 2);
+		glm::uint32 REG4(x >> 3);
+
+		REG1 = REG1 & static_cast<glm::uint32>(0x11111111u);
+		REG2 = REG2 & static_cast<glm::uint32>(0x11111111u);
+		REG3 = REG3 & static_cast<glm::uint32>(0x11111111u);
+		REG4 = REG4 & static_cast<glm::uint32>(0x11111111u);
+
+		REG1 = ((REG1 >>  3) | REG1) & static_cast<glm::uint32>(0x03030303u);
+		REG2 = ((REG2 >>  3) | REG2) & static_cast<glm::uint32>(0x03030303u);
+		REG3 = ((REG3 >>  3) | REG3) & static_cast<glm::uint32>(0x03030303u);
+		REG4 = ((REG4 >>  3) | REG4) & static_cast<glm::uint32>(0x03030303u);
+
+		REG1 = ((REG1 >>  6) | REG1) & static_cast<glm::uint32>(0x000F000Fu);
+		REG2 = ((REG2 >>  6) | REG2) & static_cast<glm::uint32>(0x000F000Fu);
+		REG3 = ((REG3 >>  6) | REG3) & static_cast<glm::uint32>(0x000F000Fu);
+		REG4 = ((REG4 >>  6) | REG4) & static_cast<glm::uint32>(0x000F000Fu);
+
+		REG1 = ((REG1 >> 12) | REG1) & static_cast<glm::uint32>(0x000000FFu);
+		REG2 = ((REG2 >> 12) | REG2) & static_cast<glm::uint32>(0x000000FFu);
+		REG3 = ((REG3 >> 12) | REG3) & static_cast<glm::uint32>(0x000000FFu);
+		REG4 = ((REG4 >> 12) | REG4) & static_cast<glm::uint32>(0x000000FFu);
+
+		return glm::u8vec4(REG1, REG2, REG3, REG4);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER glm::u16vec4 bitfieldDeinterleave4(glm::uint64 x)
+	{
+#		if GLM_HAS_BMI2
+		return glm::u16vec4(
+			_pext_u64(x, static_cast<glm::uint64>(0x1111111111111111ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x2222222222222222ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x4444444444444444ull)),
+			_pext_u64(x, static_cast<glm::uint64>(0x8888888888888888ull)));
+#		else
+		glm::uint64 REG1(x);
+		glm::uint64 REG2(x >> 1);
+		glm::uint64 REG3(x >> 2);
+		glm::uint64 REG4(x >> 3);
+
+		REG1 = REG1 & static_cast<glm::uint64>(0x1111111111111111ull);
+		REG2 = REG2 & static_cast<glm::uint64>(0x1111111111111111ull);
+		REG3 = REG3 & static_cast<glm::uint64>(0x1111111111111111ull);
+		REG4 = REG4 & static_cast<glm::uint64>(0x1111111111111111ull);
+
+		REG1 = ((REG1 >>  3) | REG1) & static_cast<glm::uint64>(0x0303030303030303ull);
+		REG2 = ((REG2 >>  3) | REG2) & static_cast<glm::uint64>(0x0303030303030303ull);
+		REG3 = ((REG3 >>  3) | REG3) & static_cast<glm::uint64>(0x0303030303030303ull);
+		REG4 = ((REG4 >>  3) | REG4) & static_cast<glm::uint64>(0x0303030303030303ull);
+
+		REG1 = ((REG1 >>  6) | REG1) & static_cast<glm::uint64>(0x000F000F000F000Full);
+		REG2 = ((REG2 >>  6) | REG2) & static_cast<glm::uint64>(0x000F000F000F000Full);
+		REG3 = ((REG3 >>  6) | REG3) & static_cast<glm::uint64>(0x000F000F000F000Full);
+		REG4 = ((REG4 >>  6) | REG4) & static_cast<glm::uint64>(0x000F000F000F000Full);
+
+		REG1 = ((REG1 >> 12) | REG1) & static_cast<glm::uint64>(0x000000FF000000FFull);
+		REG2 = ((REG2 >> 12) | REG2) & static_cast<glm::uint64>(0x000000FF000000FFull);
+		REG3 = ((REG3 >> 12) | REG3) & static_cast<glm::uint64>(0x000000FF000000FFull);
+		REG4 = ((REG4 >> 12) | REG4) & static_cast<glm::uint64>(0x000000FF000000FFull);
+
+		REG1 = ((REG1 >> 24) | REG1) & static_cast<glm::uint64>(0x000000000000FFFFull);
+		REG2 = ((REG2 >> 24) | REG2) & static_cast<glm::uint64>(0x000000000000FFFFull);
+		REG3 = ((REG3 >> 24) | REG3) & static_cast<glm::uint64>(0x000000000000FFFFull);
+		REG4 = ((REG4 >> 24) | REG4) & static_cast<glm::uint64>(0x000000000000FFFFull);
+
+		return glm::u16vec4(REG1, REG2, REG3, REG4);
+#		endif
+	}
 }//namespace glm
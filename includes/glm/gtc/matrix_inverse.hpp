@@ -36,6 +36,16 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType affineInverse(genType const& m);
 
+	/// Fast matrix inverse for rigid transformations, made only of a rotation and a translation.
+	///
+	/// The upper-left block of the matrix must be orthonormal, so the matrix can't contain any scale or shear.
+	///
+	/// @param m Input matrix to invert.
+	/// @tparam genType Squared floating-point matrix: half, float or double.
+	/// @see gtc_matrix_inverse
+	template<typename genType>
+	GLM_FUNC_DECL genType rigidInverse(genType const& m);
+
 	/// Compute the inverse transpose of a matrix.
 	///
 	/// @param m Input matrix to invert transpose.
@@ -2,6 +2,39 @@
 
 namespace glm
 {
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
+		{
+			mat<3, 3, T, Q> const Inv(inverse(mat<3, 3, T, Q>(m)));
+
+			return mat<4, 4, T, Q>(
+				vec<4, T, Q>(Inv[0], static_cast<T>(0)),
+				vec<4, T, Q>(Inv[1], static_cast<T>(0)),
+				vec<4, T, Q>(Inv[2], static_cast<T>(0)),
+				vec<4, T, Q>(-Inv * vec<3, T, Q>(m[3]), static_cast<T>(1)));
+		}
+	};
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_rigid_inverse
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m)
+		{
+			mat<3, 3, T, Q> const Inv(transpose(mat<3, 3, T, Q>(m)));
+
+			return mat<4, 4, T, Q>(
+				vec<4, T, Q>(Inv[0], static_cast<T>(0)),
+				vec<4, T, Q>(Inv[1], static_cast<T>(0)),
+				vec<4, T, Q>(Inv[2], static_cast<T>(0)),
+				vec<4, T, Q>(-Inv * vec<3, T, Q>(m[3]), static_cast<T>(1)));
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> affineInverse(mat<3, 3, T, Q> const& m)
 	{
@@ -16,13 +49,24 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> affineInverse(mat<4, 4, T, Q> const& m)
 	{
-		mat<3, 3, T, Q> const Inv(inverse(mat<3, 3, T, Q>(m)));
+		return detail::compute_affine_inverse<T, Q, detail::is_aligned<Q>::value>::call(m);
+	}
 
-		return mat<4, 4, T, Q>(
-			vec<4, T, Q>(Inv[0], static_cast<T>(0)),
-			vec<4, T, Q>(Inv[1], static_cast<T>(0)),
-			vec<4, T, Q>(Inv[2], static_cast<T>(0)),
-			vec<4, T, Q>(-Inv * vec<3, T, Q>(m[3]), static_cast<T>(1)));
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> rigidInverse(mat<3, 3, T, Q> const& m)
+	{
+		mat<2, 2, T, Q> const Inv(transpose(mat<2, 2, T, Q>(m)));
+
+		return mat<3, 3, T, Q>(
+			vec<3, T, Q>(Inv[0], static_cast<T>(0)),
+			vec<3, T, Q>(Inv[1], static_cast<T>(0)),
+			vec<3, T, Q>(-Inv * vec<2, T, Q>(m[2]), static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> rigidInverse(mat<4, 4, T, Q> const& m)
+	{
+		return detail::compute_rigid_inverse<T, Q, detail::is_aligned<Q>::value>::call(m);
 	}
 
 	template<typename T, qualifier Q>
@@ -116,3 +160,7 @@ namespace glm
 		return Inverse;
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_inverse_simd.inl"
+#endif
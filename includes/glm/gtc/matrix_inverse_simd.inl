@@ -0,0 +1,90 @@
+/// @ref gtc_matrix_inverse
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_affine_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_rigid_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_rigid_inverse(&m[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			float32x4_t Adj[3];
+			Adj[0] = neon::cross(m[1].data, m[2].data);
+			Adj[1] = neon::cross(m[2].data, m[0].data);
+			Adj[2] = neon::cross(m[0].data, m[1].data);
+
+			float32x4_t const Rcp = vdupq_n_f32(1.0f / neon::dot3(m[0].data, Adj[0]));
+
+			float32x4_t Tmp[3];
+			neon::transpose3(Adj, Tmp);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = vsetq_lane_f32(0.0f, vmulq_f32(Tmp[0], Rcp), 3);
+			Result[1].data = vsetq_lane_f32(0.0f, vmulq_f32(Tmp[1], Rcp), 3);
+			Result[2].data = vsetq_lane_f32(0.0f, vmulq_f32(Tmp[2], Rcp), 3);
+
+			float32x4_t t = neon::mul_lane(Result[0].data, m[3].data, 0);
+			t = neon::madd_lane(t, Result[1].data, m[3].data, 1);
+			t = neon::madd_lane(t, Result[2].data, m[3].data, 2);
+			Result[3].data = vsetq_lane_f32(1.0f, vnegq_f32(t), 3);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_rigid_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			float32x4_t Tmp[3];
+			neon::transpose3(&m[0].data, Tmp);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = vsetq_lane_f32(0.0f, Tmp[0], 3);
+			Result[1].data = vsetq_lane_f32(0.0f, Tmp[1], 3);
+			Result[2].data = vsetq_lane_f32(0.0f, Tmp[2], 3);
+
+			float32x4_t t = neon::mul_lane(Result[0].data, m[3].data, 0);
+			t = neon::madd_lane(t, Result[1].data, m[3].data, 1);
+			t = neon::madd_lane(t, Result[2].data, m[3].data, 2);
+			Result[3].data = vsetq_lane_f32(1.0f, vnegq_f32(t), 3);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
@@ -722,6 +722,79 @@ namespace glm
 	/// @see int packUint2x16(u32vec2 const& v)
 	GLM_FUNC_DECL u32vec2 unpackUint2x32(uint64 p);
 
+	/// Encodes the unit vector v with the octahedral mapping and packs the two coordinates as 8-bit signed normalized values.
+	/// The octahedral coordinates of v are its projection on the octahedron |x| + |y| + |z| = 1, whose lower half is folded over the upper half.
+	/// The coordinates are converted like packSnorm2x8, the first one in the least significant bits.
+	/// The angular error of the round trip is at most about 0.95 degree for oct16, 0.06 degree for oct24 and 0.004 degree for oct32.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOct16(uint16 p)
+	/// @see <a href="http://jcgt.org/published/0003/02/01/">A Survey of Efficient Representations for Independent Unit Vectors</a>
+	GLM_FUNC_DECL uint16 packOct16(vec3 const& v);
+
+	/// Decodes a unit vector packed by packOct16, normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packOct16(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOct16(uint16 p);
+
+	/// Encodes the unit vector v with the octahedral mapping and packs the two coordinates as 12-bit signed normalized values
+	/// in the 24 least significant bits of the returned value, round(clamp(c, -1, +1) * 2047.0).
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOct24(uint32 p)
+	/// @see uint16 packOct16(vec3 const& v)
+	GLM_FUNC_DECL uint32 packOct24(vec3 const& v);
+
+	/// Decodes a unit vector packed by packOct24, normalized. The 8 most significant bits of p are ignored.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOct24(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOct24(uint32 p);
+
+	/// Encodes the unit vector v with the octahedral mapping and packs the two coordinates as 16-bit signed normalized values like packSnorm2x16.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackOct32(uint32 p)
+	/// @see uint16 packOct16(vec3 const& v)
+	GLM_FUNC_DECL uint32 packOct32(vec3 const& v);
+
+	/// Decodes a unit vector packed by packOct32, normalized.
+	///
+	/// @see gtc_packing
+	/// @see uint32 packOct32(vec3 const& v)
+	GLM_FUNC_DECL vec3 unpackOct32(uint32 p);
+
+	/// Encodes the tangent frame of a vertex as a quaternion, a QTangent, packed like packSnorm4x16 in the order x, y, z, w.
+	/// tangent.w is the sign of the bitangent, bitangent = cross(normal, tangent.xyz) * tangent.w.
+	/// The tangent is orthogonalized against the normal. The quaternion is stored with w at least 1 / 32767 in magnitude,
+	/// and its sign gives the sign of the bitangent.
+	///
+	/// @see gtc_packing
+	/// @see void unpackQTangent(uint64 p, vec3& normal, vec4& tangent)
+	GLM_FUNC_DECL uint64 packQTangent(vec3 const& normal, vec4 const& tangent);
+
+	/// Decodes a tangent frame packed by packQTangent. tangent.w receives the sign of the bitangent, +1 or -1.
+	///
+	/// @see gtc_packing
+	/// @see uint64 packQTangent(vec3 const& normal, vec4 const& tangent)
+	GLM_FUNC_DISCARD_DECL void unpackQTangent(uint64 p, vec3& normal, vec4& tangent);
+
+	/// Quantizes the position v relative to the box [minBounds, maxBounds] to 16-bit unsigned integers.
+	///
+	/// The conversion for component c of v is done as follows:
+	/// round(clamp((c - minBounds) * (65535.0 / (maxBounds - minBounds)), 0, 65535)), 0 if the box is empty along the component.
+	///
+	/// @see gtc_packing
+	/// @see vec3 unpackPosition3x16(u16vec3 const& p, vec3 const& minBounds, vec3 const& maxBounds)
+	GLM_FUNC_DECL u16vec3 packPosition3x16(vec3 const& v, vec3 const& minBounds, vec3 const& maxBounds);
+
+	/// Dequantizes a position quantized by packPosition3x16 with the same box, minBounds + p * ((maxBounds - minBounds) / 65535.0).
+	///
+	/// @see gtc_packing
+	/// @see u16vec3 packPosition3x16(vec3 const& v, vec3 const& minBounds, vec3 const& maxBounds)
+	GLM_FUNC_DECL vec3 unpackPosition3x16(u16vec3 const& p, vec3 const& minBounds, vec3 const& maxBounds);
+
 	/// @}
 }// namespace glm
 
@@ -3,6 +3,7 @@
 #include "../ext/scalar_relational.hpp"
 #include "../ext/vector_relational.hpp"
 #include "../common.hpp"
+#include "../geometric.hpp"
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
@@ -363,6 +364,46 @@ namespace detail
 			return vec<4, float, Q>(detail::toFloat32(Unpack.x), detail::toFloat32(Unpack.y), detail::toFloat32(Unpack.z), detail::toFloat32(Unpack.w));
 		}
 	};
+	// Two octahedral coordinates of v, converted to Bits-bit signed normalized values, the first one in the least significant bits
+	GLM_FUNC_QUALIFIER uint32 packOct(vec3 const& v, float Scale, int Bits)
+	{
+		float const Sum = abs(v.x) + abs(v.y) + abs(v.z);
+		float const x = Sum > 0.0f ? v.x / Sum : 0.0f;
+		float const y = Sum > 0.0f ? v.y / Sum : 0.0f;
+
+		// The lower half of the octahedron is folded over the upper half along its diagonals
+		float const u = v.z < 0.0f ? (1.0f - abs(y)) * (x < 0.0f ? -1.0f : 1.0f) : x;
+		float const w = v.z < 0.0f ? (1.0f - abs(x)) * (y < 0.0f ? -1.0f : 1.0f) : y;
+
+		uint32 const Mask = (1u << Bits) - 1u;
+		uint32 const a = static_cast<uint32>(static_cast<int>(round(clamp(u, -1.0f, 1.0f) * Scale)));
+		uint32 const b = static_cast<uint32>(static_cast<int>(round(clamp(w, -1.0f, 1.0f) * Scale)));
+		return (a & Mask) | ((b & Mask) << Bits);
+	}
+
+	// Sign extends the Bits low bits of p
+	GLM_FUNC_QUALIFIER float unpackOctSnorm(uint32 p, float InvScale, int Bits)
+	{
+		uint32 const Mask = (1u << Bits) - 1u;
+		int const Value = static_cast<int>(p & Mask) - static_cast<int>((p << 1) & (Mask + 1u));
+		return clamp(static_cast<float>(Value) * InvScale, -1.0f, 1.0f);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOct(uint32 p, float InvScale, int Bits)
+	{
+		float const x = unpackOctSnorm(p, InvScale, Bits);
+		float const y = unpackOctSnorm(p >> Bits, InvScale, Bits);
+		float const z = 1.0f - abs(x) - abs(y);
+		float const t = max(-z, 0.0f);
+
+		vec3 const v(x + (x >= 0.0f ? -t : t), y + (y >= 0.0f ? -t : t), z);
+		return v * (1.0f / sqrt(v.x * v.x + v.y * v.y + v.z * v.z));
+	}
+
+	GLM_FUNC_QUALIFIER float packPositionScale(float Extent)
+	{
+		return Extent > 0.0f ? 65535.0f / Extent : 0.0f;
+	}
 }//namespace detail
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
@@ -947,5 +988,84 @@ namespace detail
 		memcpy(&Unpack, &p, sizeof(Unpack));
 		return Unpack;
 	}
+
+	GLM_FUNC_QUALIFIER uint16 packOct16(vec3 const& v)
+	{
+		return static_cast<uint16>(detail::packOct(v, 127.0f, 8));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOct16(uint16 p)
+	{
+		return detail::unpackOct(p, 0.0078740157480315f, 8); // 1.0f / 127.0f
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOct24(vec3 const& v)
+	{
+		return detail::packOct(v, 2047.0f, 12);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOct24(uint32 p)
+	{
+		return detail::unpackOct(p, 4.8851978505129457743038593063019e-4f, 12); // 1.0f / 2047.0f
+	}
+
+	GLM_FUNC_QUALIFIER uint32 packOct32(vec3 const& v)
+	{
+		return detail::packOct(v, 32767.0f, 16);
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackOct32(uint32 p)
+	{
+		return detail::unpackOct(p, 3.0518509475997192297128208258309e-5f, 16); // 1.0f / 32767.0f
+	}
+
+	GLM_FUNC_QUALIFIER uint64 packQTangent(vec3 const& normal, vec4 const& tangent)
+	{
+		vec3 const N(normalize(normal));
+		vec3 T(vec3(tangent) - N * dot(N, vec3(tangent)));
+		if(dot(T, T) <= 0.0f)
+			T = abs(N.x) > abs(N.z) ? vec3(-N.y, N.x, 0.0f) : vec3(0.0f, -N.z, N.y);
+		T = normalize(T);
+
+		quat q(quat_cast(mat3(T, cross(N, T), N)));
+		if(q.w < 0.0f)
+			q = -q;
+
+		// w must not round to 0 once packed, so that its sign can hold the sign of the bitangent
+		float const Bias = 1.0f / 32767.0f;
+		if(q.w < Bias)
+		{
+			float const Scale = sqrt(1.0f - Bias * Bias);
+			q = quat(Bias, q.x * Scale, q.y * Scale, q.z * Scale);
+		}
+		if(tangent.w < 0.0f)
+			q = -q;
+
+		return packSnorm4x16(vec4(q.x, q.y, q.z, q.w));
+	}
+
+	GLM_FUNC_QUALIFIER void unpackQTangent(uint64 p, vec3& normal, vec4& tangent)
+	{
+		vec4 const Packed(unpackSnorm4x16(p));
+		float const Sign = Packed.w < 0.0f ? -1.0f : 1.0f;
+		float const Length2 = Packed.x * Packed.x + Packed.y * Packed.y + Packed.z * Packed.z + Packed.w * Packed.w;
+		vec4 const q(Packed * (1.0f / sqrt(Length2)));
+
+		// The first and third columns of mat3_cast(q), the sign of q cancels out
+		normal = vec3(2.0f * (q.x * q.z + q.w * q.y), 2.0f * (q.y * q.z - q.w * q.x), 1.0f - 2.0f * (q.x * q.x + q.y * q.y));
+		tangent = vec4(1.0f - 2.0f * (q.y * q.y + q.z * q.z), 2.0f * (q.x * q.y + q.w * q.z), 2.0f * (q.x * q.z - q.w * q.y), Sign);
+	}
+
+	GLM_FUNC_QUALIFIER u16vec3 packPosition3x16(vec3 const& v, vec3 const& minBounds, vec3 const& maxBounds)
+	{
+		vec3 const Extent(maxBounds - minBounds);
+		vec3 const Scale(detail::packPositionScale(Extent.x), detail::packPositionScale(Extent.y), detail::packPositionScale(Extent.z));
+		return u16vec3(round(clamp((v - minBounds) * Scale, 0.0f, 65535.0f)));
+	}
+
+	GLM_FUNC_QUALIFIER vec3 unpackPosition3x16(u16vec3 const& p, vec3 const& minBounds, vec3 const& maxBounds)
+	{
+		return minBounds + vec3(p) * ((maxBounds - minBounds) / 65535.0f);
+	}
 }//namespace glm
 
@@ -0,0 +1,100 @@
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/quaternion.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_mat4_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(qua<float, Q> const& q)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				glm_vec4 const u = _mm_shuffle_ps(q.data, q.data, _MM_SHUFFLE(0, 3, 2, 1));
+#			else
+				glm_vec4 const u = q.data;
+#			endif
+
+			mat<4, 4, float, Q> Result;
+			glm_quat_mat3_cast(u, &Result[0].data);
+			Result[3].data = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mat3_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(qua<float, Q> const& q)
+		{
+			mat<4, 4, float, Q> const m(compute_quat_mat4_cast<float, Q, true>::call(q));
+
+			mat<3, 3, float, Q> Result;
+			Result[0].data = m[0].data;
+			Result[1].data = m[1].data;
+			Result[2].data = m[2].data;
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_quat_mat4_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(qua<float, Q> const& q)
+		{
+#			ifdef GLM_FORCE_QUAT_DATA_WXYZ
+				float32x4_t const u = vextq_f32(q.data, q.data, 1);
+#			else
+				float32x4_t const u = q.data;
+#			endif
+
+			float32x4_t const u2 = vaddq_f32(u, u);
+			float32x4_t const sq = vmulq_f32(u, u2);
+
+			// Diagonal: 1 - 2 * (yy + zz), 1 - 2 * (zz + xx), 1 - 2 * (xx + yy), 0
+			float32x4_t const sq0 = neon::yzx(sq);
+			float32x4_t const dia = vsetq_lane_f32(0.0f, vsubq_f32(vdupq_n_f32(1.0f), vaddq_f32(sq0, neon::yzx(sq0))), 3);
+
+			// sum: 2 * (xy + wz), 2 * (yz + wx), 2 * (zx + wy)
+			// dif: 2 * (xy - wz), 2 * (yz - wx), 2 * (zx - wy)
+			float32x4_t const u20 = neon::yzx(u2);
+			float32x4_t const pr0 = vmulq_f32(u, u20);
+			float32x4_t const pr1 = neon::mul_lane(neon::yzx(u20), u, 3);
+			float32x4_t const sum = vaddq_f32(pr0, pr1);
+			float32x4_t const dif = vsubq_f32(pr0, pr1);
+
+			mat<4, 4, float, Q> Result;
+			Result[0].data = neon::copy_lane(neon::copy_lane(dia, 1, sum, 0), 2, dif, 2);
+			Result[1].data = neon::copy_lane(neon::copy_lane(dia, 0, dif, 0), 2, sum, 1);
+			Result[2].data = neon::copy_lane(neon::copy_lane(dia, 0, sum, 2), 1, dif, 1);
+			Result[3].data = vsetq_lane_f32(1.0f, vdupq_n_f32(0.0f), 3);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_quat_mat3_cast<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(qua<float, Q> const& q)
+		{
+			mat<4, 4, float, Q> const m(compute_quat_mat4_cast<float, Q, true>::call(q));
+
+			mat<3, 3, float, Q> Result;
+			Result[0].data = m[0].data;
+			Result[1].data = m[1].data;
+			Result[2].data = m[2].data;
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
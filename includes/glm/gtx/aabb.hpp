@@ -0,0 +1,129 @@
+/// @ref gtx_aabb
+/// @file glm/gtx/aabb.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_aabb GLM_GTX_aabb
+/// @ingroup gtx
+///
+/// Include <glm/gtx/aabb.hpp> to use the features of this extension.
+///
+/// Axis aligned bounding boxes, their transformation by affine matrices and their merge.
+/// A box is transformed with the method of Arvo: the center is transformed by the matrix
+/// and the half extents by the absolute values of its linear part, which bounds the 8 transformed corners exactly.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_aabb is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_aabb extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_aabb
+	/// @{
+
+	/// Axis aligned box of L dimensions holding the points p where min <= p <= max.
+	/// @see gtx_aabb
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct aabb
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<L, T, Q> vec_type;
+
+		// -- Data --
+
+		vec_type min, max;
+
+		// -- Implicit basic constructors --
+
+		GLM_DEFAULTED_FUNC_DECL GLM_CONSTEXPR aabb() GLM_DEFAULT;
+		GLM_DEFAULTED_FUNC_DECL GLM_CONSTEXPR aabb(aabb<L, T, Q> const& b) GLM_DEFAULT;
+
+		// -- Explicit basic constructors --
+
+		/// Builds the box of a single point
+		GLM_CTOR_DECL GLM_EXPLICIT aabb(vec_type const& point);
+		GLM_CTOR_DECL aabb(vec_type const& minCorner, vec_type const& maxCorner);
+
+		// -- Unary arithmetic operators --
+
+		GLM_DEFAULTED_FUNC_DECL aabb<L, T, Q> & operator=(aabb<L, T, Q> const& b) GLM_DEFAULT;
+	};
+
+	// -- Boolean operators --
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator==(aabb<L, T, Q> const& b1, aabb<L, T, Q> const& b2);
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator!=(aabb<L, T, Q> const& b1, aabb<L, T, Q> const& b2);
+
+	/// Returns the smallest box containing a and b.
+	/// @see gtx_aabb
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<L, T, Q> merge(aabb<L, T, Q> const& a, aabb<L, T, Q> const& b);
+
+	/// Returns the smallest box containing b and the point p.
+	/// @see gtx_aabb
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<L, T, Q> merge(aabb<L, T, Q> const& b, vec<L, T, Q> const& p);
+
+	/// Returns the smallest box containing the boxes [0, count), count must be at least 1.
+	/// Boxes are reduced independently: a large array may be split in chunks merged on different threads,
+	/// then the results of the chunks merged together.
+	/// @see gtx_aabb
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<L, T, Q> mergeBoxes(aabb<L, T, Q> const* boxes, std::size_t count);
+
+	/// Returns the smallest axis aligned box containing the box b transformed by the affine matrix m.
+	/// The bottom row of m is ignored.
+	/// @see gtx_aabb
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<3, T, Q> transformBox(mat<4, 4, T, Q> const& m, aabb<3, T, Q> const& b);
+
+	/// Computes out[i] = transformBox(m, in[i]) for i in [0, count), in and out may be the same array.
+	/// @see gtx_aabb
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformBoxes(mat<4, 4, T, Q> const& m, aabb<3, T, Q> const* in, aabb<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = transformBox(m[i], in[i]) for i in [0, count), in and out may be the same array.
+	/// Updates the world space bounds of objects from their local bounds and their model matrices.
+	/// @see gtx_aabb
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformBoxes(mat<4, 4, T, Q> const* m, aabb<3, T, Q> const* in, aabb<3, T, Q>* out, std::size_t count);
+
+	/// Axis aligned box of 2 single-qualifier floating-point dimensions.
+	/// @see gtx_aabb
+	typedef aabb<2, float, defaultp>		aabb2;
+
+	/// Axis aligned box of 3 single-qualifier floating-point dimensions.
+	/// @see gtx_aabb
+	typedef aabb<3, float, defaultp>		aabb3;
+
+	/// Axis aligned box of 2 double-qualifier floating-point dimensions.
+	/// @see gtx_aabb
+	typedef aabb<2, double, defaultp>		daabb2;
+
+	/// Axis aligned box of 3 double-qualifier floating-point dimensions.
+	/// @see gtx_aabb
+	typedef aabb<3, double, defaultp>		daabb3;
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	/// Axis aligned box of 3 single-qualifier floating-point dimensions using SIMD registers.
+	/// @see gtx_aabb
+	typedef aabb<3, float, aligned_highp>	aligned_aabb3;
+#endif
+
+	/// @}
+}//namespace glm
+
+#include "aabb.inl"
@@ -0,0 +1,141 @@
+/// @ref gtx_aabb
+
+namespace glm{
+namespace detail
+{
+	// Transforms the boxes by m[i * matrixStride], a stride of 0 transforms all the boxes by the same matrix
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_aabb_transform
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const* m, std::size_t matrixStride, aabb<3, T, Q> const* in, aabb<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				mat<4, 4, T, Q> const& M = m[i * matrixStride];
+
+				vec<3, T, Q> const Center((in[i].max + in[i].min) * static_cast<T>(0.5));
+				vec<3, T, Q> const Extent((in[i].max - in[i].min) * static_cast<T>(0.5));
+
+				vec<3, T, Q> const X(M[0]);
+				vec<3, T, Q> const Y(M[1]);
+				vec<3, T, Q> const Z(M[2]);
+				vec<3, T, Q> const W(M[3]);
+
+				vec<3, T, Q> const C(X * Center.x + Y * Center.y + Z * Center.z + W);
+				vec<3, T, Q> const E(glm::abs(X) * Extent.x + glm::abs(Y) * Extent.y + glm::abs(Z) * Extent.z);
+
+				out[i] = aabb<3, T, Q>(C - E, C + E);
+			}
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_aabb_merge
+	{
+		GLM_FUNC_QUALIFIER static aabb<L, T, Q> call(aabb<L, T, Q> const* boxes, std::size_t count)
+		{
+			aabb<L, T, Q> Result(boxes[0]);
+			for(std::size_t i = 1; i < count; ++i)
+			{
+				Result.min = glm::min(Result.min, boxes[i].min);
+				Result.max = glm::max(Result.max, boxes[i].max);
+			}
+			return Result;
+		}
+	};
+}//namespace detail
+
+	// -- Implicit basic constructors --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<length_t L, typename T, qualifier Q>
+		GLM_DEFAULTED_FUNC_QUALIFIER GLM_CONSTEXPR aabb<L, T, Q>::aabb()
+		{}
+
+		template<length_t L, typename T, qualifier Q>
+		GLM_DEFAULTED_FUNC_QUALIFIER GLM_CONSTEXPR aabb<L, T, Q>::aabb(aabb<L, T, Q> const& b)
+			: min(b.min), max(b.max)
+		{}
+#	endif
+
+	// -- Explicit basic constructors --
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR aabb<L, T, Q>::aabb(vec_type const& point)
+		: min(point), max(point)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR aabb<L, T, Q>::aabb(vec_type const& minCorner, vec_type const& maxCorner)
+		: min(minCorner), max(maxCorner)
+	{}
+
+	// -- Unary arithmetic operators --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<length_t L, typename T, qualifier Q>
+		GLM_DEFAULTED_FUNC_QUALIFIER aabb<L, T, Q> & aabb<L, T, Q>::operator=(aabb<L, T, Q> const& b)
+		{
+			this->min = b.min;
+			this->max = b.max;
+			return *this;
+		}
+#	endif
+
+	// -- Boolean operators --
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator==(aabb<L, T, Q> const& b1, aabb<L, T, Q> const& b2)
+	{
+		return b1.min == b2.min && b1.max == b2.max;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator!=(aabb<L, T, Q> const& b1, aabb<L, T, Q> const& b2)
+	{
+		return b1.min != b2.min || b1.max != b2.max;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<L, T, Q> merge(aabb<L, T, Q> const& a, aabb<L, T, Q> const& b)
+	{
+		return aabb<L, T, Q>(glm::min(a.min, b.min), glm::max(a.max, b.max));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<L, T, Q> merge(aabb<L, T, Q> const& b, vec<L, T, Q> const& p)
+	{
+		return aabb<L, T, Q>(glm::min(b.min, p), glm::max(b.max, p));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<L, T, Q> mergeBoxes(aabb<L, T, Q> const* boxes, std::size_t count)
+	{
+		assert(count > 0);
+		return detail::compute_aabb_merge<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(boxes, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<3, T, Q> transformBox(mat<4, 4, T, Q> const& m, aabb<3, T, Q> const& b)
+	{
+		aabb<3, T, Q> Result;
+		detail::compute_aabb_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(&m, 0, &b, &Result, 1);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBoxes(mat<4, 4, T, Q> const& m, aabb<3, T, Q> const* in, aabb<3, T, Q>* out, std::size_t count)
+	{
+		detail::compute_aabb_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(&m, 0, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBoxes(mat<4, 4, T, Q> const* m, aabb<3, T, Q> const* in, aabb<3, T, Q>* out, std::size_t count)
+	{
+		detail::compute_aabb_transform<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(m, 1, in, out, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "aabb_simd.inl"
+#endif
@@ -0,0 +1,255 @@
+/// @ref gtx_aabb
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Loads the corners of a box in the lanes x, y and z
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_load(aabb<3, float, Q> const& b, glm_vec4& Min, glm_vec4& Max)
+	{
+		float const* p = &b.min[0];
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			// The 6 values are contiguous, the 2 loads stay inside the box
+			glm_vec4 const Hi = _mm_loadu_ps(p + 2);
+			Min = _mm_loadu_ps(p);
+			Max = _mm_shuffle_ps(Hi, Hi, _MM_SHUFFLE(3, 3, 2, 1));
+		}
+		else
+		{
+			Min = _mm_loadu_ps(p);
+			Max = _mm_loadu_ps(&b.max[0]);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_store(aabb<3, float, Q>& b, glm_vec4 Min, glm_vec4 Max)
+	{
+		float* p = &b.min[0];
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			// (min.x, min.y, min.z, max.x) then (max.y, max.z)
+			glm_vec4 const Mix = _mm_shuffle_ps(Max, Min, _MM_SHUFFLE(2, 2, 0, 0));
+			_mm_storeu_ps(p, _mm_shuffle_ps(Min, Mix, _MM_SHUFFLE(0, 2, 1, 0)));
+			_mm_storel_pi(reinterpret_cast<__m64*>(p + 4), _mm_shuffle_ps(Max, Max, _MM_SHUFFLE(3, 3, 2, 1)));
+		}
+		else
+		{
+			_mm_storeu_ps(p, Min);
+			_mm_storeu_ps(&b.max[0], Max);
+		}
+	}
+
+	// Arvo: the center is transformed by M, the extents by the absolute values of the linear part A of M
+	GLM_FUNC_QUALIFIER void aabb_transform(glm_vec4 const M[4], glm_vec4 const A[3], glm_vec4& Min, glm_vec4& Max)
+	{
+		glm_vec4 const Half = _mm_set1_ps(0.5f);
+		glm_vec4 const Center = _mm_mul_ps(_mm_add_ps(Max, Min), Half);
+		glm_vec4 const Extent = _mm_mul_ps(_mm_sub_ps(Max, Min), Half);
+
+		glm_vec4 C = glm_vec4_fma(M[0], _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0)), M[3]);
+		C = glm_vec4_fma(M[1], _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1)), C);
+		C = glm_vec4_fma(M[2], _mm_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2)), C);
+
+		glm_vec4 E = _mm_mul_ps(A[0], _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0)));
+		E = glm_vec4_fma(A[1], _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1)), E);
+		E = glm_vec4_fma(A[2], _mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2)), E);
+
+		Min = _mm_sub_ps(C, E);
+		Max = _mm_add_ps(C, E);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_load_matrix(mat<4, 4, float, Q> const& m, glm_vec4 M[4], glm_vec4 A[3])
+	{
+		for(length_t c = 0; c < 4; ++c)
+			M[c] = _mm_loadu_ps(&m[c][0]);
+		for(length_t c = 0; c < 3; ++c)
+			A[c] = glm_vec4_abs(M[c]);
+	}
+
+	template<qualifier Q>
+	struct compute_aabb_transform<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const* m, std::size_t matrixStride, aabb<3, float, Q> const* in, aabb<3, float, Q>* out, std::size_t count)
+		{
+			glm_vec4 M[4], A[3];
+			if(matrixStride == 0)
+				aabb_load_matrix(m[0], M, A);
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(matrixStride != 0)
+					aabb_load_matrix(m[i], M, A);
+
+				glm_vec4 Min, Max;
+				aabb_load(in[i], Min, Max);
+				aabb_transform(M, A, Min, Max);
+				aabb_store(out[i], Min, Max);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_aabb_merge<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static aabb<3, float, Q> call(aabb<3, float, Q> const* boxes, std::size_t count)
+		{
+			bool const Packed = sizeof(vec<3, float, Q>) == sizeof(float) * 3;
+
+			// Packed boxes are read as (min.x, min.y, min.z, max.x) and (min.z, max.x, max.y, max.z) without shuffles,
+			// two pairs of accumulators hide the latency of min and max
+			glm_vec4 Min0 = _mm_loadu_ps(&boxes[0].min[0]);
+			glm_vec4 Max0 = Packed ? _mm_loadu_ps(&boxes[0].min[2]) : _mm_loadu_ps(&boxes[0].max[0]);
+			glm_vec4 Min1 = Min0;
+			glm_vec4 Max1 = Max0;
+
+			std::size_t i = 1;
+			for(; i + 2 <= count; i += 2)
+			{
+				Min0 = _mm_min_ps(Min0, _mm_loadu_ps(&boxes[i].min[0]));
+				Min1 = _mm_min_ps(Min1, _mm_loadu_ps(&boxes[i + 1].min[0]));
+				Max0 = _mm_max_ps(Max0, Packed ? _mm_loadu_ps(&boxes[i].min[2]) : _mm_loadu_ps(&boxes[i].max[0]));
+				Max1 = _mm_max_ps(Max1, Packed ? _mm_loadu_ps(&boxes[i + 1].min[2]) : _mm_loadu_ps(&boxes[i + 1].max[0]));
+			}
+			if(i < count)
+			{
+				Min0 = _mm_min_ps(Min0, _mm_loadu_ps(&boxes[i].min[0]));
+				Max0 = _mm_max_ps(Max0, Packed ? _mm_loadu_ps(&boxes[i].min[2]) : _mm_loadu_ps(&boxes[i].max[0]));
+			}
+
+			glm_vec4 Max = _mm_max_ps(Max0, Max1);
+			if(Packed)
+				Max = _mm_shuffle_ps(Max, Max, _MM_SHUFFLE(3, 3, 2, 1));
+
+			aabb<3, float, Q> Result;
+			aabb_store(Result, _mm_min_ps(Min0, Min1), Max);
+			return Result;
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_load(aabb<3, float, Q> const& b, float32x4_t& Min, float32x4_t& Max)
+	{
+		float const* p = &b.min[0];
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			// The 6 values are contiguous, the 2 loads stay inside the box
+			float32x4_t const Hi = vld1q_f32(p + 2);
+			Min = vld1q_f32(p);
+			Max = vextq_f32(Hi, Hi, 1);
+		}
+		else
+		{
+			Min = vld1q_f32(p);
+			Max = vld1q_f32(&b.max[0]);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_store(aabb<3, float, Q>& b, float32x4_t Min, float32x4_t Max)
+	{
+		float* p = &b.min[0];
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			// (min.x, min.y, min.z, max.x) then (max.y, max.z)
+			vst1q_f32(p, vcopyq_laneq_f32(Min, 3, Max, 0));
+			vst1_f32(p + 4, vget_low_f32(vextq_f32(Max, Max, 1)));
+		}
+		else
+		{
+			vst1q_f32(p, Min);
+			vst1q_f32(&b.max[0], Max);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void aabb_transform(float32x4_t const M[4], float32x4_t const A[3], float32x4_t& Min, float32x4_t& Max)
+	{
+		float32x4_t const Center = vmulq_n_f32(vaddq_f32(Max, Min), 0.5f);
+		float32x4_t const Extent = vmulq_n_f32(vsubq_f32(Max, Min), 0.5f);
+
+		float32x4_t C = vfmaq_laneq_f32(M[3], M[0], Center, 0);
+		C = vfmaq_laneq_f32(C, M[1], Center, 1);
+		C = vfmaq_laneq_f32(C, M[2], Center, 2);
+
+		float32x4_t E = vmulq_laneq_f32(A[0], Extent, 0);
+		E = vfmaq_laneq_f32(E, A[1], Extent, 1);
+		E = vfmaq_laneq_f32(E, A[2], Extent, 2);
+
+		Min = vsubq_f32(C, E);
+		Max = vaddq_f32(C, E);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_load_matrix(mat<4, 4, float, Q> const& m, float32x4_t M[4], float32x4_t A[3])
+	{
+		for(length_t c = 0; c < 4; ++c)
+			M[c] = vld1q_f32(&m[c][0]);
+		for(length_t c = 0; c < 3; ++c)
+			A[c] = vabsq_f32(M[c]);
+	}
+
+	template<qualifier Q>
+	struct compute_aabb_transform<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const* m, std::size_t matrixStride, aabb<3, float, Q> const* in, aabb<3, float, Q>* out, std::size_t count)
+		{
+			float32x4_t M[4], A[3];
+			if(matrixStride == 0)
+				aabb_load_matrix(m[0], M, A);
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(matrixStride != 0)
+					aabb_load_matrix(m[i], M, A);
+
+				float32x4_t Min, Max;
+				aabb_load(in[i], Min, Max);
+				aabb_transform(M, A, Min, Max);
+				aabb_store(out[i], Min, Max);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_aabb_merge<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static aabb<3, float, Q> call(aabb<3, float, Q> const* boxes, std::size_t count)
+		{
+			bool const Packed = sizeof(vec<3, float, Q>) == sizeof(float) * 3;
+
+			float32x4_t Min0 = vld1q_f32(&boxes[0].min[0]);
+			float32x4_t Max0 = vld1q_f32(Packed ? &boxes[0].min[2] : &boxes[0].max[0]);
+			float32x4_t Min1 = Min0;
+			float32x4_t Max1 = Max0;
+
+			std::size_t i = 1;
+			for(; i + 2 <= count; i += 2)
+			{
+				Min0 = vminq_f32(Min0, vld1q_f32(&boxes[i].min[0]));
+				Min1 = vminq_f32(Min1, vld1q_f32(&boxes[i + 1].min[0]));
+				Max0 = vmaxq_f32(Max0, vld1q_f32(Packed ? &boxes[i].min[2] : &boxes[i].max[0]));
+				Max1 = vmaxq_f32(Max1, vld1q_f32(Packed ? &boxes[i + 1].min[2] : &boxes[i + 1].max[0]));
+			}
+			if(i < count)
+			{
+				Min0 = vminq_f32(Min0, vld1q_f32(&boxes[i].min[0]));
+				Max0 = vmaxq_f32(Max0, vld1q_f32(Packed ? &boxes[i].min[2] : &boxes[i].max[0]));
+			}
+
+			float32x4_t Max = vmaxq_f32(Max0, Max1);
+			if(Packed)
+				Max = vextq_f32(Max, Max, 1);
+
+			aabb<3, float, Q> Result;
+			aabb_store(Result, vminq_f32(Min0, Min1), Max);
+			return Result;
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
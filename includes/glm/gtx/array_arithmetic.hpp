@@ -0,0 +1,58 @@
+/// @ref gtx_array_arithmetic
+/// @file glm/gtx/array_arithmetic.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_array_arithmetic GLM_GTX_array_arithmetic
+/// @ingroup gtx
+///
+/// Include <glm/gtx/array_arithmetic.hpp> to use the features of this extension.
+///
+/// Component-wise arithmetic over contiguous arrays of vectors.
+/// With AVX, arrays of vec4 are processed two vectors per 256-bit instruction.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_array_arithmetic is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_array_arithmetic extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_array_arithmetic
+	/// @{
+
+	/// Computes result[i] = a[i] + b[i] for i in [0, count).
+	/// result may be the same array as a or b but must not partially overlap them.
+	/// @see gtx_array_arithmetic
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void addArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count);
+
+	/// Computes result[i] = a[i] - b[i] for i in [0, count).
+	/// result may be the same array as a or b but must not partially overlap them.
+	/// @see gtx_array_arithmetic
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void subArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count);
+
+	/// Computes result[i] = a[i] * b[i] for i in [0, count).
+	/// result may be the same array as a or b but must not partially overlap them.
+	/// @see gtx_array_arithmetic
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mulArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count);
+
+	/// Computes result[i] = a[i] / b[i] for i in [0, count).
+	/// result may be the same array as a or b but must not partially overlap them.
+	/// @see gtx_array_arithmetic
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void divArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "array_arithmetic.inl"
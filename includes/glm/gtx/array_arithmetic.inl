@@ -0,0 +1,74 @@
+/// @ref gtx_array_arithmetic
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q>
+	struct compute_array_add
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				result[i] = a[i] + b[i];
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_array_sub
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				result[i] = a[i] - b[i];
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_array_mul
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				result[i] = a[i] * b[i];
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q>
+	struct compute_array_div
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				result[i] = a[i] / b[i];
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void addArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+	{
+		detail::compute_array_add<L, T, Q>::call(a, b, result, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void subArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+	{
+		detail::compute_array_sub<L, T, Q>::call(a, b, result, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+	{
+		detail::compute_array_mul<L, T, Q>::call(a, b, result, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void divArray(vec<L, T, Q> const* a, vec<L, T, Q> const* b, vec<L, T, Q>* result, std::size_t count)
+	{
+		detail::compute_array_div<L, T, Q>::call(a, b, result, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "array_arithmetic_simd.inl"
+#endif
@@ -0,0 +1,120 @@
+/// @ref gtx_array_arithmetic
+
+#include "../simd/common.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	struct array_op_add
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_add(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_add(a, b);}
+#		endif
+	};
+
+	struct array_op_sub
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_sub(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_sub(a, b);}
+#		endif
+	};
+
+	struct array_op_mul
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_mul(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_mul(a, b);}
+#		endif
+	};
+
+	struct array_op_div
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_div(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_div(a, b);}
+#		endif
+	};
+
+	// vec4 arrays are contiguous runs of floats whatever the qualifier, so unaligned loads let
+	// packed and aligned types share the same kernel: 4 vectors per iteration, then the remainder.
+	template<typename op>
+	GLM_FUNC_QUALIFIER void compute_array_vec4(float const* a, float const* b, float* result, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec8 const a0 = _mm256_loadu_ps(a + i * 4);
+				glm_vec8 const a1 = _mm256_loadu_ps(a + i * 4 + 8);
+				glm_vec8 const b0 = _mm256_loadu_ps(b + i * 4);
+				glm_vec8 const b1 = _mm256_loadu_ps(b + i * 4 + 8);
+				_mm256_storeu_ps(result + i * 4, op::call(a0, b0));
+				_mm256_storeu_ps(result + i * 4 + 8, op::call(a1, b1));
+			}
+			if(i + 2 <= count)
+			{
+				_mm256_storeu_ps(result + i * 4, op::call(_mm256_loadu_ps(a + i * 4), _mm256_loadu_ps(b + i * 4)));
+				i += 2;
+			}
+#		else
+			for(; i + 2 <= count; i += 2)
+			{
+				glm_vec4 const a0 = _mm_loadu_ps(a + i * 4);
+				glm_vec4 const a1 = _mm_loadu_ps(a + i * 4 + 4);
+				glm_vec4 const b0 = _mm_loadu_ps(b + i * 4);
+				glm_vec4 const b1 = _mm_loadu_ps(b + i * 4 + 4);
+				_mm_storeu_ps(result + i * 4, op::call(a0, b0));
+				_mm_storeu_ps(result + i * 4 + 4, op::call(a1, b1));
+			}
+#		endif
+		if(i < count)
+			_mm_storeu_ps(result + i * 4, op::call(_mm_loadu_ps(a + i * 4), _mm_loadu_ps(b + i * 4)));
+	}
+
+	template<qualifier Q>
+	struct compute_array_add<4, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* a, vec<4, float, Q> const* b, vec<4, float, Q>* result, std::size_t count)
+		{
+			if(count > 0)
+				compute_array_vec4<array_op_add>(&a[0].x, &b[0].x, &result[0].x, count);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_array_sub<4, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* a, vec<4, float, Q> const* b, vec<4, float, Q>* result, std::size_t count)
+		{
+			if(count > 0)
+				compute_array_vec4<array_op_sub>(&a[0].x, &b[0].x, &result[0].x, count);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_array_mul<4, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* a, vec<4, float, Q> const* b, vec<4, float, Q>* result, std::size_t count)
+		{
+			if(count > 0)
+				compute_array_vec4<array_op_mul>(&a[0].x, &b[0].x, &result[0].x, count);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_array_div<4, float, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* a, vec<4, float, Q> const* b, vec<4, float, Q>* result, std::size_t count)
+		{
+			if(count > 0)
+				compute_array_vec4<array_op_div>(&a[0].x, &b[0].x, &result[0].x, count);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
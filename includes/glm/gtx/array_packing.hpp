@@ -0,0 +1,260 @@
+/// @ref gtx_array_packing
+/// @file glm/gtx/array_packing.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_array_packing GLM_GTX_array_packing
+/// @ingroup gtx
+///
+/// Include <glm/gtx/array_packing.hpp> to use the features of this extension.
+///
+/// Packing and unpacking of contiguous arrays of vectors with the core packing functions,
+/// conversion of float arrays to and from half precision, interleaving of the bits of arrays of integer vectors,
+/// and compression of vertex attributes with the octahedral, QTangent and position encodings of gtc_packing.
+/// Each element gives the same result as the matching single value function, except that the octahedral, QTangent and position decoders
+/// may differ by a rounding error when the compiler contracts the multiply-adds of the single value functions.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtc/packing.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_array_packing is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_array_packing extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_array_packing
+	/// @{
+
+	/// Computes p[i] = packUnorm2x16(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packUnorm2x16(vec2 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packUnorm2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count);
+
+	/// Computes v[i] = unpackUnorm2x16(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackUnorm2x16(uint)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackUnorm2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packSnorm2x16(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packSnorm2x16(vec2 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packSnorm2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count);
+
+	/// Computes v[i] = unpackSnorm2x16(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackSnorm2x16(uint)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackSnorm2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packUnorm4x8(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packUnorm4x8(vec4 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packUnorm4x8Array(vec<4, float, Q> const* v, uint* p, std::size_t count);
+
+	/// Computes v[i] = unpackUnorm4x8(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackUnorm4x8(uint)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackUnorm4x8Array(uint const* p, vec<4, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packSnorm4x8(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packSnorm4x8(vec4 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packSnorm4x8Array(vec<4, float, Q> const* v, uint* p, std::size_t count);
+
+	/// Computes v[i] = unpackSnorm4x8(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackSnorm4x8(uint)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackSnorm4x8Array(uint const* p, vec<4, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packHalf2x16(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packHalf2x16(vec2 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packHalf2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count);
+
+	/// Computes v[i] = unpackHalf2x16(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackHalf2x16(uint)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackHalf2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count);
+
+	/// Converts count single precision values to half precision, rounding to nearest even.
+	/// Uses F16C or NEON conversions when available, the scalar fallback gives bit-identical results.
+	/// @see gtx_array_packing
+	GLM_FUNC_DISCARD_DECL void convertFloatToHalf(float const* f, uint16* h, std::size_t count);
+
+	/// Converts count half precision values to single precision, exactly.
+	/// @see gtx_array_packing
+	GLM_FUNC_DISCARD_DECL void convertHalfToFloat(uint16 const* h, float* f, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint8, uint8)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<2, uint8, Q> const* v, uint16* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint16, uint16)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<2, uint16, Q> const* v, uint32* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint32, uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<2, uint32, Q> const* v, uint64* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y, v[i].z) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint8, uint8, uint8)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<3, uint8, Q> const* v, uint32* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y, v[i].z) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint16, uint16, uint16)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<3, uint16, Q> const* v, uint64* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y, v[i].z) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint32, uint32, uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<3, uint32, Q> const* v, uint64* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y, v[i].z, v[i].w) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint8, uint8, uint8, uint8)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<4, uint8, Q> const* v, uint32* p, std::size_t count);
+
+	/// Computes p[i] = bitfieldInterleave(v[i].x, v[i].y, v[i].z, v[i].w) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldInterleave(uint16, uint16, uint16, uint16)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleaveArray(vec<4, uint16, Q> const* v, uint64* p, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave(uint16)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint16 const* p, vec<2, uint8, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave(uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint32 const* p, vec<2, uint16, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave(uint64)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint64 const* p, vec<2, uint32, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave3(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave3(uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint32 const* p, vec<3, uint16, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave3(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave3(uint64)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint64 const* p, vec<3, uint32, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave4(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave4(uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint32 const* p, vec<4, uint8, Q>* v, std::size_t count);
+
+	/// Computes v[i] = bitfieldDeinterleave4(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see bitfieldDeinterleave4(uint64)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleaveArray(uint64 const* p, vec<4, uint16, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packOct16(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packOct16(vec3 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packOct16Array(vec<3, float, Q> const* v, uint16* p, std::size_t count);
+
+	/// Computes v[i] = unpackOct16(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackOct16(uint16)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackOct16Array(uint16 const* p, vec<3, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packOct24(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packOct24(vec3 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packOct24Array(vec<3, float, Q> const* v, uint32* p, std::size_t count);
+
+	/// Computes v[i] = unpackOct24(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackOct24(uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackOct24Array(uint32 const* p, vec<3, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packOct32(v[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packOct32(vec3 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packOct32Array(vec<3, float, Q> const* v, uint32* p, std::size_t count);
+
+	/// Computes v[i] = unpackOct32(p[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackOct32(uint32)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackOct32Array(uint32 const* p, vec<3, float, Q>* v, std::size_t count);
+
+	/// Computes p[i] = packQTangent(normals[i], tangents[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packQTangent(vec3 const&, vec4 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packQTangentArray(vec<3, float, Q> const* normals, vec<4, float, Q> const* tangents, uint64* p, std::size_t count);
+
+	/// Computes unpackQTangent(p[i], normals[i], tangents[i]) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackQTangent(uint64, vec3&, vec4&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackQTangentArray(uint64 const* p, vec<3, float, Q>* normals, vec<4, float, Q>* tangents, std::size_t count);
+
+	/// Computes p[i] = packPosition3x16(v[i], minBounds, maxBounds) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see packPosition3x16(vec3 const&, vec3 const&, vec3 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void packPosition3x16Array(
+		vec<3, float, Q> const* v, vec<3, float, Q> const& minBounds, vec<3, float, Q> const& maxBounds, vec<3, uint16, Q>* p, std::size_t count);
+
+	/// Computes v[i] = unpackPosition3x16(p[i], minBounds, maxBounds) for i in [0, count).
+	/// @see gtx_array_packing
+	/// @see unpackPosition3x16(u16vec3 const&, vec3 const&, vec3 const&)
+	template<qualifier Q>
+	GLM_FUNC_DISCARD_DECL void unpackPosition3x16Array(
+		vec<3, uint16, Q> const* p, vec<3, float, Q> const& minBounds, vec<3, float, Q> const& maxBounds, vec<3, float, Q>* v, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "array_packing.inl"
@@ -0,0 +1,488 @@
+/// @ref gtx_array_packing
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q, bool UseSimd>
+	struct compute_packUnorm2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = packUnorm2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackUnorm2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackUnorm2x16(p[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_packSnorm2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = packSnorm2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackSnorm2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackSnorm2x16(p[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_packUnorm4x8Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* v, uint* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = packUnorm4x8(vec<4, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackUnorm4x8Array
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<4, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<4, float, Q>(unpackUnorm4x8(p[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_packSnorm4x8Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* v, uint* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = packSnorm4x8(vec<4, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackSnorm4x8Array
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<4, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<4, float, Q>(unpackSnorm4x8(p[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_packHalf2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = packHalf2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackHalf2x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackHalf2x16(p[i]));
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_convertFloatToHalf
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* f, uint16* h, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				h[i] = static_cast<uint16>(toFloat16(f[i]));
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_convertHalfToFloat
+	{
+		GLM_FUNC_QUALIFIER static void call(uint16 const* h, float* f, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				f[i] = toFloat32(static_cast<hdata>(h[i]));
+		}
+	};
+
+	template<length_t L>
+	struct compute_bitfieldInterleave{};
+
+	template<>
+	struct compute_bitfieldInterleave<2>
+	{
+		template<typename T, qualifier Q, typename genUType>
+		GLM_FUNC_QUALIFIER static void call(vec<2, T, Q> const& v, genUType& p)
+		{
+			p = glm::bitfieldInterleave(v.x, v.y);
+		}
+
+		template<typename genUType, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(genUType p, vec<2, T, Q>& v)
+		{
+			v = vec<2, T, Q>(glm::bitfieldDeinterleave(p));
+		}
+	};
+
+	template<>
+	struct compute_bitfieldInterleave<3>
+	{
+		template<typename T, qualifier Q, typename genUType>
+		GLM_FUNC_QUALIFIER static void call(vec<3, T, Q> const& v, genUType& p)
+		{
+			p = glm::bitfieldInterleave(v.x, v.y, v.z);
+		}
+
+		template<typename genUType, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(genUType p, vec<3, T, Q>& v)
+		{
+			v = vec<3, T, Q>(glm::bitfieldDeinterleave3(p));
+		}
+	};
+
+	template<>
+	struct compute_bitfieldInterleave<4>
+	{
+		template<typename T, qualifier Q, typename genUType>
+		GLM_FUNC_QUALIFIER static void call(vec<4, T, Q> const& v, genUType& p)
+		{
+			p = glm::bitfieldInterleave(v.x, v.y, v.z, v.w);
+		}
+
+		template<typename genUType, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static void call(genUType p, vec<4, T, Q>& v)
+		{
+			v = vec<4, T, Q>(glm::bitfieldDeinterleave4(p));
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, typename genUType, bool UseSimd>
+	struct compute_bitfieldInterleaveArray
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* v, genUType* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				compute_bitfieldInterleave<L>::call(v[i], p[i]);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, typename genUType, bool UseSimd>
+	struct compute_bitfieldDeinterleaveArray
+	{
+		GLM_FUNC_QUALIFIER static void call(genUType const* p, vec<L, T, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				compute_bitfieldInterleave<L>::call(p[i], v[i]);
+		}
+	};
+
+	template<int Bits, qualifier Q, bool UseSimd>
+	struct compute_packOctArray
+	{
+		template<typename genUType>
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* v, genUType* p, std::size_t count, float Scale)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = static_cast<genUType>(packOct(vec3(v[i]), Scale, Bits));
+		}
+	};
+
+	template<int Bits, qualifier Q, bool UseSimd>
+	struct compute_unpackOctArray
+	{
+		template<typename genUType>
+		GLM_FUNC_QUALIFIER static void call(genUType const* p, vec<3, float, Q>* v, std::size_t count, float InvScale)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<3, float, Q>(unpackOct(p[i], InvScale, Bits));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackQTangentArray
+	{
+		GLM_FUNC_QUALIFIER static void call(uint64 const* p, vec<3, float, Q>* normals, vec<4, float, Q>* tangents, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec3 Normal;
+				vec4 Tangent;
+				unpackQTangent(p[i], Normal, Tangent);
+				normals[i] = vec<3, float, Q>(Normal);
+				tangents[i] = vec<4, float, Q>(Tangent);
+			}
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_packPosition3x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* v, vec3 const& minBounds, vec3 const& maxBounds, vec<3, uint16, Q>* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				p[i] = vec<3, uint16, Q>(packPosition3x16(vec3(v[i]), minBounds, maxBounds));
+		}
+	};
+
+	template<qualifier Q, bool UseSimd>
+	struct compute_unpackPosition3x16Array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, uint16, Q> const* p, vec3 const& minBounds, vec3 const& maxBounds, vec<3, float, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				v[i] = vec<3, float, Q>(unpackPosition3x16(u16vec3(p[i]), minBounds, maxBounds));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+// The SIMD specializations have to be declared before the non-template functions below instantiate them
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "array_packing_simd.inl"
+#endif
+
+namespace glm
+{
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packUnorm2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count)
+	{
+		detail::compute_packUnorm2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackUnorm2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackUnorm2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packSnorm2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count)
+	{
+		detail::compute_packSnorm2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSnorm2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackSnorm2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packUnorm4x8Array(vec<4, float, Q> const* v, uint* p, std::size_t count)
+	{
+		detail::compute_packUnorm4x8Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackUnorm4x8Array(uint const* p, vec<4, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackUnorm4x8Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packSnorm4x8Array(vec<4, float, Q> const* v, uint* p, std::size_t count)
+	{
+		detail::compute_packSnorm4x8Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackSnorm4x8Array(uint const* p, vec<4, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackSnorm4x8Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packHalf2x16Array(vec<2, float, Q> const* v, uint* p, std::size_t count)
+	{
+		detail::compute_packHalf2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackHalf2x16Array(uint const* p, vec<2, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackHalf2x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertFloatToHalf(float const* f, uint16* h, std::size_t count)
+	{
+		detail::compute_convertFloatToHalf<GLM_CONFIG_SIMD == GLM_ENABLE>::call(f, h, count);
+	}
+
+	GLM_FUNC_QUALIFIER void convertHalfToFloat(uint16 const* h, float* f, std::size_t count)
+	{
+		detail::compute_convertHalfToFloat<GLM_CONFIG_SIMD == GLM_ENABLE>::call(h, f, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<2, uint8, Q> const* v, uint16* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<2, uint8, Q, uint16, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<2, uint16, Q> const* v, uint32* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<2, uint16, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<2, uint32, Q> const* v, uint64* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<2, uint32, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<3, uint8, Q> const* v, uint32* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<3, uint8, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<3, uint16, Q> const* v, uint64* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<3, uint16, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<3, uint32, Q> const* v, uint64* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<3, uint32, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<4, uint8, Q> const* v, uint32* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<4, uint8, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(vec<4, uint16, Q> const* v, uint64* p, std::size_t count)
+	{
+		detail::compute_bitfieldInterleaveArray<4, uint16, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint16 const* p, vec<2, uint8, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<2, uint8, Q, uint16, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint32 const* p, vec<2, uint16, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<2, uint16, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint64 const* p, vec<2, uint32, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<2, uint32, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint32 const* p, vec<3, uint16, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<3, uint16, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint64 const* p, vec<3, uint32, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<3, uint32, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint32 const* p, vec<4, uint8, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<4, uint8, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint64 const* p, vec<4, uint16, Q>* v, std::size_t count)
+	{
+		detail::compute_bitfieldDeinterleaveArray<4, uint16, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packOct16Array(vec<3, float, Q> const* v, uint16* p, std::size_t count)
+	{
+		detail::compute_packOctArray<8, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count, 127.0f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackOct16Array(uint16 const* p, vec<3, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackOctArray<8, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count, 0.0078740157480315f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packOct24Array(vec<3, float, Q> const* v, uint32* p, std::size_t count)
+	{
+		detail::compute_packOctArray<12, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count, 2047.0f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackOct24Array(uint32 const* p, vec<3, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackOctArray<12, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count, 4.8851978505129457743038593063019e-4f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packOct32Array(vec<3, float, Q> const* v, uint32* p, std::size_t count)
+	{
+		detail::compute_packOctArray<16, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, p, count, 32767.0f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackOct32Array(uint32 const* p, vec<3, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackOctArray<16, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, v, count, 3.0518509475997192297128208258309e-5f);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packQTangentArray(vec<3, float, Q> const* normals, vec<4, float, Q> const* tangents, uint64* p, std::size_t count)
+	{
+		// Bound by the branches of the quaternion extraction, the frames are packed one at a time
+		for(std::size_t i = 0; i < count; ++i)
+			p[i] = packQTangent(vec3(normals[i]), vec4(tangents[i]));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackQTangentArray(uint64 const* p, vec<3, float, Q>* normals, vec<4, float, Q>* tangents, std::size_t count)
+	{
+		detail::compute_unpackQTangentArray<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, normals, tangents, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void packPosition3x16Array(
+		vec<3, float, Q> const* v, vec<3, float, Q> const& minBounds, vec<3, float, Q> const& maxBounds, vec<3, uint16, Q>* p, std::size_t count)
+	{
+		detail::compute_packPosition3x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(v, vec3(minBounds), vec3(maxBounds), p, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void unpackPosition3x16Array(
+		vec<3, uint16, Q> const* p, vec<3, float, Q> const& minBounds, vec<3, float, Q> const& maxBounds, vec<3, float, Q>* v, std::size_t count)
+	{
+		detail::compute_unpackPosition3x16Array<Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, vec3(minBounds), vec3(maxBounds), v, count);
+	}
+}//namespace glm
@@ -0,0 +1,849 @@
+/// @ref gtx_array_packing
+
+#include "../simd/packing.h"
+#include "../simd/integer.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Arrays of vec2 and vec4 are contiguous runs of floats whatever the qualifier, so unaligned loads let
+	// packed and aligned types share the same kernels: 4 vectors per iteration, then the core function on the remainder.
+	GLM_FUNC_QUALIFIER std::size_t compute_packUnorm2x16Array4(float const* v, uint* p, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(65535.0f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const a = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 2), scale);
+			glm_ivec4 const b = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 2 + 4), scale);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), glm_ivec4_packus_epi32(a, b));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_unpackUnorm2x16Array4(uint const* p, float* v, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(1.5259021896696421759365224689097e-5f);
+		glm_ivec4 const zero = _mm_setzero_si128();
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+			_mm_storeu_ps(v + i * 2, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpacklo_epi16(x, zero)), scale));
+			_mm_storeu_ps(v + i * 2 + 4, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpackhi_epi16(x, zero)), scale));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_packSnorm2x16Array4(float const* v, uint* p, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(32767.0f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const a = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 2), scale);
+			glm_ivec4 const b = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 2 + 4), scale);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), _mm_packs_epi32(a, b));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_unpackSnorm2x16Array4(uint const* p, float* v, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(3.0518509475997192297128208258309e-5f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+			_mm_storeu_ps(v + i * 2, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16), scale));
+			_mm_storeu_ps(v + i * 2 + 4, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16), scale));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_packUnorm4x8Array4(float const* v, uint* p, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(255.0f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const a = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 4), scale);
+			glm_ivec4 const b = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 4 + 4), scale);
+			glm_ivec4 const c = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 4 + 8), scale);
+			glm_ivec4 const d = glm_vec4_to_unorm(_mm_loadu_ps(v + i * 4 + 12), scale);
+			glm_ivec4 const x = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), x);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_unpackUnorm4x8Array4(uint const* p, float* v, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(0.0039215686274509803921568627451f);
+		glm_ivec4 const zero = _mm_setzero_si128();
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+			glm_ivec4 const lo = _mm_unpacklo_epi8(x, zero);
+			glm_ivec4 const hi = _mm_unpackhi_epi8(x, zero);
+			_mm_storeu_ps(v + i * 4, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+			_mm_storeu_ps(v + i * 4 + 4, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+			_mm_storeu_ps(v + i * 4 + 8, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+			_mm_storeu_ps(v + i * 4 + 12, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_packSnorm4x8Array4(float const* v, uint* p, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(127.0f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const a = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 4), scale);
+			glm_ivec4 const b = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 4 + 4), scale);
+			glm_ivec4 const c = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 4 + 8), scale);
+			glm_ivec4 const d = glm_vec4_to_snorm(_mm_loadu_ps(v + i * 4 + 12), scale);
+			glm_ivec4 const x = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), x);
+		}
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_unpackSnorm4x8Array4(uint const* p, float* v, std::size_t count)
+	{
+		glm_vec4 const scale = _mm_set1_ps(0.0078740157480315f);
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_ivec4 const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+			glm_ivec4 const lo = _mm_unpacklo_epi8(x, x);
+			glm_ivec4 const hi = _mm_unpackhi_epi8(x, x);
+			_mm_storeu_ps(v + i * 4, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 24), scale));
+			_mm_storeu_ps(v + i * 4 + 4, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 24), scale));
+			_mm_storeu_ps(v + i * 4 + 8, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 24), scale));
+			_mm_storeu_ps(v + i * 4 + 12, glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 24), scale));
+		}
+		return i;
+	}
+
+	// Half conversions take 8 floats at a time, the layout of 4 vec2 or of a float array
+	GLM_FUNC_QUALIFIER glm_ivec4 compute_toHalf8(float const* f)
+	{
+#		if GLM_HAS_F16C
+			return _mm256_cvtps_ph(_mm256_loadu_ps(f), _MM_FROUND_TO_NEAREST_INT);
+#		else
+			return glm_ivec4_packus_epi32(glm_vec4_to_half(_mm_loadu_ps(f)), glm_vec4_to_half(_mm_loadu_ps(f + 4)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void compute_fromHalf8(glm_ivec4 h, float* f)
+	{
+#		if GLM_HAS_F16C
+			_mm256_storeu_ps(f, _mm256_cvtph_ps(h));
+#		else
+			glm_ivec4 const zero = _mm_setzero_si128();
+			_mm_storeu_ps(f, glm_vec4_from_half(_mm_unpacklo_epi16(h, zero)));
+			_mm_storeu_ps(f + 4, glm_vec4_from_half(_mm_unpackhi_epi16(h, zero)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_packHalf2x16Array4(float const* v, uint* p, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p + i), compute_toHalf8(v + i * 2));
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t compute_unpackHalf2x16Array4(uint const* p, float* v, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+			compute_fromHalf8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), v + i * 2);
+		return i;
+	}
+
+	template<qualifier Q>
+	struct compute_packUnorm2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_packUnorm2x16Array4(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = packUnorm2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackUnorm2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_unpackUnorm2x16Array4(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackUnorm2x16(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_packSnorm2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_packSnorm2x16Array4(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = packSnorm2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackSnorm2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_unpackSnorm2x16Array4(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackSnorm2x16(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_packUnorm4x8Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* v, uint* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_packUnorm4x8Array4(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = packUnorm4x8(vec<4, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackUnorm4x8Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<4, float, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_unpackUnorm4x8Array4(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<4, float, Q>(unpackUnorm4x8(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_packSnorm4x8Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const* v, uint* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_packSnorm4x8Array4(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = packSnorm4x8(vec<4, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackSnorm4x8Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<4, float, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_unpackSnorm4x8Array4(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<4, float, Q>(unpackSnorm4x8(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_packHalf2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* v, uint* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_packHalf2x16Array4(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = packHalf2x16(vec<2, float, defaultp>(v[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackHalf2x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint const* p, vec<2, float, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_unpackHalf2x16Array4(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<2, float, Q>(unpackHalf2x16(p[i]));
+		}
+	};
+
+	template<>
+	struct compute_convertFloatToHalf<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* f, uint16* h, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 16 <= count; i += 16)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(h + i), compute_toHalf8(f + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(h + i + 8), compute_toHalf8(f + i + 8));
+			}
+			for(; i + 8 <= count; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(h + i), compute_toHalf8(f + i));
+			for(; i < count; ++i)
+				h[i] = static_cast<uint16>(toFloat16(f[i]));
+		}
+	};
+
+	template<>
+	struct compute_convertHalfToFloat<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint16 const* h, float* f, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 16 <= count; i += 16)
+			{
+				compute_fromHalf8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(h + i)), f + i);
+				compute_fromHalf8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(h + i + 8)), f + i + 8);
+			}
+			for(; i + 8 <= count; i += 8)
+				compute_fromHalf8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(h + i)), f + i);
+			for(; i < count; ++i)
+				f[i] = toFloat32(static_cast<hdata>(h[i]));
+		}
+	};
+
+	// A vector of 2 uint16 or of 4 uint8 fills a 32 bits lane, so interleaving its bits is one or two outer perfect shuffles of the lane.
+	template<int Passes>
+	GLM_FUNC_QUALIFIER std::size_t compute_bitfieldShuffleArray4(void const* in, void* out, std::size_t count)
+	{
+		char const* Src = static_cast<char const*>(in);
+		char* Dst = static_cast<char*>(out);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i * 4));
+				for(int Pass = 0; Pass < Passes; ++Pass)
+					x = glm_i256_shuffle(x);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i * 4), x);
+			}
+#		endif
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_uvec4 x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i * 4));
+			for(int Pass = 0; Pass < Passes; ++Pass)
+				x = glm_i128_shuffle(x);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i * 4), x);
+		}
+		return i;
+	}
+
+	template<int Passes>
+	GLM_FUNC_QUALIFIER std::size_t compute_bitfieldUnshuffleArray4(void const* in, void* out, std::size_t count)
+	{
+		char const* Src = static_cast<char const*>(in);
+		char* Dst = static_cast<char*>(out);
+		std::size_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Src + i * 4));
+				for(int Pass = 0; Pass < Passes; ++Pass)
+					x = glm_i256_unshuffle(x);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dst + i * 4), x);
+			}
+#		endif
+		for(; i + 4 <= count; i += 4)
+		{
+			glm_uvec4 x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + i * 4));
+			for(int Pass = 0; Pass < Passes; ++Pass)
+				x = glm_i128_unshuffle(x);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + i * 4), x);
+		}
+		return i;
+	}
+
+	template<qualifier Q>
+	struct compute_bitfieldInterleaveArray<2, uint16, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, uint16, Q> const* v, uint32* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldShuffleArray4<1>(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = glm::bitfieldInterleave(v[i].x, v[i].y);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldDeinterleaveArray<2, uint16, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const* p, vec<2, uint16, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldUnshuffleArray4<1>(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<2, uint16, Q>(glm::bitfieldDeinterleave(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldInterleaveArray<4, uint8, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, uint8, Q> const* v, uint32* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldShuffleArray4<2>(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = glm::bitfieldInterleave(v[i].x, v[i].y, v[i].z, v[i].w);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldDeinterleaveArray<4, uint8, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const* p, vec<4, uint8, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldUnshuffleArray4<2>(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<4, uint8, Q>(glm::bitfieldDeinterleave4(p[i]));
+		}
+	};
+
+	// Loads 4 vec3 as the vectors of their x, y and z components, from arrays of packed or aligned vec3
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void compute_loadVec3x4(vec<3, float, Q> const* v, glm_vec4& x, glm_vec4& y, glm_vec4& z)
+	{
+		if(sizeof(vec<3, float, Q>) == 4 * sizeof(float))
+		{
+			glm_vec4 a = _mm_loadu_ps(&v[0].x);
+			glm_vec4 b = _mm_loadu_ps(&v[1].x);
+			glm_vec4 c = _mm_loadu_ps(&v[2].x);
+			glm_vec4 d = _mm_loadu_ps(&v[3].x);
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			x = a;
+			y = b;
+			z = c;
+		}
+		else
+		{
+			// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+			glm_vec4 const a = _mm_loadu_ps(&v[0].x);
+			glm_vec4 const b = _mm_loadu_ps(&v[0].x + 4);
+			glm_vec4 const c = _mm_loadu_ps(&v[0].x + 8);
+			x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 0, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 1, 0, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void compute_storeVec3x4(vec<3, float, Q>* v, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+	{
+		if(sizeof(vec<3, float, Q>) == 4 * sizeof(float))
+		{
+			glm_vec4 w = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(&v[0].x, x);
+			_mm_storeu_ps(&v[1].x, y);
+			_mm_storeu_ps(&v[2].x, z);
+			_mm_storeu_ps(&v[3].x, w);
+		}
+		else
+		{
+			glm_vec4 const xy = _mm_unpacklo_ps(x, y);
+			glm_vec4 const yz = _mm_unpacklo_ps(y, z);
+			glm_vec4 const xyHigh = _mm_unpackhi_ps(x, y);
+			_mm_storeu_ps(&v[0].x, _mm_shuffle_ps(xy, _mm_shuffle_ps(z, x, _MM_SHUFFLE(0, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(&v[0].x + 4, _mm_shuffle_ps(yz, xyHigh, _MM_SHUFFLE(1, 0, 3, 2)));
+			_mm_storeu_ps(&v[0].x + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+	}
+
+	// Same computations as packOct and unpackOct, 4 unit vectors at a time
+	template<int Bits>
+	GLM_FUNC_QUALIFIER glm_ivec4 compute_packOct4(glm_vec4 x, glm_vec4 y, glm_vec4 z, glm_vec4 Scale)
+	{
+		glm_vec4 const Zero = _mm_setzero_ps();
+		glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+
+		glm_vec4 const Sum = glm_vec4_add(glm_vec4_add(glm_vec4_abs(x), glm_vec4_abs(y)), glm_vec4_abs(z));
+		glm_vec4 const NonZero = _mm_cmpgt_ps(Sum, Zero);
+		glm_vec4 const u = _mm_and_ps(NonZero, glm_vec4_div(x, Sum));
+		glm_vec4 const w = _mm_and_ps(NonZero, glm_vec4_div(y, Sum));
+
+		glm_vec4 const Lower = _mm_cmplt_ps(z, Zero);
+		glm_vec4 const One = _mm_set1_ps(1.0f);
+		glm_vec4 const FoldU = _mm_xor_ps(glm_vec4_sub(One, glm_vec4_abs(w)), _mm_and_ps(_mm_cmplt_ps(u, Zero), SignMask));
+		glm_vec4 const FoldW = _mm_xor_ps(glm_vec4_sub(One, glm_vec4_abs(u)), _mm_and_ps(_mm_cmplt_ps(w, Zero), SignMask));
+
+		glm_ivec4 const Mask = _mm_set1_epi32((1 << Bits) - 1);
+		glm_ivec4 const a = glm_vec4_to_snorm(_mm_or_ps(_mm_and_ps(Lower, FoldU), _mm_andnot_ps(Lower, u)), Scale);
+		glm_ivec4 const b = glm_vec4_to_snorm(_mm_or_ps(_mm_and_ps(Lower, FoldW), _mm_andnot_ps(Lower, w)), Scale);
+		return _mm_or_si128(_mm_and_si128(a, Mask), _mm_slli_epi32(_mm_and_si128(b, Mask), Bits));
+	}
+
+	template<int Bits>
+	GLM_FUNC_QUALIFIER void compute_unpackOct4(glm_ivec4 p, glm_vec4 InvScale, glm_vec4& x, glm_vec4& y, glm_vec4& z)
+	{
+		glm_vec4 const Zero = _mm_setzero_ps();
+		glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+
+		glm_vec4 const u = glm_vec4_from_snorm(_mm_srai_epi32(_mm_slli_epi32(p, 32 - Bits), 32 - Bits), InvScale);
+		glm_vec4 const w = glm_vec4_from_snorm(_mm_srai_epi32(_mm_slli_epi32(p, 32 - 2 * Bits), 32 - Bits), InvScale);
+		glm_vec4 const c = glm_vec4_sub(glm_vec4_sub(_mm_set1_ps(1.0f), glm_vec4_abs(u)), glm_vec4_abs(w));
+		glm_vec4 const t = _mm_max_ps(_mm_xor_ps(c, SignMask), Zero);
+
+		glm_vec4 const a = glm_vec4_add(u, _mm_xor_ps(t, _mm_and_ps(_mm_cmpge_ps(u, Zero), SignMask)));
+		glm_vec4 const b = glm_vec4_add(w, _mm_xor_ps(t, _mm_and_ps(_mm_cmpge_ps(w, Zero), SignMask)));
+		glm_vec4 const Length2 = glm_vec4_add(glm_vec4_add(glm_vec4_mul(a, a), glm_vec4_mul(b, b)), glm_vec4_mul(c, c));
+		glm_vec4 const InvLength = glm_vec4_div(_mm_set1_ps(1.0f), _mm_sqrt_ps(Length2));
+		x = glm_vec4_mul(a, InvLength);
+		y = glm_vec4_mul(b, InvLength);
+		z = glm_vec4_mul(c, InvLength);
+	}
+
+	// oct16 codes are stored in 16 bits, oct24 and oct32 codes in 32 bits
+	GLM_FUNC_QUALIFIER glm_ivec4 compute_loadOct4(uint16 const* p)
+	{
+		return glm_ivec4_unpack_u16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(p)));
+	}
+
+	GLM_FUNC_QUALIFIER glm_ivec4 compute_loadOct4(uint32 const* p)
+	{
+		return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+	}
+
+	GLM_FUNC_QUALIFIER void compute_storeOct4(uint16* p, glm_ivec4 x)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p), glm_ivec4_packus_epi32(x, x));
+	}
+
+	GLM_FUNC_QUALIFIER void compute_storeOct4(uint32* p, glm_ivec4 x)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p), x);
+	}
+
+	template<int Bits, qualifier Q>
+	struct compute_packOctArray<Bits, Q, true>
+	{
+		template<typename genUType>
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* v, genUType* p, std::size_t count, float Scale)
+		{
+			glm_vec4 const Scale4 = _mm_set1_ps(Scale);
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 x, y, z;
+				compute_loadVec3x4(v + i, x, y, z);
+				compute_storeOct4(p + i, compute_packOct4<Bits>(x, y, z, Scale4));
+			}
+			for(; i < count; ++i)
+				p[i] = static_cast<genUType>(packOct(vec3(v[i]), Scale, Bits));
+		}
+	};
+
+	template<int Bits, qualifier Q>
+	struct compute_unpackOctArray<Bits, Q, true>
+	{
+		template<typename genUType>
+		GLM_FUNC_QUALIFIER static void call(genUType const* p, vec<3, float, Q>* v, std::size_t count, float InvScale)
+		{
+			glm_vec4 const InvScale4 = _mm_set1_ps(InvScale);
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 x, y, z;
+				compute_unpackOct4<Bits>(compute_loadOct4(p + i), InvScale4, x, y, z);
+				compute_storeVec3x4(v + i, x, y, z);
+			}
+			for(; i < count; ++i)
+				v[i] = vec<3, float, Q>(unpackOct(p[i], InvScale, Bits));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackQTangentArray<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint64 const* p, vec<3, float, Q>* normals, vec<4, float, Q>* tangents, std::size_t count)
+		{
+			glm_vec4 const Scale = _mm_set1_ps(3.0518509475997192297128208258309e-5f);
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+			glm_vec4 const Two = _mm_set1_ps(2.0f);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_ivec4 const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i));
+				glm_ivec4 const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i + 2));
+				glm_vec4 x = glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpacklo_epi16(a, a), 16), Scale);
+				glm_vec4 y = glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpackhi_epi16(a, a), 16), Scale);
+				glm_vec4 z = glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpacklo_epi16(b, b), 16), Scale);
+				glm_vec4 w = glm_vec4_from_snorm(_mm_srai_epi32(_mm_unpackhi_epi16(b, b), 16), Scale);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				glm_vec4 const Sign = _mm_or_ps(One, _mm_and_ps(_mm_cmplt_ps(w, _mm_setzero_ps()), _mm_set1_ps(-0.0f)));
+				glm_vec4 const Length2 = glm_vec4_add(glm_vec4_add(glm_vec4_add(glm_vec4_mul(x, x), glm_vec4_mul(y, y)), glm_vec4_mul(z, z)), glm_vec4_mul(w, w));
+				glm_vec4 const InvLength = glm_vec4_div(One, _mm_sqrt_ps(Length2));
+				x = glm_vec4_mul(x, InvLength);
+				y = glm_vec4_mul(y, InvLength);
+				z = glm_vec4_mul(z, InvLength);
+				w = glm_vec4_mul(w, InvLength);
+
+				compute_storeVec3x4(normals + i,
+					glm_vec4_mul(Two, glm_vec4_add(glm_vec4_mul(x, z), glm_vec4_mul(w, y))),
+					glm_vec4_mul(Two, glm_vec4_sub(glm_vec4_mul(y, z), glm_vec4_mul(w, x))),
+					glm_vec4_sub(One, glm_vec4_mul(Two, glm_vec4_add(glm_vec4_mul(x, x), glm_vec4_mul(y, y)))));
+
+				glm_vec4 Tx = glm_vec4_sub(One, glm_vec4_mul(Two, glm_vec4_add(glm_vec4_mul(y, y), glm_vec4_mul(z, z))));
+				glm_vec4 Ty = glm_vec4_mul(Two, glm_vec4_add(glm_vec4_mul(x, y), glm_vec4_mul(w, z)));
+				glm_vec4 Tz = glm_vec4_mul(Two, glm_vec4_sub(glm_vec4_mul(x, z), glm_vec4_mul(w, y)));
+				glm_vec4 Tw = Sign;
+				_MM_TRANSPOSE4_PS(Tx, Ty, Tz, Tw);
+				_mm_storeu_ps(&tangents[i + 0].x, Tx);
+				_mm_storeu_ps(&tangents[i + 1].x, Ty);
+				_mm_storeu_ps(&tangents[i + 2].x, Tz);
+				_mm_storeu_ps(&tangents[i + 3].x, Tw);
+			}
+			for(; i < count; ++i)
+			{
+				vec3 Normal;
+				vec4 Tangent;
+				unpackQTangent(p[i], Normal, Tangent);
+				normals[i] = vec<3, float, Q>(Normal);
+				tangents[i] = vec<4, float, Q>(Tangent);
+			}
+		}
+	};
+
+	// Positions are quantized component by component, so the vec3 don't need to be transposed:
+	// the components of 4 packed vec3 fill 3 vectors with the bounds rotated accordingly, 4 aligned vec3 fill 4 vectors.
+	template<qualifier Q>
+	struct compute_packPosition3x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* v, vec3 const& minBounds, vec3 const& maxBounds, vec<3, uint16, Q>* p, std::size_t count)
+		{
+			vec3 const Extent(maxBounds - minBounds);
+			vec3 const Scale(packPositionScale(Extent.x), packPositionScale(Extent.y), packPositionScale(Extent.z));
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 const Max = _mm_set1_ps(65535.0f);
+
+			std::size_t i = 0;
+			if(sizeof(vec<3, float, Q>) == 3 * sizeof(float) && sizeof(vec<3, uint16, Q>) == 3 * sizeof(uint16))
+			{
+				glm_vec4 const Min0 = _mm_setr_ps(minBounds.x, minBounds.y, minBounds.z, minBounds.x);
+				glm_vec4 const Min1 = _mm_setr_ps(minBounds.y, minBounds.z, minBounds.x, minBounds.y);
+				glm_vec4 const Min2 = _mm_setr_ps(minBounds.z, minBounds.x, minBounds.y, minBounds.z);
+				glm_vec4 const Scale0 = _mm_setr_ps(Scale.x, Scale.y, Scale.z, Scale.x);
+				glm_vec4 const Scale1 = _mm_setr_ps(Scale.y, Scale.z, Scale.x, Scale.y);
+				glm_vec4 const Scale2 = _mm_setr_ps(Scale.z, Scale.x, Scale.y, Scale.z);
+				for(; i + 4 <= count; i += 4)
+				{
+					float const* f = &v[i].x;
+					glm_ivec4 const a = glm_vec4_iround(_mm_min_ps(_mm_max_ps(glm_vec4_mul(glm_vec4_sub(_mm_loadu_ps(f), Min0), Scale0), Zero), Max));
+					glm_ivec4 const b = glm_vec4_iround(_mm_min_ps(_mm_max_ps(glm_vec4_mul(glm_vec4_sub(_mm_loadu_ps(f + 4), Min1), Scale1), Zero), Max));
+					glm_ivec4 const c = glm_vec4_iround(_mm_min_ps(_mm_max_ps(glm_vec4_mul(glm_vec4_sub(_mm_loadu_ps(f + 8), Min2), Scale2), Zero), Max));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(&p[i].x), glm_ivec4_packus_epi32(a, b));
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(&p[i].x + 8), glm_ivec4_packus_epi32(c, c));
+				}
+			}
+			else if(sizeof(vec<3, float, Q>) == 4 * sizeof(float) && sizeof(vec<3, uint16, Q>) == 4 * sizeof(uint16))
+			{
+				glm_vec4 const Min4 = _mm_setr_ps(minBounds.x, minBounds.y, minBounds.z, 0.0f);
+				glm_vec4 const Scale4 = _mm_setr_ps(Scale.x, Scale.y, Scale.z, 0.0f);
+				for(; i + 2 <= count; i += 2)
+				{
+					glm_ivec4 const a = glm_vec4_iround(_mm_min_ps(_mm_max_ps(glm_vec4_mul(glm_vec4_sub(_mm_loadu_ps(&v[i].x), Min4), Scale4), Zero), Max));
+					glm_ivec4 const b = glm_vec4_iround(_mm_min_ps(_mm_max_ps(glm_vec4_mul(glm_vec4_sub(_mm_loadu_ps(&v[i + 1].x), Min4), Scale4), Zero), Max));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(&p[i].x), glm_ivec4_packus_epi32(a, b));
+				}
+			}
+			for(; i < count; ++i)
+				p[i] = vec<3, uint16, Q>(packPosition3x16(vec3(v[i]), minBounds, maxBounds));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_unpackPosition3x16Array<Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, uint16, Q> const* p, vec3 const& minBounds, vec3 const& maxBounds, vec<3, float, Q>* v, std::size_t count)
+		{
+			vec3 const Step((maxBounds - minBounds) / 65535.0f);
+
+			std::size_t i = 0;
+			if(sizeof(vec<3, float, Q>) == 3 * sizeof(float) && sizeof(vec<3, uint16, Q>) == 3 * sizeof(uint16))
+			{
+				glm_vec4 const Min0 = _mm_setr_ps(minBounds.x, minBounds.y, minBounds.z, minBounds.x);
+				glm_vec4 const Min1 = _mm_setr_ps(minBounds.y, minBounds.z, minBounds.x, minBounds.y);
+				glm_vec4 const Min2 = _mm_setr_ps(minBounds.z, minBounds.x, minBounds.y, minBounds.z);
+				glm_vec4 const Step0 = _mm_setr_ps(Step.x, Step.y, Step.z, Step.x);
+				glm_vec4 const Step1 = _mm_setr_ps(Step.y, Step.z, Step.x, Step.y);
+				glm_vec4 const Step2 = _mm_setr_ps(Step.z, Step.x, Step.y, Step.z);
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_ivec4 const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&p[i].x));
+					glm_ivec4 const b = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&p[i].x + 8));
+					float* f = &v[i].x;
+					_mm_storeu_ps(f, glm_vec4_add(Min0, glm_vec4_mul(_mm_cvtepi32_ps(glm_ivec4_unpack_u16(a)), Step0)));
+					_mm_storeu_ps(f + 4, glm_vec4_add(Min1, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpackhi_epi16(a, _mm_setzero_si128())), Step1)));
+					_mm_storeu_ps(f + 8, glm_vec4_add(Min2, glm_vec4_mul(_mm_cvtepi32_ps(glm_ivec4_unpack_u16(b)), Step2)));
+				}
+			}
+			else if(sizeof(vec<3, float, Q>) == 4 * sizeof(float) && sizeof(vec<3, uint16, Q>) == 4 * sizeof(uint16))
+			{
+				glm_vec4 const Min4 = _mm_setr_ps(minBounds.x, minBounds.y, minBounds.z, 0.0f);
+				glm_vec4 const Step4 = _mm_setr_ps(Step.x, Step.y, Step.z, 0.0f);
+				for(; i + 2 <= count; i += 2)
+				{
+					glm_ivec4 const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&p[i].x));
+					_mm_storeu_ps(&v[i].x, glm_vec4_add(Min4, glm_vec4_mul(_mm_cvtepi32_ps(glm_ivec4_unpack_u16(a)), Step4)));
+					_mm_storeu_ps(&v[i + 1].x, glm_vec4_add(Min4, glm_vec4_mul(_mm_cvtepi32_ps(_mm_unpackhi_epi16(a, _mm_setzero_si128())), Step4)));
+				}
+			}
+			for(; i < count; ++i)
+				v[i] = vec<3, float, Q>(unpackPosition3x16(u16vec3(p[i]), minBounds, maxBounds));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+namespace glm{
+namespace detail
+{
+	template<>
+	struct compute_convertFloatToHalf<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float const* f, uint16* h, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 8 <= count; i += 8)
+			{
+				float16x8_t const x = vcombine_f16(vcvt_f16_f32(vld1q_f32(f + i)), vcvt_f16_f32(vld1q_f32(f + i + 4)));
+				vst1q_u16(h + i, vreinterpretq_u16_f16(x));
+			}
+			for(; i < count; ++i)
+				h[i] = static_cast<uint16>(toFloat16(f[i]));
+		}
+	};
+
+	template<>
+	struct compute_convertHalfToFloat<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint16 const* h, float* f, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 8 <= count; i += 8)
+			{
+				float16x8_t const x = vreinterpretq_f16_u16(vld1q_u16(h + i));
+				vst1q_f32(f + i, vcvt_f32_f16(vget_low_f16(x)));
+				vst1q_f32(f + i + 4, vcvt_f32_f16(vget_high_f16(x)));
+			}
+			for(; i < count; ++i)
+				f[i] = toFloat32(static_cast<hdata>(h[i]));
+		}
+	};
+
+	// Same outer perfect shuffle of the bits of each 32 bits lane as glm_i128_shuffle
+	GLM_FUNC_QUALIFIER uint32x4_t compute_bitfieldShuffle(uint32x4_t x)
+	{
+		uint32x4_t t;
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 8)), vdupq_n_u32(0x0000FF00));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 8)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 4)), vdupq_n_u32(0x00F000F0));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 4)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 2)), vdupq_n_u32(0x0C0C0C0C));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 2)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 1)), vdupq_n_u32(0x22222222));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 1)));
+		return x;
+	}
+
+	GLM_FUNC_QUALIFIER uint32x4_t compute_bitfieldUnshuffle(uint32x4_t x)
+	{
+		uint32x4_t t;
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 1)), vdupq_n_u32(0x22222222));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 1)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 2)), vdupq_n_u32(0x0C0C0C0C));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 2)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 4)), vdupq_n_u32(0x00F000F0));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 4)));
+		t = vandq_u32(veorq_u32(x, vshrq_n_u32(x, 8)), vdupq_n_u32(0x0000FF00));
+		x = veorq_u32(x, veorq_u32(t, vshlq_n_u32(t, 8)));
+		return x;
+	}
+
+	template<int Passes>
+	GLM_FUNC_QUALIFIER std::size_t compute_bitfieldShuffleArray4(void const* in, void* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			uint32x4_t x = vreinterpretq_u32_u8(vld1q_u8(static_cast<uint8 const*>(in) + i * 4));
+			for(int Pass = 0; Pass < Passes; ++Pass)
+				x = compute_bitfieldShuffle(x);
+			vst1q_u8(static_cast<uint8*>(out) + i * 4, vreinterpretq_u8_u32(x));
+		}
+		return i;
+	}
+
+	template<int Passes>
+	GLM_FUNC_QUALIFIER std::size_t compute_bitfieldUnshuffleArray4(void const* in, void* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			uint32x4_t x = vreinterpretq_u32_u8(vld1q_u8(static_cast<uint8 const*>(in) + i * 4));
+			for(int Pass = 0; Pass < Passes; ++Pass)
+				x = compute_bitfieldUnshuffle(x);
+			vst1q_u8(static_cast<uint8*>(out) + i * 4, vreinterpretq_u8_u32(x));
+		}
+		return i;
+	}
+
+	template<qualifier Q>
+	struct compute_bitfieldInterleaveArray<2, uint16, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, uint16, Q> const* v, uint32* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldShuffleArray4<1>(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = glm::bitfieldInterleave(v[i].x, v[i].y);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldDeinterleaveArray<2, uint16, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const* p, vec<2, uint16, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldUnshuffleArray4<1>(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<2, uint16, Q>(glm::bitfieldDeinterleave(p[i]));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldInterleaveArray<4, uint8, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, uint8, Q> const* v, uint32* p, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldShuffleArray4<2>(&v[0].x, p, count) : 0;
+			for(; i < count; ++i)
+				p[i] = glm::bitfieldInterleave(v[i].x, v[i].y, v[i].z, v[i].w);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_bitfieldDeinterleaveArray<4, uint8, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 const* p, vec<4, uint8, Q>* v, std::size_t count)
+		{
+			std::size_t i = count > 0 ? compute_bitfieldUnshuffleArray4<2>(p, &v[0].x, count) : 0;
+			for(; i < count; ++i)
+				v[i] = vec<4, uint8, Q>(glm::bitfieldDeinterleave4(p[i]));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH
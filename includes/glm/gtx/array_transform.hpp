@@ -0,0 +1,78 @@
+/// @ref gtx_array_transform
+/// @file glm/gtx/array_transform.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_array_transform GLM_GTX_array_transform
+/// @ingroup gtx
+///
+/// Include <glm/gtx/array_transform.hpp> to use the features of this extension.
+///
+/// Transformation of contiguous or strided arrays of points, directions and normals by a single matrix.
+/// The SIMD paths keep the matrix in registers and transform 4 vectors per iteration, 8 with AVX.
+/// Outputs of at least GLM_ARRAY_TRANSFORM_STREAM_SIZE bytes are written with non-temporal stores
+/// so that a large transform does not evict the rest of the working set from the caches.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_array_transform is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_array_transform extension included")
+#endif
+
+#ifndef GLM_ARRAY_TRANSFORM_STREAM_SIZE
+#	define GLM_ARRAY_TRANSFORM_STREAM_SIZE (4 * 1024 * 1024)
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_array_transform
+	/// @{
+
+	/// Computes out[i] = vec3(m * vec4(in[i], 1)) for i in [0, count), in and out may be the same array.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = vec3(m * vec4(x, y, z, 1)) where x, y and z are the 3 values at in + i * stride bytes.
+	/// Transforms positions stored in interleaved vertex arrays.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = m * in[i] for i in [0, count), in and out may be the same array.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformPoints(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = vec3(m * vec4(in[i], 0)) for i in [0, count), in and out may be the same array.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformVectors(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = vec3(m * vec4(x, y, z, 0)) where x, y and z are the 3 values at in + i * stride bytes.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformVectors(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = normalize(N * in[i]) for i in [0, count) with N = inverseTranspose(mat3(m)), the normal matrix of m.
+	/// in and out may be the same array.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformNormals(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = normalize(N * vec3(x, y, z)) where x, y and z are the 3 values at in + i * stride bytes
+	/// and N = inverseTranspose(mat3(m)), the normal matrix of m.
+	/// @see gtx_array_transform
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformNormals(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "array_transform.inl"
@@ -0,0 +1,86 @@
+/// @ref gtx_array_transform
+
+namespace glm{
+namespace detail
+{
+	// out[i] = m[0] * x + m[1] * y + m[2] * z + m[3] where x, y and z are the 3 values at in + i * stride bytes
+	template<typename T, qualifier Q, bool Normalize, bool UseSimd>
+	struct compute_transform_vec3
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 3, T, Q> const& m, unsigned char const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T const* v = reinterpret_cast<T const*>(in + i * stride);
+				vec<3, T, Q> const r(m[0] * v[0] + m[1] * v[1] + m[2] * v[2] + m[3]);
+				out[i] = Normalize ? normalize(r) : r;
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_transform_vec4
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = m * in[i];
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		detail::compute_transform_vec3<T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			mat<4, 3, T, Q>(m), reinterpret_cast<unsigned char const*>(in), sizeof(vec<3, T, Q>), out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count)
+	{
+		detail::compute_transform_vec3<T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			mat<4, 3, T, Q>(m), reinterpret_cast<unsigned char const*>(in), stride, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformPoints(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		detail::compute_transform_vec4<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(m, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformVectors(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		transformVectors(m, reinterpret_cast<T const*>(in), sizeof(vec<3, T, Q>), out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformVectors(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count)
+	{
+		mat<4, 3, T, Q> Linear(m);
+		Linear[3] = vec<3, T, Q>(static_cast<T>(0));
+
+		detail::compute_transform_vec3<T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			Linear, reinterpret_cast<unsigned char const*>(in), stride, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformNormals(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		transformNormals(m, reinterpret_cast<T const*>(in), sizeof(vec<3, T, Q>), out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformNormals(mat<4, 4, T, Q> const& m, T const* in, std::size_t stride, vec<3, T, Q>* out, std::size_t count)
+	{
+		mat<3, 3, T, Q> const Normal(transpose(inverse(mat<3, 3, T, Q>(m))));
+
+		detail::compute_transform_vec3<T, Q, true, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			mat<4, 3, T, Q>(Normal[0], Normal[1], Normal[2], vec<3, T, Q>(static_cast<T>(0))), reinterpret_cast<unsigned char const*>(in), stride, out, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "array_transform_simd.inl"
+#endif
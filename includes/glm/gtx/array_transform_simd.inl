@@ -0,0 +1,414 @@
+/// @ref gtx_array_transform
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// Returns the number of leading elements of stride bytes to skip before p reaches the alignment, count if it never does
+	GLM_FUNC_QUALIFIER std::size_t transform_peel(void const* p, std::size_t stride, std::size_t alignment, std::size_t count)
+	{
+		std::size_t Address = reinterpret_cast<std::size_t>(p);
+		for(std::size_t i = 0; i < count && i < alignment; ++i, Address += stride)
+			if(Address % alignment == 0)
+				return i;
+		return count;
+	}
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<bool Stream>
+	GLM_FUNC_QUALIFIER void transform_store(float* p, glm_vec4 v)
+	{
+		if(Stream)
+			_mm_stream_ps(p, v);
+		else
+			_mm_storeu_ps(p, v);
+	}
+
+	// Affine transform of 4 vectors held as x, y and z lanes by the rows m[0 - 3], m[4 - 7] and m[8 - 11]
+	GLM_FUNC_QUALIFIER void transform_affine(glm_vec4 const m[12], glm_vec4 const in[3], glm_vec4 out[3])
+	{
+		out[0] = glm_vec4_fma(m[2], in[2], glm_vec4_fma(m[1], in[1], glm_vec4_fma(m[0], in[0], m[3])));
+		out[1] = glm_vec4_fma(m[6], in[2], glm_vec4_fma(m[5], in[1], glm_vec4_fma(m[4], in[0], m[7])));
+		out[2] = glm_vec4_fma(m[10], in[2], glm_vec4_fma(m[9], in[1], glm_vec4_fma(m[8], in[0], m[11])));
+	}
+
+	GLM_FUNC_QUALIFIER void transform_normalize(glm_vec4 v[3])
+	{
+		glm_vec4 const Dot = glm_vec4_fma(v[2], v[2], glm_vec4_fma(v[1], v[1], glm_vec4_mul(v[0], v[0])));
+		glm_vec4 const Inv = glm_vec4_div(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot));
+		v[0] = glm_vec4_mul(v[0], Inv);
+		v[1] = glm_vec4_mul(v[1], Inv);
+		v[2] = glm_vec4_mul(v[2], Inv);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER glm_vec8 transform_combine(glm_vec4 lo, glm_vec4 hi)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+	}
+
+	GLM_FUNC_QUALIFIER void transform_affine(glm_vec8 const m[12], glm_vec8 const in[3], glm_vec8 out[3])
+	{
+		out[0] = glm_vec8_fma(m[2], in[2], glm_vec8_fma(m[1], in[1], glm_vec8_fma(m[0], in[0], m[3])));
+		out[1] = glm_vec8_fma(m[6], in[2], glm_vec8_fma(m[5], in[1], glm_vec8_fma(m[4], in[0], m[7])));
+		out[2] = glm_vec8_fma(m[10], in[2], glm_vec8_fma(m[9], in[1], glm_vec8_fma(m[8], in[0], m[11])));
+	}
+
+	GLM_FUNC_QUALIFIER void transform_normalize(glm_vec8 v[3])
+	{
+		glm_vec8 const Dot = glm_vec8_fma(v[2], v[2], glm_vec8_fma(v[1], v[1], glm_vec8_mul(v[0], v[0])));
+		glm_vec8 const Inv = glm_vec8_div(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot));
+		v[0] = glm_vec8_mul(v[0], Inv);
+		v[1] = glm_vec8_mul(v[1], Inv);
+		v[2] = glm_vec8_mul(v[2], Inv);
+	}
+#	endif
+
+	// Loads x, y and z lanes of 4 or 8 packed vec3
+	struct transform_load_packed
+	{
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t, glm_vec4 v[3])
+		{
+			float const* f = reinterpret_cast<float const*>(p);
+			glm_vec4 const in[3] = {_mm_loadu_ps(f), _mm_loadu_ps(f + 4), _mm_loadu_ps(f + 8)};
+			glm_vec4_deinterleave3(in, v);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t, glm_vec8 v[3])
+		{
+			float const* f = reinterpret_cast<float const*>(p);
+			glm_vec8 const in[3] = {
+				transform_combine(_mm_loadu_ps(f), _mm_loadu_ps(f + 12)),
+				transform_combine(_mm_loadu_ps(f + 4), _mm_loadu_ps(f + 16)),
+				transform_combine(_mm_loadu_ps(f + 8), _mm_loadu_ps(f + 20))};
+			glm_vec8_deinterleave3(in, v);
+		}
+#		endif
+	};
+
+	// Loads x, y and z lanes of 4 or 8 vectors spaced by 4 floats.
+	// Strided arrays only guarantee 3 floats for their last vector, so the fourth one is loaded without its padding.
+	struct transform_load_padded
+	{
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t, glm_vec4 v[3])
+		{
+			float const* f = reinterpret_cast<float const*>(p);
+			glm_vec4 const Last = _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(f + 12))), _mm_load_ss(f + 14));
+			glm_vec4 const in[4] = {_mm_loadu_ps(f), _mm_loadu_ps(f + 4), _mm_loadu_ps(f + 8), Last};
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+			v[0] = out[0];
+			v[1] = out[1];
+			v[2] = out[2];
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t stride, glm_vec8 v[3])
+		{
+			glm_vec4 lo[3], hi[3];
+			call(p, stride, lo);
+			call(p + 64, stride, hi);
+			v[0] = transform_combine(lo[0], hi[0]);
+			v[1] = transform_combine(lo[1], hi[1]);
+			v[2] = transform_combine(lo[2], hi[2]);
+		}
+#		endif
+	};
+
+	// Gathers x, y and z lanes of 4 or 8 vectors spaced by any stride
+	struct transform_load_strided
+	{
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t stride, glm_vec4 v[3])
+		{
+			float const* f0 = reinterpret_cast<float const*>(p);
+			float const* f1 = reinterpret_cast<float const*>(p + stride);
+			float const* f2 = reinterpret_cast<float const*>(p + stride * 2);
+			float const* f3 = reinterpret_cast<float const*>(p + stride * 3);
+			v[0] = _mm_setr_ps(f0[0], f1[0], f2[0], f3[0]);
+			v[1] = _mm_setr_ps(f0[1], f1[1], f2[1], f3[1]);
+			v[2] = _mm_setr_ps(f0[2], f1[2], f2[2], f3[2]);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static void call(unsigned char const* p, std::size_t stride, glm_vec8 v[3])
+		{
+			glm_vec4 lo[3], hi[3];
+			call(p, stride, lo);
+			call(p + stride * 4, stride, hi);
+			v[0] = transform_combine(lo[0], hi[0]);
+			v[1] = transform_combine(lo[1], hi[1]);
+			v[2] = transform_combine(lo[2], hi[2]);
+		}
+#		endif
+	};
+
+	// Stores x, y and z lanes as 4 or 8 packed vec3
+	template<bool Stream>
+	struct transform_store_packed
+	{
+		GLM_FUNC_QUALIFIER static void call(float* p, glm_vec4 const v[3])
+		{
+			glm_vec4 out[3];
+			glm_vec4_interleave3(v, out);
+			transform_store<Stream>(p, out[0]);
+			transform_store<Stream>(p + 4, out[1]);
+			transform_store<Stream>(p + 8, out[2]);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static void call(float* p, glm_vec8 const v[3])
+		{
+			glm_vec8 out[3];
+			glm_vec8_interleave3(v, out);
+			transform_store<Stream>(p, _mm256_castps256_ps128(out[0]));
+			transform_store<Stream>(p + 4, _mm256_castps256_ps128(out[1]));
+			transform_store<Stream>(p + 8, _mm256_castps256_ps128(out[2]));
+			transform_store<Stream>(p + 12, _mm256_extractf128_ps(out[0], 1));
+			transform_store<Stream>(p + 16, _mm256_extractf128_ps(out[1], 1));
+			transform_store<Stream>(p + 20, _mm256_extractf128_ps(out[2], 1));
+		}
+#		endif
+	};
+
+	// Stores x, y and z lanes as 4 or 8 aligned vec3, the padding is written with 0
+	template<bool Stream>
+	struct transform_store_padded
+	{
+		GLM_FUNC_QUALIFIER static void call(float* p, glm_vec4 const v[3])
+		{
+			glm_vec4 const in[4] = {v[0], v[1], v[2], _mm_setzero_ps()};
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+			transform_store<Stream>(p, out[0]);
+			transform_store<Stream>(p + 4, out[1]);
+			transform_store<Stream>(p + 8, out[2]);
+			transform_store<Stream>(p + 12, out[3]);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static void call(float* p, glm_vec8 const v[3])
+		{
+			glm_vec4 const lo[3] = {_mm256_castps256_ps128(v[0]), _mm256_castps256_ps128(v[1]), _mm256_castps256_ps128(v[2])};
+			glm_vec4 const hi[3] = {_mm256_extractf128_ps(v[0], 1), _mm256_extractf128_ps(v[1], 1), _mm256_extractf128_ps(v[2], 1)};
+			call(p, lo);
+			call(p + 16, hi);
+		}
+#		endif
+	};
+
+	template<qualifier Q, bool Normalize>
+	struct compute_transform_vec3<float, Q, Normalize, true>
+	{
+		// Transforms the vectors 8 by 8 with AVX then 4 by 4 and returns the number of vectors processed
+		template<typename load, typename store>
+		GLM_FUNC_QUALIFIER static std::size_t call_lanes(mat<4, 3, float, Q> const& m, unsigned char const* in, std::size_t stride, float* out, std::size_t count)
+		{
+			std::size_t const OutLength = sizeof(vec<3, float, Q>) / sizeof(float);
+
+			glm_vec4 M[12];
+			for(length_t r = 0; r < 3; ++r)
+			for(length_t c = 0; c < 4; ++c)
+				M[r * 4 + c] = _mm_set1_ps(m[c][r]);
+
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 M8[12];
+				for(length_t k = 0; k < 12; ++k)
+					M8[k] = transform_combine(M[k], M[k]);
+
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_vec8 v[3], r[3];
+					load::call(in + i * stride, stride, v);
+					transform_affine(M8, v, r);
+					if(Normalize)
+						transform_normalize(r);
+					store::call(out + i * OutLength, r);
+				}
+			}
+#			endif
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 v[3], r[3];
+				load::call(in + i * stride, stride, v);
+				transform_affine(M, v, r);
+				if(Normalize)
+					transform_normalize(r);
+				store::call(out + i * OutLength, r);
+			}
+			return i;
+		}
+
+		template<typename store>
+		GLM_FUNC_QUALIFIER static std::size_t call_store(mat<4, 3, float, Q> const& m, unsigned char const* in, std::size_t stride, float* out, std::size_t count)
+		{
+			if(stride == sizeof(float) * 3)
+				return call_lanes<transform_load_packed, store>(m, in, stride, out, count);
+			else if(stride == sizeof(float) * 4)
+				return call_lanes<transform_load_padded, store>(m, in, stride, out, count);
+			else
+				return call_lanes<transform_load_strided, store>(m, in, stride, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void call(mat<4, 3, float, Q> const& m, unsigned char const* in, std::size_t stride, vec<3, float, Q>* out, std::size_t count)
+		{
+			typedef compute_transform_vec3<float, Q, Normalize, false> scalar;
+			bool const Packed = sizeof(vec<3, float, Q>) == sizeof(float) * 3;
+
+			// Non-temporal stores need 16 bytes aligned addresses, reached after at most 3 packed vec3
+			std::size_t Peel = 0;
+			bool Stream = count * sizeof(vec<3, float, Q>) >= GLM_ARRAY_TRANSFORM_STREAM_SIZE;
+			if(Stream)
+			{
+				Peel = transform_peel(out, sizeof(vec<3, float, Q>), 16, count);
+				Stream = Peel < count;
+				if(Stream)
+					scalar::call(m, in, stride, out, Peel);
+				else
+					Peel = 0;
+			}
+
+			float* const Out = reinterpret_cast<float*>(out + Peel);
+			unsigned char const* const In = in + Peel * stride;
+			std::size_t const Count = count - Peel;
+
+			std::size_t Done = 0;
+			if(Stream && Packed)
+				Done = call_store<transform_store_packed<true> >(m, In, stride, Out, Count);
+			else if(Stream)
+				Done = call_store<transform_store_padded<true> >(m, In, stride, Out, Count);
+			else if(Packed)
+				Done = call_store<transform_store_packed<false> >(m, In, stride, Out, Count);
+			else
+				Done = call_store<transform_store_padded<false> >(m, In, stride, Out, Count);
+
+			if(Stream)
+				_mm_sfence();
+
+			scalar::call(m, In + Done * stride, stride, out + Peel + Done, Count - Done);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_vec4<float, Q, true>
+	{
+		// m * v for 1 vector per SSE register, 2 per AVX register
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static std::size_t call_lanes(mat<4, 4, float, Q> const& m, float const* in, float* out, std::size_t count)
+		{
+			glm_vec4 const M[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_vec8 const M8[4] = {transform_combine(M[0], M[0]), transform_combine(M[1], M[1]), transform_combine(M[2], M[2]), transform_combine(M[3], M[3])};
+				for(; i + 2 <= count; i += 2)
+				{
+					glm_vec8 const v = _mm256_loadu_ps(in + i * 4);
+					glm_vec8 r = glm_vec8_mul(M8[0], _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+					r = glm_vec8_fma(M8[1], _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+					r = glm_vec8_fma(M8[2], _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+					r = glm_vec8_fma(M8[3], _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+					transform_store<Stream>(out + i * 4, _mm256_castps256_ps128(r));
+					transform_store<Stream>(out + i * 4 + 4, _mm256_extractf128_ps(r, 1));
+				}
+			}
+#			endif
+			for(; i < count; ++i)
+			{
+				glm_vec4 const v = _mm_loadu_ps(in + i * 4);
+				glm_vec4 r = glm_vec4_mul(M[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+				r = glm_vec4_fma(M[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+				r = glm_vec4_fma(M[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+				r = glm_vec4_fma(M[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+				transform_store<Stream>(out + i * 4, r);
+			}
+			return i;
+		}
+
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			bool Stream = count * sizeof(vec<4, float, Q>) >= GLM_ARRAY_TRANSFORM_STREAM_SIZE;
+			if(Stream)
+				Stream = transform_peel(out, sizeof(vec<4, float, Q>), 16, count) == 0;
+
+			if(Stream)
+			{
+				call_lanes<true>(m, &in[0].x, &out[0].x, count);
+				_mm_sfence();
+			}
+			else
+				call_lanes<false>(m, &in[0].x, &out[0].x, count);
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q, bool Normalize>
+	struct compute_transform_vec3<float, Q, Normalize, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 3, float, Q> const& m, unsigned char const* in, std::size_t stride, vec<3, float, Q>* out, std::size_t count)
+		{
+			typedef compute_transform_vec3<float, Q, Normalize, false> scalar;
+
+			// vld3q and vst3q transpose packed vec3 to lanes and back, other layouts take the generic path
+			if(stride != sizeof(float) * 3 || sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+			{
+				scalar::call(m, in, stride, out, count);
+				return;
+			}
+
+			float32x4_t M[12];
+			for(length_t r = 0; r < 3; ++r)
+			for(length_t c = 0; c < 4; ++c)
+				M[r * 4 + c] = vdupq_n_f32(m[c][r]);
+
+			float const* const In = reinterpret_cast<float const*>(in);
+			float* const Out = reinterpret_cast<float*>(out);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				float32x4x3_t const v = vld3q_f32(In + i * 3);
+				float32x4x3_t r;
+				r.val[0] = vfmaq_f32(vfmaq_f32(vfmaq_f32(M[3], M[0], v.val[0]), M[1], v.val[1]), M[2], v.val[2]);
+				r.val[1] = vfmaq_f32(vfmaq_f32(vfmaq_f32(M[7], M[4], v.val[0]), M[5], v.val[1]), M[6], v.val[2]);
+				r.val[2] = vfmaq_f32(vfmaq_f32(vfmaq_f32(M[11], M[8], v.val[0]), M[9], v.val[1]), M[10], v.val[2]);
+				if(Normalize)
+				{
+					float32x4_t const Dot = vfmaq_f32(vfmaq_f32(vmulq_f32(r.val[0], r.val[0]), r.val[1], r.val[1]), r.val[2], r.val[2]);
+					float32x4_t const Inv = vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(Dot));
+					r.val[0] = vmulq_f32(r.val[0], Inv);
+					r.val[1] = vmulq_f32(r.val[1], Inv);
+					r.val[2] = vmulq_f32(r.val[2], Inv);
+				}
+				vst3q_f32(Out + i * 3, r);
+			}
+
+			scalar::call(m, in + i * stride, stride, out + i, count - i);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_vec4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, vec<4, float, Q>* out, std::size_t count)
+		{
+			float32x4_t const M[4] = {vld1q_f32(&m[0].x), vld1q_f32(&m[1].x), vld1q_f32(&m[2].x), vld1q_f32(&m[3].x)};
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				float32x4_t const v = vld1q_f32(&in[i].x);
+				float32x4_t r = vmulq_laneq_f32(M[0], v, 0);
+				r = vfmaq_laneq_f32(r, M[1], v, 1);
+				r = vfmaq_laneq_f32(r, M[2], v, 2);
+				r = vfmaq_laneq_f32(r, M[3], v, 3);
+				vst1q_f32(&out[i].x, r);
+			}
+		}
+	};
+#endif//GLM_ARCH
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,128 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_aabb (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bvh.hpp> to use the features of this extension.
+///
+/// Bounding volume hierarchy of triangles built with a binned surface area heuristic, and ray queries against it.
+/// A triangle is hit by a ray where intersectRayTriangle returns true with a distance in [0, maxDistance],
+/// so that the queries return the same hits as testing every triangle with intersectRayTriangle.
+/// The distances are in units of the length of the ray direction, which does not need to be normalized.
+/// The batched queries traverse the hierarchy with packets of 4 rays with SSE or NEON, 8 with AVX, which is efficient for coherent rays.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/aabb.hpp"
+#include "../gtx/intersect.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_bvh is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+#ifndef GLM_BVH_MAX_LEAF_SIZE
+#	define GLM_BVH_MAX_LEAF_SIZE 8
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Bounding volume hierarchy of triangles.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q = defaultp>
+	struct tbvh
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+
+		/// Maximum depth of the hierarchy, the root has a depth of 1
+		static const length_t max_depth = 64;
+
+		/// An inner node has 2 children, nodes[first] and nodes[first + 1], and a count of 0.
+		/// A leaf holds the count triangles starting at the triangle first of the hierarchy.
+		struct node
+		{
+			aabb<3, T, Q> bounds;
+			uint32 first;
+			uint32 count;
+		};
+
+		// -- Data --
+
+		/// The root is nodes[0]
+		std::vector<node> nodes;
+
+		/// The 3 vertices of each triangle, in the order of the leaves
+		std::vector<vec<3, T, Q> > vertices;
+
+		/// The index of each triangle in the mesh the hierarchy was built from, in the order of the leaves
+		std::vector<int> triangles;
+	};
+
+	/// Builds the hierarchy of the triangleCount triangles (positions[3 * i], positions[3 * i + 1], positions[3 * i + 2]).
+	/// Leaves hold at most GLM_BVH_MAX_LEAF_SIZE triangles.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void buildBVH(tbvh<T, Q>& tree, vec<3, T, Q> const* positions, std::size_t triangleCount);
+
+	/// Builds the hierarchy of the triangleCount triangles (positions[indices[3 * i]], positions[indices[3 * i + 1]], positions[indices[3 * i + 2]]).
+	/// Leaves hold at most GLM_BVH_MAX_LEAF_SIZE triangles.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DISCARD_DECL void buildBVH(tbvh<T, Q>& tree, vec<3, T, Q> const* positions, I const* indices, std::size_t triangleCount);
+
+	/// Returns true if the ray hits a triangle of the hierarchy at a distance in [0, maxDistance],
+	/// the closest hit is returned as by intersectRayTriangle and triangle is the index of the triangle in the mesh.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVH(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, tbvh<T, Q> const& tree, T maxDistance,
+		vec<2, T, Q>& baryPosition, T& distance, int& triangle);
+
+	/// Returns true if the ray hits any triangle of the hierarchy at a distance in [0, maxDistance].
+	/// The traversal stops at the first hit found, which makes occlusion queries cheaper than the closest hit.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVH(vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, tbvh<T, Q> const& tree, T maxDistance);
+
+	/// Closest hits of count rays: triangles[i] is the index of the triangle hit by the ray i, or -1 if the ray misses.
+	/// baryPositions[i] and distances[i] are only written for the rays that hit.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void intersectRaysBVH(
+		vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+		vec<2, T, Q>* baryPositions, T* distances, int* triangles);
+
+	/// Any hits of count rays: hits[i] is true if the ray i hits a triangle.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void intersectRaysBVH(
+		vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+		bool* hits);
+
+	/// Bounding volume hierarchy of single-qualifier floating-point triangles.
+	/// @see gtx_bvh
+	typedef tbvh<float, defaultp>			bvh;
+
+	/// Bounding volume hierarchy of double-qualifier floating-point triangles.
+	/// @see gtx_bvh
+	typedef tbvh<double, defaultp>			dbvh;
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,445 @@
+/// @ref gtx_bvh
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Number of bins along each axis evaluated by the surface area heuristic
+	static const length_t bvh_bin_count = 16;
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<3, T, Q> bvh_empty_box()
+	{
+		return aabb<3, T, Q>(vec<3, T, Q>(std::numeric_limits<T>::max()), vec<3, T, Q>(-std::numeric_limits<T>::max()));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T bvh_half_area(aabb<3, T, Q> const& b)
+	{
+		vec<3, T, Q> const d(b.max - b.min);
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER length_t bvh_ceil_log2(T count)
+	{
+		length_t Result = 0;
+		while((static_cast<T>(1) << Result) < count)
+			++Result;
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	struct bvh_soup
+	{
+		vec<3, T, Q> const* positions;
+
+		GLM_FUNC_QUALIFIER vec<3, T, Q> const& operator()(std::size_t triangle, length_t k) const
+		{
+			return positions[triangle * 3 + static_cast<std::size_t>(k)];
+		}
+	};
+
+	template<typename T, qualifier Q, typename I>
+	struct bvh_indexed
+	{
+		vec<3, T, Q> const* positions;
+		I const* indices;
+
+		GLM_FUNC_QUALIFIER vec<3, T, Q> const& operator()(std::size_t triangle, length_t k) const
+		{
+			return positions[static_cast<std::size_t>(indices[triangle * 3 + static_cast<std::size_t>(k)])];
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct bvh_centroid_less
+	{
+		vec<3, T, Q> const* centroids;
+		length_t axis;
+
+		GLM_FUNC_QUALIFIER bool operator()(uint32 a, uint32 b) const
+		{
+			return centroids[a][axis] < centroids[b][axis];
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct bvh_bin
+	{
+		aabb<3, T, Q> bounds;
+		uint32 count;
+	};
+
+	// Range of triangles [begin, end) to build the node from
+	struct bvh_task
+	{
+		uint32 node;
+		uint32 begin;
+		uint32 end;
+		length_t depth;
+	};
+
+	// Binned surface area heuristic build, the nodes are built from a stack of tasks so that deep hierarchies do not recurse
+	template<typename T, qualifier Q, typename mesh>
+	GLM_FUNC_QUALIFIER void bvh_build(tbvh<T, Q>& tree, mesh const& Mesh, std::size_t triangleCount)
+	{
+		typedef aabb<3, T, Q> box;
+		typedef bvh_bin<T, Q> bin;
+		typedef typename tbvh<T, Q>::node node;
+
+		tree.nodes.clear();
+		tree.vertices.clear();
+		tree.triangles.clear();
+		if(triangleCount == 0)
+			return;
+
+		assert(triangleCount <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
+		std::vector<box> Bounds;
+		std::vector<vec<3, T, Q> > Centroids;
+		std::vector<uint32> Order;
+		Bounds.reserve(triangleCount);
+		Centroids.reserve(triangleCount);
+		Order.reserve(triangleCount);
+		for(std::size_t i = 0; i < triangleCount; ++i)
+		{
+			Bounds.push_back(merge(merge(box(Mesh(i, 0)), Mesh(i, 1)), Mesh(i, 2)));
+			Centroids.push_back((Bounds[i].min + Bounds[i].max) * static_cast<T>(0.5));
+			Order.push_back(static_cast<uint32>(i));
+		}
+
+		node Empty;
+		Empty.bounds = bvh_empty_box<T, Q>();
+		Empty.first = 0;
+		Empty.count = 0;
+
+		tree.nodes.reserve(triangleCount * 2);
+		tree.nodes.push_back(Empty);
+
+		std::vector<bvh_task> Tasks;
+		bvh_task const Root = {0, 0, static_cast<uint32>(triangleCount), 1};
+		Tasks.push_back(Root);
+
+		while(!Tasks.empty())
+		{
+			bvh_task const Task = Tasks.back();
+			Tasks.pop_back();
+
+			uint32 const Count = Task.end - Task.begin;
+
+			box NodeBounds(bvh_empty_box<T, Q>());
+			box CentroidBounds(bvh_empty_box<T, Q>());
+			for(uint32 i = Task.begin; i < Task.end; ++i)
+			{
+				NodeBounds = merge(NodeBounds, Bounds[Order[i]]);
+				CentroidBounds = merge(CentroidBounds, Centroids[Order[i]]);
+			}
+			tree.nodes[Task.node].bounds = NodeBounds;
+
+			// Evaluate the bins of the 3 axes
+			int BestAxis = -1;
+			length_t BestSplit = 0;
+			T BestCost = std::numeric_limits<T>::max();
+			for(length_t Axis = 0; Axis < 3 && Count > 1; ++Axis)
+			{
+				T const Extent = CentroidBounds.max[Axis] - CentroidBounds.min[Axis];
+				if(Extent <= static_cast<T>(0))
+					continue;
+
+				bin Bins[bvh_bin_count];
+				for(length_t b = 0; b < bvh_bin_count; ++b)
+				{
+					Bins[b].bounds = bvh_empty_box<T, Q>();
+					Bins[b].count = 0;
+				}
+
+				T const Scale = static_cast<T>(bvh_bin_count) / Extent;
+				for(uint32 i = Task.begin; i < Task.end; ++i)
+				{
+					length_t const b = glm::min(static_cast<length_t>((Centroids[Order[i]][Axis] - CentroidBounds.min[Axis]) * Scale), bvh_bin_count - 1);
+					Bins[b].bounds = merge(Bins[b].bounds, Bounds[Order[i]]);
+					++Bins[b].count;
+				}
+
+				// Sweep from the right to get the cost of the right side of each split, then from the left
+				T RightCost[bvh_bin_count];
+				box Right(Bins[bvh_bin_count - 1].bounds);
+				uint32 RightCount = Bins[bvh_bin_count - 1].count;
+				for(length_t b = bvh_bin_count - 1; b > 0; --b)
+				{
+					RightCost[b] = RightCount > 0 ? bvh_half_area(Right) * static_cast<T>(RightCount) : static_cast<T>(0);
+					Right = merge(Right, Bins[b - 1].bounds);
+					RightCount += Bins[b - 1].count;
+				}
+
+				box Left(Bins[0].bounds);
+				uint32 LeftCount = Bins[0].count;
+				for(length_t b = 1; b < bvh_bin_count; ++b)
+				{
+					T const Cost = (LeftCount > 0 ? bvh_half_area(Left) * static_cast<T>(LeftCount) : static_cast<T>(0)) + RightCost[b];
+					if(LeftCount > 0 && LeftCount < Count && Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = static_cast<int>(Axis);
+						BestSplit = b;
+					}
+					Left = merge(Left, Bins[b].bounds);
+					LeftCount += Bins[b].count;
+				}
+			}
+
+			// The cost of a triangle test and of a node traversal are assumed equal
+			T const Area = bvh_half_area(NodeBounds);
+			T const SplitCost = Area > static_cast<T>(0) ? static_cast<T>(1) + BestCost / Area : static_cast<T>(Count);
+			bool const Split = Count > GLM_BVH_MAX_LEAF_SIZE || (BestAxis >= 0 && SplitCost < static_cast<T>(Count));
+			if(!Split)
+			{
+				tree.nodes[Task.node].first = Task.begin;
+				tree.nodes[Task.node].count = Count;
+				continue;
+			}
+
+			uint32 Middle;
+			if(BestAxis >= 0 && Task.depth + bvh_ceil_log2(Count) < tbvh<T, Q>::max_depth)
+			{
+				length_t const Axis = static_cast<length_t>(BestAxis);
+				T const Scale = static_cast<T>(bvh_bin_count) / (CentroidBounds.max[Axis] - CentroidBounds.min[Axis]);
+
+				Middle = Task.begin;
+				for(uint32 i = Task.begin; i < Task.end; ++i)
+				{
+					length_t const b = glm::min(static_cast<length_t>((Centroids[Order[i]][Axis] - CentroidBounds.min[Axis]) * Scale), bvh_bin_count - 1);
+					if(b < BestSplit)
+						std::swap(Order[i], Order[Middle++]);
+				}
+			}
+			else
+			{
+				// No split separates the centroids or the depth limit is near: split at the median of the longest centroid axis,
+				// which bounds the depth of the subtree by the logarithm of its triangle count
+				vec<3, T, Q> const Extent(CentroidBounds.max - CentroidBounds.min);
+				bvh_centroid_less<T, Q> Less;
+				Less.centroids = &Centroids[0];
+				Less.axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+
+				Middle = Task.begin + Count / 2;
+				std::nth_element(Order.begin() + Task.begin, Order.begin() + Middle, Order.begin() + Task.end, Less);
+			}
+
+			uint32 const Children = static_cast<uint32>(tree.nodes.size());
+			tree.nodes[Task.node].first = Children;
+			tree.nodes[Task.node].count = 0;
+			tree.nodes.push_back(Empty);
+			tree.nodes.push_back(Empty);
+
+			bvh_task const RightTask = {Children + 1, Middle, Task.end, Task.depth + 1};
+			bvh_task const LeftTask = {Children, Task.begin, Middle, Task.depth + 1};
+			Tasks.push_back(RightTask);
+			Tasks.push_back(LeftTask);
+		}
+
+		tree.vertices.reserve(triangleCount * 3);
+		tree.triangles.reserve(triangleCount);
+		for(std::size_t i = 0; i < triangleCount; ++i)
+		{
+			for(length_t k = 0; k < 3; ++k)
+				tree.vertices.push_back(Mesh(Order[i], k));
+			tree.triangles.push_back(static_cast<int>(Order[i]));
+		}
+	}
+
+	// Ray with the reciprocal of its direction, null components are replaced by the smallest normal value
+	// so that the slab tests of a ray parallel to a face return +/- infinity or 0 but never NaN
+	template<typename T, qualifier Q>
+	struct bvh_ray
+	{
+		vec<3, T, Q> orig;
+		vec<3, T, Q> dir;
+		vec<3, T, Q> inv;
+
+		GLM_FUNC_QUALIFIER bvh_ray(vec<3, T, Q> const& o, vec<3, T, Q> const& d)
+			: orig(o), dir(d)
+		{
+			for(length_t i = 0; i < 3; ++i)
+				inv[i] = static_cast<T>(1) / (d[i] != static_cast<T>(0) ? d[i] : std::numeric_limits<T>::min());
+		}
+
+		// Returns the distance where the ray enters b if it does before maxDistance, -1 otherwise.
+		// The exit distance is scaled up to absorb the rounding of the slab distances.
+		GLM_FUNC_QUALIFIER T enter(aabb<3, T, Q> const& b, T maxDistance) const
+		{
+			vec<3, T, Q> const t0((b.min - orig) * inv);
+			vec<3, T, Q> const t1((b.max - orig) * inv);
+			vec<3, T, Q> const Near(glm::min(t0, t1));
+			vec<3, T, Q> const Far(glm::max(t0, t1));
+
+			T const Enter = glm::max(glm::max(Near.x, Near.y), glm::max(Near.z, static_cast<T>(0)));
+			T const Exit = glm::min(glm::min(Far.x, Far.y), Far.z) * (static_cast<T>(1) + static_cast<T>(4) * std::numeric_limits<T>::epsilon());
+			return Enter <= Exit && Enter <= maxDistance ? Enter : static_cast<T>(-1);
+		}
+	};
+
+	// Node left to visit and the distance where the ray enters it
+	template<typename T>
+	struct bvh_entry
+	{
+		uint32 node;
+		T enter;
+	};
+
+	// Single ray traversal visiting the nearest child first, AnyHit stops at the first triangle hit
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh_traverse(
+		bvh_ray<T, Q> const& Ray, tbvh<T, Q> const& tree, T maxDistance, bool AnyHit,
+		vec<2, T, Q>& baryPosition, T& distance, int& triangle)
+	{
+		typedef typename tbvh<T, Q>::node node;
+
+		if(tree.nodes.empty() || Ray.enter(tree.nodes[0].bounds, maxDistance) < static_cast<T>(0))
+			return false;
+
+		bvh_entry<T> Stack[tbvh<T, Q>::max_depth];
+		std::size_t Size = 0;
+
+		bool Hit = false;
+		T Closest = maxDistance;
+		uint32 Index = 0;
+		for(;;)
+		{
+			node const& Node = tree.nodes[Index];
+			if(Node.count > 0)
+			{
+				for(uint32 i = Node.first, n = Node.first + Node.count; i < n; ++i)
+				{
+					vec<2, T, Q> Bary;
+					T Distance;
+					if(!intersectRayTriangle(Ray.orig, Ray.dir, tree.vertices[i * 3], tree.vertices[i * 3 + 1], tree.vertices[i * 3 + 2], Bary, Distance))
+						continue;
+					if(Distance < static_cast<T>(0) || Distance > Closest || (Hit && Distance == Closest))
+						continue;
+
+					Hit = true;
+					Closest = Distance;
+					baryPosition = Bary;
+					distance = Distance;
+					triangle = tree.triangles[i];
+					if(AnyHit)
+						return true;
+				}
+			}
+			else
+			{
+				T const EnterLeft = Ray.enter(tree.nodes[Node.first].bounds, Closest);
+				T const EnterRight = Ray.enter(tree.nodes[Node.first + 1].bounds, Closest);
+				if(EnterLeft >= static_cast<T>(0) && EnterRight >= static_cast<T>(0))
+				{
+					bool const LeftFirst = EnterLeft <= EnterRight;
+					bvh_entry<T> const Far = {LeftFirst ? Node.first + 1 : Node.first, LeftFirst ? EnterRight : EnterLeft};
+					Stack[Size++] = Far;
+					Index = LeftFirst ? Node.first : Node.first + 1;
+					continue;
+				}
+				if(EnterLeft >= static_cast<T>(0) || EnterRight >= static_cast<T>(0))
+				{
+					Index = EnterLeft >= static_cast<T>(0) ? Node.first : Node.first + 1;
+					continue;
+				}
+			}
+
+			// Pop the next node the ray still enters before the closest hit
+			for(;;)
+			{
+				if(Size == 0)
+					return Hit;
+				bvh_entry<T> const& Entry = Stack[--Size];
+				if(Entry.enter <= Closest)
+				{
+					Index = Entry.node;
+					break;
+				}
+			}
+		}
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_bvh_rays
+	{
+		GLM_FUNC_QUALIFIER static void closest(
+			vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+			vec<2, T, Q>* baryPositions, T* distances, int* triangles)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				if(!bvh_traverse(bvh_ray<T, Q>(origs[i], dirs[i]), tree, maxDistance, false, baryPositions[i], distances[i], triangles[i]))
+					triangles[i] = -1;
+		}
+
+		GLM_FUNC_QUALIFIER static void any(
+			vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+			bool* hits)
+		{
+			vec<2, T, Q> Bary;
+			T Distance;
+			int Triangle;
+			for(std::size_t i = 0; i < count; ++i)
+				hits[i] = bvh_traverse(bvh_ray<T, Q>(origs[i], dirs[i]), tree, maxDistance, true, Bary, Distance, Triangle);
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildBVH(tbvh<T, Q>& tree, vec<3, T, Q> const* positions, std::size_t triangleCount)
+	{
+		detail::bvh_soup<T, Q> Mesh;
+		Mesh.positions = positions;
+		detail::bvh_build(tree, Mesh, triangleCount);
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void buildBVH(tbvh<T, Q>& tree, vec<3, T, Q> const* positions, I const* indices, std::size_t triangleCount)
+	{
+		detail::bvh_indexed<T, Q, I> Mesh;
+		Mesh.positions = positions;
+		Mesh.indices = indices;
+		detail::bvh_build(tree, Mesh, triangleCount);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVH(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, tbvh<T, Q> const& tree, T maxDistance,
+		vec<2, T, Q>& baryPosition, T& distance, int& triangle)
+	{
+		return detail::bvh_traverse(detail::bvh_ray<T, Q>(orig, dir), tree, maxDistance, false, baryPosition, distance, triangle);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVH(vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, tbvh<T, Q> const& tree, T maxDistance)
+	{
+		vec<2, T, Q> Bary;
+		T Distance;
+		int Triangle;
+		return detail::bvh_traverse(detail::bvh_ray<T, Q>(orig, dir), tree, maxDistance, true, Bary, Distance, Triangle);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void intersectRaysBVH(
+		vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+		vec<2, T, Q>* baryPositions, T* distances, int* triangles)
+	{
+		detail::compute_bvh_rays<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::closest(origs, dirs, count, tree, maxDistance, baryPositions, distances, triangles);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void intersectRaysBVH(
+		vec<3, T, Q> const* origs, vec<3, T, Q> const* dirs, std::size_t count, tbvh<T, Q> const& tree, T maxDistance,
+		bool* hits)
+	{
+		detail::compute_bvh_rays<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::any(origs, dirs, count, tree, maxDistance, hits);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "bvh_simd.inl"
+#endif
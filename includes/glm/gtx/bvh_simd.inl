@@ -0,0 +1,166 @@
+/// @ref gtx_bvh
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+	// Traverses the hierarchy with the packet of the count rays [0, count), count <= P::lanes, and returns the bits of the rays that hit.
+	// The lanes past count are given a negative distance limit so that they never enter a node nor accept a triangle.
+	// A packet enters the nodes entered by any of its rays, the children are visited in the order of the direction of the first ray.
+	// The triangles are tested with the arithmetic of intersectRayTriangle, the hits of a lane are selected as the single ray traversal does.
+	template<typename P, qualifier Q>
+	GLM_FUNC_QUALIFIER uint32 bvh_traverse_packet(
+		vec<3, float, Q> const* origs, vec<3, float, Q> const* dirs, length_t count, tbvh<float, Q> const& bvh, float maxDistance, bool AnyHit,
+		vec<2, float, Q>* baryPositions, float* distances, int* triangles)
+	{
+		typedef typename P::type V;
+		typedef typename tbvh<float, Q>::node node;
+
+		float Lanes[10][P::lanes];
+		for(length_t l = 0; l < P::lanes; ++l)
+		{
+			bvh_ray<float, Q> const Ray(origs[l < count ? l : 0], dirs[l < count ? l : 0]);
+			for(length_t c = 0; c < 3; ++c)
+			{
+				Lanes[c][l] = Ray.orig[c];
+				Lanes[c + 3][l] = Ray.dir[c];
+				Lanes[c + 6][l] = Ray.inv[c];
+			}
+			Lanes[9][l] = l < count ? maxDistance : -1.0f;
+		}
+
+		V const O[3] = {P::load(Lanes[0]), P::load(Lanes[1]), P::load(Lanes[2])};
+		V const D[3] = {P::load(Lanes[3]), P::load(Lanes[4]), P::load(Lanes[5])};
+		V const I[3] = {P::load(Lanes[6]), P::load(Lanes[7]), P::load(Lanes[8])};
+		V Limit = P::load(Lanes[9]);
+		V U = P::splat(0.0f);
+		V W = P::splat(0.0f);
+		V Hit = P::splat(0.0f);
+
+		V const Zero = P::splat(0.0f);
+		V const True = P::le(Zero, Zero);
+		V const Slack = P::splat(1.0f + 4.0f * std::numeric_limits<float>::epsilon());
+		vec<3, float, Q> const& Dir = dirs[0];
+
+		int Triangles[P::lanes];
+		uint32 Stack[tbvh<float, Q>::max_depth + 1];
+		std::size_t Size = 0;
+		if(!bvh.nodes.empty())
+			Stack[Size++] = 0;
+
+		while(Size > 0)
+		{
+			node const& Node = bvh.nodes[Stack[--Size]];
+
+			// Slab test of the rays still looking for a hit before their limit
+			V const X0 = P::mul(P::sub(P::splat(Node.bounds.min.x), O[0]), I[0]);
+			V const X1 = P::mul(P::sub(P::splat(Node.bounds.max.x), O[0]), I[0]);
+			V const Y0 = P::mul(P::sub(P::splat(Node.bounds.min.y), O[1]), I[1]);
+			V const Y1 = P::mul(P::sub(P::splat(Node.bounds.max.y), O[1]), I[1]);
+			V const Z0 = P::mul(P::sub(P::splat(Node.bounds.min.z), O[2]), I[2]);
+			V const Z1 = P::mul(P::sub(P::splat(Node.bounds.max.z), O[2]), I[2]);
+			V const Enter = P::max(P::max(P::min(X0, X1), P::min(Y0, Y1)), P::max(P::min(Z0, Z1), Zero));
+			V const Exit = P::mul(P::min(P::min(P::max(X0, X1), P::max(Y0, Y1)), P::max(Z0, Z1)), Slack);
+			if(P::mask(P::and_(P::le(Enter, Exit), P::le(Enter, Limit))) == 0)
+				continue;
+
+			if(Node.count == 0)
+			{
+				// Push the far child first so that the near child is visited next
+				vec<3, float, Q> const Delta(
+					(bvh.nodes[Node.first + 1].bounds.min + bvh.nodes[Node.first + 1].bounds.max) -
+					(bvh.nodes[Node.first].bounds.min + bvh.nodes[Node.first].bounds.max));
+				bool const LeftFirst = dot(Dir, Delta) >= 0.0f;
+				Stack[Size++] = LeftFirst ? Node.first + 1 : Node.first;
+				Stack[Size++] = LeftFirst ? Node.first : Node.first + 1;
+				continue;
+			}
+
+			for(uint32 i = Node.first, n = Node.first + Node.count; i < n; ++i)
+			{
+				vec<3, float, Q> const& Vert0 = bvh.vertices[i * 3];
+				vec<3, float, Q> const Edge1(bvh.vertices[i * 3 + 1] - Vert0);
+				vec<3, float, Q> const Edge2(bvh.vertices[i * 3 + 2] - Vert0);
+
+				V const Vert0Lanes[3] = {P::splat(Vert0.x), P::splat(Vert0.y), P::splat(Vert0.z)};
+				V const Edge1Lanes[3] = {P::splat(Edge1.x), P::splat(Edge1.y), P::splat(Edge1.z)};
+				V const Edge2Lanes[3] = {P::splat(Edge2.x), P::splat(Edge2.y), P::splat(Edge2.z)};
+
+				V BaryU, BaryV, Distance;
+				V const Inside = intersect_ray_triangle_packet<P>(O, D, Vert0Lanes, Edge1Lanes, Edge2Lanes, BaryU, BaryV, Distance);
+
+				// A first hit may be at the limit, a closer hit must be strictly closer
+				V const Accept = P::and_(P::and_(Inside, P::le(Zero, Distance)), P::and_(P::le(Distance, Limit), P::or_(P::lt(Distance, Limit), P::andnot(Hit, True))));
+				uint32 const Mask = P::mask(Accept);
+				if(Mask == 0)
+					continue;
+
+				Hit = P::or_(Hit, Accept);
+				U = P::select(Accept, BaryU, U);
+				W = P::select(Accept, BaryV, W);
+				// Any hit queries retire the rays that hit
+				Limit = P::select(Accept, AnyHit ? P::splat(-1.0f) : Distance, Limit);
+				for(length_t l = 0; l < P::lanes; ++l)
+					if(Mask & (1u << l))
+						Triangles[l] = bvh.triangles[i];
+			}
+
+			if(AnyHit && P::mask(P::le(Zero, Limit)) == 0)
+				break;
+		}
+
+		uint32 const Mask = P::mask(Hit) & ((1u << count) - 1u);
+		if(!AnyHit)
+		{
+			float Bu[P::lanes], Bv[P::lanes], Distance[P::lanes];
+			P::store(Bu, U);
+			P::store(Bv, W);
+			P::store(Distance, Limit);
+			for(length_t l = 0; l < count; ++l)
+			{
+				if(Mask & (1u << l))
+				{
+					baryPositions[l] = vec<2, float, Q>(Bu[l], Bv[l]);
+					distances[l] = Distance[l];
+					triangles[l] = Triangles[l];
+				}
+				else
+					triangles[l] = -1;
+			}
+		}
+		return Mask;
+	}
+
+	template<qualifier Q>
+	struct compute_bvh_rays<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void closest(
+			vec<3, float, Q> const* origs, vec<3, float, Q> const* dirs, std::size_t count, tbvh<float, Q> const& bvh, float maxDistance,
+			vec<2, float, Q>* baryPositions, float* distances, int* triangles)
+		{
+			for(std::size_t i = 0; i < count; i += intersect_packet::lanes)
+			{
+				length_t const n = static_cast<length_t>(glm::min(count - i, static_cast<std::size_t>(intersect_packet::lanes)));
+				bvh_traverse_packet<intersect_packet>(origs + i, dirs + i, n, bvh, maxDistance, false, baryPositions + i, distances + i, triangles + i);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void any(
+			vec<3, float, Q> const* origs, vec<3, float, Q> const* dirs, std::size_t count, tbvh<float, Q> const& bvh, float maxDistance,
+			bool* hits)
+		{
+			for(std::size_t i = 0; i < count; i += intersect_packet::lanes)
+			{
+				length_t const n = static_cast<length_t>(glm::min(count - i, static_cast<std::size_t>(intersect_packet::lanes)));
+				uint32 const Mask = bvh_traverse_packet<intersect_packet>(origs + i, dirs + i, n, bvh, maxDistance, true,
+					static_cast<vec<2, float, Q>*>(GLM_NULLPTR), static_cast<float*>(GLM_NULLPTR), static_cast<int*>(GLM_NULLPTR));
+				for(length_t l = 0; l < n; ++l)
+					hits[i + static_cast<std::size_t>(l)] = (Mask & (1u << l)) != 0;
+			}
+		}
+	};
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+}//namespace detail
+}//namespace glm
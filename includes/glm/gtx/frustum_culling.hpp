@@ -0,0 +1,84 @@
+/// @ref gtx_frustum_culling
+/// @file glm/gtx/frustum_culling.hpp
+///
+/// @see core (dependence)
+/// @see ext_matrix_clip_space
+///
+/// @defgroup gtx_frustum_culling GLM_GTX_frustum_culling
+/// @ingroup gtx
+///
+/// Include <glm/gtx/frustum_culling.hpp> to use the features of this extension.
+///
+/// Extraction of the frustum planes of a projection matrix and visibility tests of bounding spheres and boxes.
+/// A plane (a, b, c, d) keeps the points p where a * p.x + b * p.y + c * p.z + d >= 0.
+/// The planes of a view are stored in the order left, right, bottom, top, near, far.
+/// The batched tests read bounds stored as structure of arrays, one array per component, and test them against several views in a single pass.
+/// They write one bit per bound: bit i % 32 of the word i / 32 is set if the bound i is visible.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_frustum_culling is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_frustum_culling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum_culling
+	/// @{
+
+	/// Extracts the 6 planes of the frustum of m for a clip space depth range of 0 to 1.
+	/// The planes are in the space m transforms from: world space for m = projection * view.
+	/// The planes are normalized so that they return distances, except a far plane at infinity which is left with a null normal and always passes.
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extracts the 6 planes of the frustum of m for a clip space depth range of -1 to 1.
+	/// The planes are in the space m transforms from: world space for m = projection * view.
+	/// The planes are normalized so that they return distances, except a far plane at infinity which is left with a null normal and always passes.
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extracts the 6 planes of the frustum of m for the clip space depth range of GLM_FORCE_DEPTH_ZERO_TO_ONE.
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Returns true if the sphere is not entirely outside one of the 6 planes.
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumSphere(vec<4, T, Q> const planes[6], vec<3, T, Q> const& center, T radius);
+
+	/// Returns true if the axis aligned box is not entirely outside one of the 6 planes.
+	/// The test is conservative: a box crossing the extension of two planes near a corner of the frustum may pass.
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumBox(vec<4, T, Q> const planes[6], vec<3, T, Q> const& minCorner, vec<3, T, Q> const& maxCorner);
+
+	/// Tests count spheres against viewCount frustums of 6 planes, planes[6 * v] to planes[6 * v + 5] for the view v.
+	/// The visibility bits of the view v are written to the (count + 31) / 32 words starting at masks + v * ((count + 31) / 32).
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void cullSpheres(
+		vec<4, T, Q> const* planes, std::size_t viewCount,
+		T const* x, T const* y, T const* z, T const* radius, std::size_t count, uint32* masks);
+
+	/// Tests count axis aligned boxes against viewCount frustums of 6 planes, planes[6 * v] to planes[6 * v + 5] for the view v.
+	/// The visibility bits of the view v are written to the (count + 31) / 32 words starting at masks + v * ((count + 31) / 32).
+	/// @see gtx_frustum_culling
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void cullBoxes(
+		vec<4, T, Q> const* planes, std::size_t viewCount,
+		T const* minX, T const* minY, T const* minZ, T const* maxX, T const* maxY, T const* maxZ, std::size_t count, uint32* masks);
+
+	/// @}
+}//namespace glm
+
+#include "frustum_culling.inl"
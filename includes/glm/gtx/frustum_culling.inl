@@ -0,0 +1,162 @@
+/// @ref gtx_frustum_culling
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> frustum_normalize_plane(vec<4, T, Q> const& p)
+	{
+		// The far plane of an infinite projection has a null normal
+		T const Length = glm::length(vec<3, T, Q>(p));
+		return Length > static_cast<T>(0) ? p / Length : p;
+	}
+
+	// The rows of m combined by the Gribb and Hartmann method, the near plane depends on the clip space depth range
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustum_planes(mat<4, 4, T, Q> const& m, vec<4, T, Q> const& Near, vec<4, T, Q> planes[6])
+	{
+		vec<4, T, Q> const Row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		vec<4, T, Q> const Row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		vec<4, T, Q> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		vec<4, T, Q> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		planes[0] = frustum_normalize_plane(Row3 + Row0);
+		planes[1] = frustum_normalize_plane(Row3 - Row0);
+		planes[2] = frustum_normalize_plane(Row3 + Row1);
+		planes[3] = frustum_normalize_plane(Row3 - Row1);
+		planes[4] = frustum_normalize_plane(Near);
+		planes[5] = frustum_normalize_plane(Row3 - Row2);
+	}
+
+	// Writes the visibility bits of the bounds starting at i, the bounds of a word are written in increasing order from its bit 0
+	GLM_FUNC_QUALIFIER void cull_write_bits(uint32* mask, std::size_t i, uint32 bits)
+	{
+		if(i % 32 == 0)
+			mask[i / 32] = bits;
+		else
+			mask[i / 32] |= bits << (i % 32);
+	}
+
+	// Tests the bounds [first, last) against the views, the bits of the view v are written to masks + v * stride
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_cull_spheres
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, T, Q> const* planes, std::size_t viewCount,
+			T const* x, T const* y, T const* z, T const* radius,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			for(std::size_t i = first; i < last; ++i)
+			for(std::size_t v = 0; v < viewCount; ++v)
+			{
+				vec<4, T, Q> const* Plane = planes + v * 6;
+
+				bool Outside = false;
+				for(length_t p = 0; p < 6; ++p)
+					Outside = Outside || Plane[p].x * x[i] + Plane[p].y * y[i] + Plane[p].z * z[i] + Plane[p].w + radius[i] < static_cast<T>(0);
+
+				cull_write_bits(masks + v * stride, i, Outside ? 0u : 1u);
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_cull_boxes
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, T, Q> const* planes, std::size_t viewCount,
+			T const* minX, T const* minY, T const* minZ, T const* maxX, T const* maxY, T const* maxZ,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			for(std::size_t i = first; i < last; ++i)
+			{
+				// Twice the center and the extents, the test is the center distance plus the projected extents, scaled by 2
+				T const SumX = maxX[i] + minX[i], SumY = maxY[i] + minY[i], SumZ = maxZ[i] + minZ[i];
+				T const DiffX = maxX[i] - minX[i], DiffY = maxY[i] - minY[i], DiffZ = maxZ[i] - minZ[i];
+
+				for(std::size_t v = 0; v < viewCount; ++v)
+				{
+					vec<4, T, Q> const* Plane = planes + v * 6;
+
+					bool Outside = false;
+					for(length_t p = 0; p < 6; ++p)
+						Outside = Outside ||
+							Plane[p].x * SumX + Plane[p].y * SumY + Plane[p].z * SumZ +
+							glm::abs(Plane[p].x) * DiffX + glm::abs(Plane[p].y) * DiffY + glm::abs(Plane[p].z) * DiffZ +
+							(Plane[p].w + Plane[p].w) < static_cast<T>(0);
+
+					cull_write_bits(masks + v * stride, i, Outside ? 0u : 1u);
+				}
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		detail::frustum_planes(m, vec<4, T, Q>(m[0][2], m[1][2], m[2][2], m[3][2]), planes);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		detail::frustum_planes(m, vec<4, T, Q>(m[0][3] + m[0][2], m[1][3] + m[1][2], m[2][3] + m[2][2], m[3][3] + m[3][2]), planes);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			frustumPlanesZO(m, planes);
+#		else
+			frustumPlanesNO(m, planes);
+#		endif
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumSphere(vec<4, T, Q> const planes[6], vec<3, T, Q> const& center, T radius)
+	{
+		for(length_t p = 0; p < 6; ++p)
+			if(glm::dot(vec<3, T, Q>(planes[p]), center) + planes[p].w < -radius)
+				return false;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumBox(vec<4, T, Q> const planes[6], vec<3, T, Q> const& minCorner, vec<3, T, Q> const& maxCorner)
+	{
+		vec<3, T, Q> const Center((maxCorner + minCorner) * static_cast<T>(0.5));
+		vec<3, T, Q> const Extent((maxCorner - minCorner) * static_cast<T>(0.5));
+
+		for(length_t p = 0; p < 6; ++p)
+		{
+			vec<3, T, Q> const Normal(planes[p]);
+			if(glm::dot(Normal, Center) + glm::dot(glm::abs(Normal), Extent) + planes[p].w < static_cast<T>(0))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void cullSpheres(
+		vec<4, T, Q> const* planes, std::size_t viewCount,
+		T const* x, T const* y, T const* z, T const* radius, std::size_t count, uint32* masks)
+	{
+		detail::compute_cull_spheres<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			planes, viewCount, x, y, z, radius, 0, count, masks, (count + 31) / 32);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void cullBoxes(
+		vec<4, T, Q> const* planes, std::size_t viewCount,
+		T const* minX, T const* minY, T const* minZ, T const* maxX, T const* maxY, T const* maxZ, std::size_t count, uint32* masks)
+	{
+		detail::compute_cull_boxes<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			planes, viewCount, minX, minY, minZ, maxX, maxY, maxZ, 0, count, masks, (count + 31) / 32);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "frustum_culling_simd.inl"
+#endif
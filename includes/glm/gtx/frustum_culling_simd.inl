@@ -0,0 +1,346 @@
+/// @ref gtx_frustum_culling
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	// The SIMD paths test the bounds by words of 32: the planes of a view are splat once per word and each word of mask is stored once.
+	// The bounds of the last partial word use the generic path.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Splats the 6 planes of a view, 4 values per plane: x, y, z and w
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_spheres4(vec<4, float, Q> const* Plane, glm_vec4 P[24])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 4 + 0] = _mm_set1_ps(Plane[p].x);
+			P[p * 4 + 1] = _mm_set1_ps(Plane[p].y);
+			P[p * 4 + 2] = _mm_set1_ps(Plane[p].z);
+			P[p * 4 + 3] = _mm_set1_ps(Plane[p].w);
+		}
+	}
+
+	// Splats the 6 planes of a view, 7 values per plane: x, y, z, abs(x), abs(y), abs(z) and 2 * w
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_boxes4(vec<4, float, Q> const* Plane, glm_vec4 P[42])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 7 + 0] = _mm_set1_ps(Plane[p].x);
+			P[p * 7 + 1] = _mm_set1_ps(Plane[p].y);
+			P[p * 7 + 2] = _mm_set1_ps(Plane[p].z);
+			P[p * 7 + 3] = glm_vec4_abs(P[p * 7 + 0]);
+			P[p * 7 + 4] = glm_vec4_abs(P[p * 7 + 1]);
+			P[p * 7 + 5] = glm_vec4_abs(P[p * 7 + 2]);
+			P[p * 7 + 6] = _mm_set1_ps(Plane[p].w + Plane[p].w);
+		}
+	}
+
+	// Returns the visibility bits of 4 spheres
+	GLM_FUNC_QUALIFIER uint32 cull_spheres4(glm_vec4 const P[24], float const* x, float const* y, float const* z, float const* radius)
+	{
+		glm_vec4 const X = _mm_loadu_ps(x);
+		glm_vec4 const Y = _mm_loadu_ps(y);
+		glm_vec4 const Z = _mm_loadu_ps(z);
+		glm_vec4 const R = _mm_loadu_ps(radius);
+		glm_vec4 const Zero = _mm_setzero_ps();
+
+		glm_vec4 Outside = Zero;
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec4 const* N = P + p * 4;
+			glm_vec4 const D = glm_vec4_fma(N[0], X, glm_vec4_fma(N[1], Y, glm_vec4_fma(N[2], Z, _mm_add_ps(N[3], R))));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(D, Zero));
+		}
+		return static_cast<uint32>(~_mm_movemask_ps(Outside) & 0xF);
+	}
+
+	// Returns the visibility bits of 4 boxes
+	GLM_FUNC_QUALIFIER uint32 cull_boxes4(glm_vec4 const P[42], float const* const Bounds[6], std::size_t i)
+	{
+		glm_vec4 const MinX = _mm_loadu_ps(Bounds[0] + i), MaxX = _mm_loadu_ps(Bounds[3] + i);
+		glm_vec4 const MinY = _mm_loadu_ps(Bounds[1] + i), MaxY = _mm_loadu_ps(Bounds[4] + i);
+		glm_vec4 const MinZ = _mm_loadu_ps(Bounds[2] + i), MaxZ = _mm_loadu_ps(Bounds[5] + i);
+		glm_vec4 const SumX = _mm_add_ps(MaxX, MinX), SumY = _mm_add_ps(MaxY, MinY), SumZ = _mm_add_ps(MaxZ, MinZ);
+		glm_vec4 const DiffX = _mm_sub_ps(MaxX, MinX), DiffY = _mm_sub_ps(MaxY, MinY), DiffZ = _mm_sub_ps(MaxZ, MinZ);
+		glm_vec4 const Zero = _mm_setzero_ps();
+
+		glm_vec4 Outside = Zero;
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec4 const* N = P + p * 7;
+			glm_vec4 const C = glm_vec4_fma(N[0], SumX, glm_vec4_fma(N[1], SumY, glm_vec4_fma(N[2], SumZ, N[6])));
+			glm_vec4 const D = glm_vec4_fma(N[3], DiffX, glm_vec4_fma(N[4], DiffY, glm_vec4_fma(N[5], DiffZ, C)));
+			Outside = _mm_or_ps(Outside, _mm_cmplt_ps(D, Zero));
+		}
+		return static_cast<uint32>(~_mm_movemask_ps(Outside) & 0xF);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_spheres8(vec<4, float, Q> const* Plane, glm_vec8 P[24])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 4 + 0] = _mm256_set1_ps(Plane[p].x);
+			P[p * 4 + 1] = _mm256_set1_ps(Plane[p].y);
+			P[p * 4 + 2] = _mm256_set1_ps(Plane[p].z);
+			P[p * 4 + 3] = _mm256_set1_ps(Plane[p].w);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_boxes8(vec<4, float, Q> const* Plane, glm_vec8 P[42])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 7 + 0] = _mm256_set1_ps(Plane[p].x);
+			P[p * 7 + 1] = _mm256_set1_ps(Plane[p].y);
+			P[p * 7 + 2] = _mm256_set1_ps(Plane[p].z);
+			P[p * 7 + 3] = _mm256_set1_ps(glm::abs(Plane[p].x));
+			P[p * 7 + 4] = _mm256_set1_ps(glm::abs(Plane[p].y));
+			P[p * 7 + 5] = _mm256_set1_ps(glm::abs(Plane[p].z));
+			P[p * 7 + 6] = _mm256_set1_ps(Plane[p].w + Plane[p].w);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER uint32 cull_spheres8(glm_vec8 const P[24], float const* x, float const* y, float const* z, float const* radius)
+	{
+		glm_vec8 const X = _mm256_loadu_ps(x);
+		glm_vec8 const Y = _mm256_loadu_ps(y);
+		glm_vec8 const Z = _mm256_loadu_ps(z);
+		glm_vec8 const R = _mm256_loadu_ps(radius);
+		glm_vec8 const Zero = _mm256_setzero_ps();
+
+		glm_vec8 Outside = Zero;
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec8 const* N = P + p * 4;
+			glm_vec8 const D = glm_vec8_fma(N[0], X, glm_vec8_fma(N[1], Y, glm_vec8_fma(N[2], Z, _mm256_add_ps(N[3], R))));
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(D, Zero, _CMP_LT_OQ));
+		}
+		return static_cast<uint32>(~_mm256_movemask_ps(Outside) & 0xFF);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 cull_boxes8(glm_vec8 const P[42], float const* const Bounds[6], std::size_t i)
+	{
+		glm_vec8 const MinX = _mm256_loadu_ps(Bounds[0] + i), MaxX = _mm256_loadu_ps(Bounds[3] + i);
+		glm_vec8 const MinY = _mm256_loadu_ps(Bounds[1] + i), MaxY = _mm256_loadu_ps(Bounds[4] + i);
+		glm_vec8 const MinZ = _mm256_loadu_ps(Bounds[2] + i), MaxZ = _mm256_loadu_ps(Bounds[5] + i);
+		glm_vec8 const SumX = _mm256_add_ps(MaxX, MinX), SumY = _mm256_add_ps(MaxY, MinY), SumZ = _mm256_add_ps(MaxZ, MinZ);
+		glm_vec8 const DiffX = _mm256_sub_ps(MaxX, MinX), DiffY = _mm256_sub_ps(MaxY, MinY), DiffZ = _mm256_sub_ps(MaxZ, MinZ);
+		glm_vec8 const Zero = _mm256_setzero_ps();
+
+		glm_vec8 Outside = Zero;
+		for(length_t p = 0; p < 6; ++p)
+		{
+			glm_vec8 const* N = P + p * 7;
+			glm_vec8 const C = glm_vec8_fma(N[0], SumX, glm_vec8_fma(N[1], SumY, glm_vec8_fma(N[2], SumZ, N[6])));
+			glm_vec8 const D = glm_vec8_fma(N[3], DiffX, glm_vec8_fma(N[4], DiffY, glm_vec8_fma(N[5], DiffZ, C)));
+			Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(D, Zero, _CMP_LT_OQ));
+		}
+		return static_cast<uint32>(~_mm256_movemask_ps(Outside) & 0xFF);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<qualifier Q>
+	struct compute_cull_spheres<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, float, Q> const* planes, std::size_t viewCount,
+			float const* x, float const* y, float const* z, float const* radius,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			assert(first % 32 == 0);
+
+			std::size_t i = first;
+			for(; i + 32 <= last; i += 32)
+			for(std::size_t v = 0; v < viewCount; ++v)
+			{
+				uint32 Word = 0;
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+					glm_vec8 P[24];
+					cull_splat_spheres8(planes + v * 6, P);
+					for(std::size_t b = 0; b < 32; b += 8)
+						Word |= cull_spheres8(P, x + i + b, y + i + b, z + i + b, radius + i + b) << b;
+#				else
+					glm_vec4 P[24];
+					cull_splat_spheres4(planes + v * 6, P);
+					for(std::size_t b = 0; b < 32; b += 4)
+						Word |= cull_spheres4(P, x + i + b, y + i + b, z + i + b, radius + i + b) << b;
+#				endif
+				masks[v * stride + i / 32] = Word;
+			}
+
+			compute_cull_spheres<float, Q, false>::call(planes, viewCount, x, y, z, radius, i, last, masks, stride);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cull_boxes<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, float, Q> const* planes, std::size_t viewCount,
+			float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			assert(first % 32 == 0);
+
+			float const* const Bounds[6] = {minX, minY, minZ, maxX, maxY, maxZ};
+
+			std::size_t i = first;
+			for(; i + 32 <= last; i += 32)
+			for(std::size_t v = 0; v < viewCount; ++v)
+			{
+				uint32 Word = 0;
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+					glm_vec8 P[42];
+					cull_splat_boxes8(planes + v * 6, P);
+					for(std::size_t b = 0; b < 32; b += 8)
+						Word |= cull_boxes8(P, Bounds, i + b) << b;
+#				else
+					glm_vec4 P[42];
+					cull_splat_boxes4(planes + v * 6, P);
+					for(std::size_t b = 0; b < 32; b += 4)
+						Word |= cull_boxes4(P, Bounds, i + b) << b;
+#				endif
+				masks[v * stride + i / 32] = Word;
+			}
+
+			compute_cull_boxes<float, Q, false>::call(planes, viewCount, minX, minY, minZ, maxX, maxY, maxZ, i, last, masks, stride);
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_spheres4(vec<4, float, Q> const* Plane, float32x4_t P[24])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 4 + 0] = vdupq_n_f32(Plane[p].x);
+			P[p * 4 + 1] = vdupq_n_f32(Plane[p].y);
+			P[p * 4 + 2] = vdupq_n_f32(Plane[p].z);
+			P[p * 4 + 3] = vdupq_n_f32(Plane[p].w);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void cull_splat_boxes4(vec<4, float, Q> const* Plane, float32x4_t P[42])
+	{
+		for(length_t p = 0; p < 6; ++p)
+		{
+			P[p * 7 + 0] = vdupq_n_f32(Plane[p].x);
+			P[p * 7 + 1] = vdupq_n_f32(Plane[p].y);
+			P[p * 7 + 2] = vdupq_n_f32(Plane[p].z);
+			P[p * 7 + 3] = vabsq_f32(P[p * 7 + 0]);
+			P[p * 7 + 4] = vabsq_f32(P[p * 7 + 1]);
+			P[p * 7 + 5] = vabsq_f32(P[p * 7 + 2]);
+			P[p * 7 + 6] = vdupq_n_f32(Plane[p].w + Plane[p].w);
+		}
+	}
+
+	// Bit i of the result is set if the lane i of Outside is clear
+	GLM_FUNC_QUALIFIER uint32 cull_visible_bits(uint32x4_t Outside)
+	{
+		uint32 const Bits[4] = {1u, 2u, 4u, 8u};
+		return vaddvq_u32(vbicq_u32(vld1q_u32(Bits), Outside));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 cull_spheres4(float32x4_t const P[24], float const* x, float const* y, float const* z, float const* radius)
+	{
+		float32x4_t const X = vld1q_f32(x);
+		float32x4_t const Y = vld1q_f32(y);
+		float32x4_t const Z = vld1q_f32(z);
+		float32x4_t const R = vld1q_f32(radius);
+		float32x4_t const Zero = vdupq_n_f32(0.0f);
+
+		uint32x4_t Outside = vdupq_n_u32(0);
+		for(length_t p = 0; p < 6; ++p)
+		{
+			float32x4_t const* N = P + p * 4;
+			float32x4_t const D = vfmaq_f32(vfmaq_f32(vfmaq_f32(vaddq_f32(N[3], R), N[2], Z), N[1], Y), N[0], X);
+			Outside = vorrq_u32(Outside, vcltq_f32(D, Zero));
+		}
+		return cull_visible_bits(Outside);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 cull_boxes4(float32x4_t const P[42], float const* const Bounds[6], std::size_t i)
+	{
+		float32x4_t const MinX = vld1q_f32(Bounds[0] + i), MaxX = vld1q_f32(Bounds[3] + i);
+		float32x4_t const MinY = vld1q_f32(Bounds[1] + i), MaxY = vld1q_f32(Bounds[4] + i);
+		float32x4_t const MinZ = vld1q_f32(Bounds[2] + i), MaxZ = vld1q_f32(Bounds[5] + i);
+		float32x4_t const SumX = vaddq_f32(MaxX, MinX), SumY = vaddq_f32(MaxY, MinY), SumZ = vaddq_f32(MaxZ, MinZ);
+		float32x4_t const DiffX = vsubq_f32(MaxX, MinX), DiffY = vsubq_f32(MaxY, MinY), DiffZ = vsubq_f32(MaxZ, MinZ);
+		float32x4_t const Zero = vdupq_n_f32(0.0f);
+
+		uint32x4_t Outside = vdupq_n_u32(0);
+		for(length_t p = 0; p < 6; ++p)
+		{
+			float32x4_t const* N = P + p * 7;
+			float32x4_t const C = vfmaq_f32(vfmaq_f32(vfmaq_f32(N[6], N[2], SumZ), N[1], SumY), N[0], SumX);
+			float32x4_t const D = vfmaq_f32(vfmaq_f32(vfmaq_f32(C, N[5], DiffZ), N[4], DiffY), N[3], DiffX);
+			Outside = vorrq_u32(Outside, vcltq_f32(D, Zero));
+		}
+		return cull_visible_bits(Outside);
+	}
+
+	template<qualifier Q>
+	struct compute_cull_spheres<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, float, Q> const* planes, std::size_t viewCount,
+			float const* x, float const* y, float const* z, float const* radius,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			assert(first % 32 == 0);
+
+			std::size_t i = first;
+			for(; i + 32 <= last; i += 32)
+			for(std::size_t v = 0; v < viewCount; ++v)
+			{
+				float32x4_t P[24];
+				cull_splat_spheres4(planes + v * 6, P);
+
+				uint32 Word = 0;
+				for(std::size_t b = 0; b < 32; b += 4)
+					Word |= cull_spheres4(P, x + i + b, y + i + b, z + i + b, radius + i + b) << b;
+				masks[v * stride + i / 32] = Word;
+			}
+
+			compute_cull_spheres<float, Q, false>::call(planes, viewCount, x, y, z, radius, i, last, masks, stride);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cull_boxes<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			vec<4, float, Q> const* planes, std::size_t viewCount,
+			float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ,
+			std::size_t first, std::size_t last, uint32* masks, std::size_t stride)
+		{
+			assert(first % 32 == 0);
+
+			float const* const Bounds[6] = {minX, minY, minZ, maxX, maxY, maxZ};
+
+			std::size_t i = first;
+			for(; i + 32 <= last; i += 32)
+			for(std::size_t v = 0; v < viewCount; ++v)
+			{
+				float32x4_t P[42];
+				cull_splat_boxes4(planes + v * 6, P);
+
+				uint32 Word = 0;
+				for(std::size_t b = 0; b < 32; b += 4)
+					Word |= cull_boxes4(P, Bounds, i + b) << b;
+				masks[v * stride + i / 32] = Word;
+			}
+
+			compute_cull_boxes<float, Q, false>::call(planes, viewCount, minX, minY, minZ, maxX, maxY, maxZ, i, last, masks, stride);
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
@@ -9,6 +9,13 @@
 /// Include <glm/gtx/hash.hpp> to use the features of this extension.
 ///
 /// Add std::hash support for glm types
+///
+/// The values are hashed from the bits of their components, read as 64 bits words: each word is mixed in
+/// with a 32 x 32 bits multiplication, an operation of SSE2, AVX2 and NEON, and the sum of the words is finalized with the avalanche of xxh3.
+/// Floating-point components are canonicalized first: -0 hashes as 0, and every NaN as the same quiet NaN,
+/// so that values equal for operator== have the same hash.
+/// The hashes are the same on every platform and with every instruction set. std::hash returns them truncated to size_t.
+/// The std::hash specializations require C++11 standard library support, hashValue and hashArray don't.
 
 #pragma once
 
@@ -40,11 +47,43 @@
 #include "../mat4x3.hpp"
 #include "../mat4x4.hpp"
 
-#if __cplusplus < 201103L
-#pragma message("GLM_GTX_hash requires C++11 standard library support")
-#endif
+#include <cstddef>
 
-#if GLM_LANG & GLM_LANG_CXX11
+namespace glm
+{
+	/// @addtogroup gtx_hash
+	/// @{
+
+	/// Returns the hash of a vector.
+	/// @see gtx_hash
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 hashValue(vec<L, T, Q> const& v, uint64 seed = 0);
+
+	/// Returns the hash of a quaternion.
+	/// @see gtx_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 hashValue(qua<T, Q> const& q, uint64 seed = 0);
+
+	/// Returns the hash of a dual quaternion.
+	/// @see gtx_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 hashValue(tdualquat<T, Q> const& q, uint64 seed = 0);
+
+	/// Returns the hash of a matrix.
+	/// @see gtx_hash
+	template<length_t C, length_t R, typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 hashValue(mat<C, R, T, Q> const& m, uint64 seed = 0);
+
+	/// Computes out[i] = hashValue(in[i], seed) for i in [0, count).
+	/// The hashes of vectors of float, int and uint are computed 2 at a time with SSE2 or NEON, 4 with AVX2.
+	/// @see gtx_hash
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void hashArray(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 seed = 0);
+
+	/// @}
+}//namespace glm
+
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
 #define GLM_GTX_hash 1
 #include <functional>
 
@@ -141,6 +180,6 @@ namespace std
 	};
 } // namespace std
 
-#include "hash.inl"
+#endif //GLM_LANG & GLM_LANG_CXX11_FLAG
 
-#endif //GLM_LANG & GLM_LANG_CXX11
+#include "hash.inl"
@@ -1,175 +1,297 @@
 /// @ref gtx_hash
 
+#include <limits>
+
 namespace glm {
 namespace detail
 {
-	GLM_INLINE void hash_combine(size_t &seed, size_t hash)
+	// Bits of a component, a 32 bits word for the components of 32 bits or less, a 64 bits word otherwise.
+	// Floating-point types other than float and double are hashed as double, which keeps equal values with the same hash.
+	template<typename T, bool isInteger = std::numeric_limits<T>::is_integer, bool isSmall = sizeof(T) <= 4>
+	struct hash_component;
+
+	template<typename T>
+	struct hash_component<T, true, true>
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static type call(T x)
+		{
+			return static_cast<uint32>(x);
+		}
+	};
+
+	template<typename T>
+	struct hash_component<T, true, false>
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static type call(T x)
+		{
+			return static_cast<uint64>(x);
+		}
+	};
+
+	template<>
+	struct hash_component<float, false, true>
+	{
+		typedef uint32 type;
+
+		GLM_FUNC_QUALIFIER static type call(float x)
+		{
+			union
+			{
+				float in;
+				uint32 out;
+			} u;
+
+			u.in = x;
+
+			// -0 == 0 and NaN != NaN: -0 hashes as 0 and every NaN as the default quiet NaN
+			uint32 const Abs = u.out & 0x7FFFFFFFu;
+			return Abs > 0x7F800000u ? 0x7FC00000u : (Abs == 0u ? 0u : u.out);
+		}
+	};
+
+	template<>
+	struct hash_component<double, false, false>
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static type call(double x)
+		{
+			union
+			{
+				double in;
+				uint64 out;
+			} u;
+
+			u.in = x;
+
+			uint64 const Abs = u.out & static_cast<uint64>(0x7FFFFFFFFFFFFFFFull);
+			return Abs > static_cast<uint64>(0x7FF0000000000000ull) ? static_cast<uint64>(0x7FF8000000000000ull) : (Abs == 0 ? static_cast<uint64>(0) : u.out);
+		}
+	};
+
+	template<typename T, bool isInteger, bool isSmall>
+	struct hash_component
+	{
+		typedef uint64 type;
+
+		GLM_FUNC_QUALIFIER static type call(T x)
+		{
+			return hash_component<double>::call(static_cast<double>(x));
+		}
+	};
+
+	// The word i is xored with its key before the multiplication of its 32 bits halves, keys of the seed and of the position of the word
+	GLM_FUNC_QUALIFIER uint64 hash_key(length_t i, uint64 Seed)
+	{
+		return Seed + static_cast<uint64>(i + 1) * static_cast<uint64>(0x9E3779B97F4A7C15ull);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_start(length_t Bytes)
+	{
+		return static_cast<uint64>(Bytes) * static_cast<uint64>(0x9E3779B185EBCA87ull);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_accumulate(uint64 Acc, uint64 Word, uint64 Key)
+	{
+		uint64 const k = Word ^ Key;
+		return Acc + Word + (k & static_cast<uint64>(0xFFFFFFFFull)) * (k >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER uint64 hash_avalanche(uint64 h)
+	{
+		h ^= h >> 37;
+		h *= static_cast<uint64>(0x165667919E3779F9ull);
+		h ^= h >> 32;
+		return h;
+	}
+
+	// Accumulates the words of v, the first one being the word First of the hashed value, and the hash starts from the size of the hashed bits
+	template<length_t L, typename T, qualifier Q, bool isSmall = sizeof(typename hash_component<T>::type) == 4>
+	struct compute_hash_words
+	{
+		static length_t const count = L;
+		static length_t const bytes = L * 8;
+
+		GLM_FUNC_QUALIFIER static uint64 call(vec<L, T, Q> const& v, uint64 Acc, length_t First, uint64 Seed)
+		{
+			for(length_t i = 0; i < L; ++i)
+				Acc = hash_accumulate(Acc, hash_component<T>::call(v[i]), hash_key(First + i, Seed));
+			return Acc;
+		}
+	};
+
+	// Components of 32 bits or less are hashed by pairs
+	template<length_t L, typename T, qualifier Q>
+	struct compute_hash_words<L, T, Q, true>
+	{
+		static length_t const count = (L + 1) / 2;
+		static length_t const bytes = L * 4;
+
+		GLM_FUNC_QUALIFIER static uint64 call(vec<L, T, Q> const& v, uint64 Acc, length_t First, uint64 Seed)
+		{
+			for(length_t i = 0; i + 1 < L; i += 2)
+			{
+				uint64 const Word = static_cast<uint64>(hash_component<T>::call(v[i])) | (static_cast<uint64>(hash_component<T>::call(v[i + 1])) << 32);
+				Acc = hash_accumulate(Acc, Word, hash_key(First + i / 2, Seed));
+			}
+			if(L % 2)
+				Acc = hash_accumulate(Acc, static_cast<uint64>(hash_component<T>::call(v[L - 1])), hash_key(First + L / 2, Seed));
+			return Acc;
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_hashArray
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 Seed)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = hashValue(in[i], Seed);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hashValue(vec<L, T, Q> const& v, uint64 seed)
+	{
+		typedef detail::compute_hash_words<L, T, Q> words;
+		return detail::hash_avalanche(words::call(v, detail::hash_start(words::bytes), 0, seed));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hashValue(qua<T, Q> const& q, uint64 seed)
+	{
+		return hashValue(vec<4, T, Q>(q[0], q[1], q[2], q[3]), seed);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hashValue(tdualquat<T, Q> const& q, uint64 seed)
+	{
+		typedef detail::compute_hash_words<4, T, Q> words;
+
+		uint64 Acc = detail::hash_start(words::bytes * 2);
+		Acc = words::call(vec<4, T, Q>(q.real[0], q.real[1], q.real[2], q.real[3]), Acc, 0, seed);
+		Acc = words::call(vec<4, T, Q>(q.dual[0], q.dual[1], q.dual[2], q.dual[3]), Acc, words::count, seed);
+		return detail::hash_avalanche(Acc);
+	}
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hashValue(mat<C, R, T, Q> const& m, uint64 seed)
 	{
-		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		seed ^= hash;
+		typedef detail::compute_hash_words<R, T, Q> words;
+
+		uint64 Acc = detail::hash_start(words::bytes * C);
+		for(length_t i = 0; i < C; ++i)
+			Acc = words::call(m[i], Acc, words::count * i, seed);
+		return detail::hash_avalanche(Acc);
 	}
-}}
 
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hashArray(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 seed)
+	{
+		detail::compute_hashArray<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, seed);
+	}
+}//namespace glm
+
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
 namespace std
 {
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<1, T, Q> >::operator()(glm::vec<1, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<2, T, Q> >::operator()(glm::vec<2, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<3, T, Q> >::operator()(glm::vec<3, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<4, T, Q> >::operator()(glm::vec<4, T, Q> const& v) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::qua<T, Q> >::operator()(glm::qua<T,Q> const& q) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(q));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tdualquat<T, Q> >::operator()(glm::tdualquat<T, Q> const& q) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::qua<T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(q.real));
-		glm::detail::hash_combine(seed, hasher(q.dual));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(q));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 2, T, Q> >::operator()(glm::mat<2, 2, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 3, T, Q> >::operator()(glm::mat<2, 3, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<2, 4, T, Q> >::operator()(glm::mat<2, 4, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 2, T, Q> >::operator()(glm::mat<3, 2, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 3, T, Q> >::operator()(glm::mat<3, 3, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<3, 4, T, Q> >::operator()(glm::mat<3, 4, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 2, T,Q> >::operator()(glm::mat<4, 2, T,Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<2, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 3, T,Q> >::operator()(glm::mat<4, 3, T,Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<3, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::mat<4, 4, T,Q> >::operator()(glm::mat<4, 4, T, Q> const& m) const GLM_NOEXCEPT
 	{
-		size_t seed = 0;
-		hash<glm::vec<4, T, Q> > hasher;
-		glm::detail::hash_combine(seed, hasher(m[0]));
-		glm::detail::hash_combine(seed, hasher(m[1]));
-		glm::detail::hash_combine(seed, hasher(m[2]));
-		glm::detail::hash_combine(seed, hasher(m[3]));
-		return seed;
+		return static_cast<size_t>(glm::hashValue(m));
 	}
 }
+#endif//GLM_LANG & GLM_LANG_CXX11_FLAG
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "hash_simd.inl"
+#endif
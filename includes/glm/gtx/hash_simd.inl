@@ -0,0 +1,218 @@
+/// @ref gtx_hash
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	// The hashes are computed in 64 bits lanes, one value per lane. The multiplications by the constant of
+	// the avalanche are made of 3 multiplications of 32 x 32 bits.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The word i of a vector of 32 bits components, a 64 bits load, or a 32 bits load for the last component of an odd length
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER glm_uvec4 hash_load_word(vec<L, T, Q> const& v, length_t i)
+	{
+		if(2 * i + 1 < L)
+			return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(&v[2 * i]));
+
+		int Last;
+		memcpy(&Last, &v[2 * i], sizeof(Last));
+		return _mm_cvtsi32_si128(Last);
+	}
+
+	GLM_FUNC_QUALIFIER glm_uvec4 hash_canonical4(glm_uvec4 w)
+	{
+		glm_uvec4 const Abs = _mm_and_si128(w, _mm_set1_epi32(0x7FFFFFFF));
+		glm_uvec4 const Nan = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(0x7F800000));
+		glm_uvec4 const Zero = _mm_cmpeq_epi32(Abs, _mm_setzero_si128());
+		return _mm_or_si128(_mm_andnot_si128(_mm_or_si128(Nan, Zero), w), _mm_and_si128(Nan, _mm_set1_epi32(0x7FC00000)));
+	}
+
+	GLM_FUNC_QUALIFIER glm_uvec4 hash_accumulate2(glm_uvec4 Acc, glm_uvec4 Word, glm_uvec4 Key)
+	{
+		glm_uvec4 const k = _mm_xor_si128(Word, Key);
+		return _mm_add_epi64(Acc, _mm_add_epi64(Word, _mm_mul_epu32(k, _mm_srli_epi64(k, 32))));
+	}
+
+	GLM_FUNC_QUALIFIER glm_uvec4 hash_avalanche2(glm_uvec4 h)
+	{
+		glm_uvec4 const Lo = _mm_set1_epi32(static_cast<int>(0x9E3779F9u));
+		glm_uvec4 const Hi = _mm_set1_epi32(0x16566791);
+
+		h = _mm_xor_si128(h, _mm_srli_epi64(h, 37));
+		glm_uvec4 const Cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(h, 32), Lo), _mm_mul_epu32(h, Hi));
+		h = _mm_add_epi64(_mm_mul_epu32(h, Lo), _mm_slli_epi64(Cross, 32));
+		return _mm_xor_si128(h, _mm_srli_epi64(h, 32));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER __m256i hash_canonical8(__m256i w)
+	{
+		__m256i const Abs = _mm256_and_si256(w, _mm256_set1_epi32(0x7FFFFFFF));
+		__m256i const Nan = _mm256_cmpgt_epi32(Abs, _mm256_set1_epi32(0x7F800000));
+		__m256i const Zero = _mm256_cmpeq_epi32(Abs, _mm256_setzero_si256());
+		return _mm256_or_si256(_mm256_andnot_si256(_mm256_or_si256(Nan, Zero), w), _mm256_and_si256(Nan, _mm256_set1_epi32(0x7FC00000)));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i hash_accumulate4(__m256i Acc, __m256i Word, __m256i Key)
+	{
+		__m256i const k = _mm256_xor_si256(Word, Key);
+		return _mm256_add_epi64(Acc, _mm256_add_epi64(Word, _mm256_mul_epu32(k, _mm256_srli_epi64(k, 32))));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i hash_avalanche4(__m256i h)
+	{
+		__m256i const Lo = _mm256_set1_epi32(static_cast<int>(0x9E3779F9u));
+		__m256i const Hi = _mm256_set1_epi32(0x16566791);
+
+		h = _mm256_xor_si256(h, _mm256_srli_epi64(h, 37));
+		__m256i const Cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(h, 32), Lo), _mm256_mul_epu32(h, Hi));
+		h = _mm256_add_epi64(_mm256_mul_epu32(h, Lo), _mm256_slli_epi64(Cross, 32));
+		return _mm256_xor_si256(h, _mm256_srli_epi64(h, 32));
+	}
+
+	template<length_t L, typename T, qualifier Q, bool isFloat>
+	struct compute_hashArray32
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 Seed)
+		{
+			length_t const Words = (L + 1) / 2;
+
+			__m256i const Start = _mm256_set1_epi64x(static_cast<long long>(hash_start(L * 4)));
+			__m256i Keys[Words];
+			for(length_t i = 0; i < Words; ++i)
+				Keys[i] = _mm256_set1_epi64x(static_cast<long long>(hash_key(i, Seed)));
+
+			std::size_t j = 0;
+			for(; j + 4 <= count; j += 4)
+			{
+				__m256i Acc = Start;
+				for(length_t i = 0; i < Words; ++i)
+				{
+					__m256i Word = _mm256_inserti128_si256(_mm256_castsi128_si256(
+						_mm_unpacklo_epi64(hash_load_word(in[j + 0], i), hash_load_word(in[j + 1], i))),
+						_mm_unpacklo_epi64(hash_load_word(in[j + 2], i), hash_load_word(in[j + 3], i)), 1);
+					if(isFloat)
+						Word = hash_canonical8(Word);
+					Acc = hash_accumulate4(Acc, Word, Keys[i]);
+				}
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), hash_avalanche4(Acc));
+			}
+			for(; j < count; ++j)
+				out[j] = hashValue(in[j], Seed);
+		}
+	};
+#	else
+	template<length_t L, typename T, qualifier Q, bool isFloat>
+	struct compute_hashArray32
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 Seed)
+		{
+			length_t const Words = (L + 1) / 2;
+
+			glm_uvec4 const Start = _mm_set1_epi64x(static_cast<long long>(hash_start(L * 4)));
+			glm_uvec4 Keys[Words];
+			for(length_t i = 0; i < Words; ++i)
+				Keys[i] = _mm_set1_epi64x(static_cast<long long>(hash_key(i, Seed)));
+
+			std::size_t j = 0;
+			for(; j + 2 <= count; j += 2)
+			{
+				glm_uvec4 Acc = Start;
+				for(length_t i = 0; i < Words; ++i)
+				{
+					glm_uvec4 Word = _mm_unpacklo_epi64(hash_load_word(in[j + 0], i), hash_load_word(in[j + 1], i));
+					if(isFloat)
+						Word = hash_canonical4(Word);
+					Acc = hash_accumulate2(Acc, Word, Keys[i]);
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), hash_avalanche2(Acc));
+			}
+			for(; j < count; ++j)
+				out[j] = hashValue(in[j], Seed);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint32x2_t hash_load_word(vec<L, T, Q> const& v, length_t i)
+	{
+		uint64 Word = 0;
+		memcpy(&Word, &v[2 * i], 2 * i + 1 < L ? 8 : 4);
+		return vcreate_u32(Word);
+	}
+
+	GLM_FUNC_QUALIFIER uint32x4_t hash_canonical4(uint32x4_t w)
+	{
+		uint32x4_t const Abs = vandq_u32(w, vdupq_n_u32(0x7FFFFFFFu));
+		uint32x4_t const Nan = vcgtq_u32(Abs, vdupq_n_u32(0x7F800000u));
+		uint32x4_t const Zero = vceqq_u32(Abs, vdupq_n_u32(0u));
+		return vorrq_u32(vbicq_u32(w, vorrq_u32(Nan, Zero)), vandq_u32(Nan, vdupq_n_u32(0x7FC00000u)));
+	}
+
+	GLM_FUNC_QUALIFIER uint64x2_t hash_accumulate2(uint64x2_t Acc, uint64x2_t Word, uint64x2_t Key)
+	{
+		uint64x2_t const k = veorq_u64(Word, Key);
+		return vaddq_u64(Acc, vaddq_u64(Word, vmull_u32(vmovn_u64(k), vshrn_n_u64(k, 32))));
+	}
+
+	GLM_FUNC_QUALIFIER uint64x2_t hash_avalanche2(uint64x2_t h)
+	{
+		uint32x2_t const Lo = vdup_n_u32(0x9E3779F9u);
+		uint32x2_t const Hi = vdup_n_u32(0x16566791u);
+
+		h = veorq_u64(h, vshrq_n_u64(h, 37));
+		uint32x2_t const hLo = vmovn_u64(h);
+		uint64x2_t const Cross = vaddq_u64(vmull_u32(vshrn_n_u64(h, 32), Lo), vmull_u32(hLo, Hi));
+		h = vaddq_u64(vmull_u32(hLo, Lo), vshlq_n_u64(Cross, 32));
+		return veorq_u64(h, vshrq_n_u64(h, 32));
+	}
+
+	template<length_t L, typename T, qualifier Q, bool isFloat>
+	struct compute_hashArray32
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* in, uint64* out, std::size_t count, uint64 Seed)
+		{
+			length_t const Words = (L + 1) / 2;
+
+			uint64x2_t const Start = vdupq_n_u64(hash_start(L * 4));
+			uint64x2_t Keys[Words];
+			for(length_t i = 0; i < Words; ++i)
+				Keys[i] = vdupq_n_u64(hash_key(i, Seed));
+
+			std::size_t j = 0;
+			for(; j + 2 <= count; j += 2)
+			{
+				uint64x2_t Acc = Start;
+				for(length_t i = 0; i < Words; ++i)
+				{
+					uint32x4_t Word = vcombine_u32(hash_load_word(in[j + 0], i), hash_load_word(in[j + 1], i));
+					if(isFloat)
+						Word = hash_canonical4(Word);
+					Acc = hash_accumulate2(Acc, vreinterpretq_u64_u32(Word), Keys[i]);
+				}
+				vst1q_u32(reinterpret_cast<uint32*>(out + j), vreinterpretq_u32_u64(hash_avalanche2(Acc)));
+			}
+			for(; j < count; ++j)
+				out[j] = hashValue(in[j], Seed);
+		}
+	};
+#endif
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+	template<length_t L, qualifier Q>
+	struct compute_hashArray<L, float, Q, true> : public compute_hashArray32<L, float, Q, true>
+	{};
+
+	template<length_t L, qualifier Q>
+	struct compute_hashArray<L, int, Q, true> : public compute_hashArray32<L, int, Q, false>
+	{};
+
+	template<length_t L, qualifier Q>
+	struct compute_hashArray<L, uint, Q, true> : public compute_hashArray32<L, uint, Q, false>
+	{};
+#endif
+}//namespace detail
+}//namespace glm
@@ -3,6 +3,7 @@
 ///
 /// @see core (dependence)
 /// @see gtx_closest_point (dependence)
+/// @see gtx_soa (dependence)
 ///
 /// @defgroup gtx_intersect GLM_GTX_intersect
 /// @ingroup gtx
@@ -19,6 +20,7 @@
 #include "../glm.hpp"
 #include "../geometric.hpp"
 #include "../gtx/closest_point.hpp"
+#include "../gtx/soa.hpp"
 #include "../gtx/vector_query.hpp"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
@@ -50,6 +52,17 @@ namespace glm
 		vec<3, T, Q> const& v0, vec<3, T, Q> const& v1, vec<3, T, Q> const& v2,
 		vec<2, T, Q>& baryPosition, T& distance);
 
+	//! Compute the intersections of a ray and the W triangles (vert0[i], vert1[i], vert2[i]) stored as structures of arrays, W is at most 32.
+	//! Bit i of the returned mask is set if intersectRayTriangle returns true for the triangle i, the lanes i of baryPosition and distance
+	//! then hold its barycentric position and distance, the lanes of the triangles that are missed are undefined.
+	//! The tests are branchless and process 4 triangles at once with SSE or NEON, 8 with AVX.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_DECL uint32 intersectRayTriangles(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		soa<3, T, W> const& vert0, soa<3, T, W> const& vert1, soa<3, T, W> const& vert2,
+		soa<2, T, W>& baryPosition, soa<1, T, W>& distance);
+
 	//! Compute the intersection of a line and a triangle.
 	//! From GLM_GTX_intersect extension.
 	template<typename genType>
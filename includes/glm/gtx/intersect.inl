@@ -93,6 +93,57 @@ namespace glm
 		return true;
 	}
 
+namespace detail
+{
+	// Tests the triangle i of the structures of arrays with intersectRayTriangle
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER bool intersect_ray_triangle_lane(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		soa<3, T, W> const& vert0, soa<3, T, W> const& vert1, soa<3, T, W> const& vert2,
+		soa<2, T, W>& baryPosition, soa<1, T, W>& distance, length_t i)
+	{
+		vec<2, T, Q> Bary(static_cast<T>(0));
+		T Distance = static_cast<T>(0);
+		bool const Result = intersectRayTriangle(orig, dir,
+			vec<3, T, Q>(vert0.x[i], vert0.y[i], vert0.z[i]),
+			vec<3, T, Q>(vert1.x[i], vert1.y[i], vert1.z[i]),
+			vec<3, T, Q>(vert2.x[i], vert2.y[i], vert2.z[i]),
+			Bary, Distance);
+		baryPosition.x[i] = Bary.x;
+		baryPosition.y[i] = Bary.y;
+		distance[i] = Distance;
+		return Result;
+	}
+
+	template<typename T, qualifier Q, length_t W, bool UseSimd>
+	struct compute_intersect_ray_triangles
+	{
+		GLM_FUNC_QUALIFIER static uint32 call(
+			vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+			soa<3, T, W> const& vert0, soa<3, T, W> const& vert1, soa<3, T, W> const& vert2,
+			soa<2, T, W>& baryPosition, soa<1, T, W>& distance)
+		{
+			uint32 Result = 0;
+			for(length_t i = 0; i < W; ++i)
+				if(intersect_ray_triangle_lane(orig, dir, vert0, vert1, vert2, baryPosition, distance, i))
+					Result |= 1u << i;
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER uint32 intersectRayTriangles
+	(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		soa<3, T, W> const& vert0, soa<3, T, W> const& vert1, soa<3, T, W> const& vert2,
+		soa<2, T, W>& baryPosition, soa<1, T, W>& distance
+	)
+	{
+		GLM_STATIC_ASSERT(W <= 32, "'intersectRayTriangles' returns a mask of at most 32 triangles");
+		return detail::compute_intersect_ray_triangles<T, Q, W, GLM_CONFIG_SIMD == GLM_ENABLE>::call(orig, dir, vert0, vert1, vert2, baryPosition, distance);
+	}
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER bool intersectLineTriangle
 	(
@@ -198,3 +249,7 @@ namespace glm
 		return true;
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "intersect_simd.inl"
+#endif
@@ -0,0 +1,188 @@
+/// @ref gtx_intersect
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Operations on 4 float lanes, the comparisons return masks of all bits set or clear per lane
+	struct intersect_packet4
+	{
+		typedef glm_vec4 type;
+		static const length_t lanes = 4;
+
+		GLM_FUNC_QUALIFIER static type splat(float x) { return _mm_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type a) { _mm_storeu_ps(p, a); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type lt(type a, type b) { return _mm_cmplt_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type le(type a, type b) { return _mm_cmple_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type and_(type a, type b) { return _mm_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type or_(type a, type b) { return _mm_or_ps(a, b); }
+		// Returns the lanes of b where m is clear
+		GLM_FUNC_QUALIFIER static type andnot(type m, type b) { return _mm_andnot_ps(m, b); }
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+		GLM_FUNC_QUALIFIER static uint32 mask(type m) { return static_cast<uint32>(_mm_movemask_ps(m)); }
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Operations on 8 float lanes
+	struct intersect_packet8
+	{
+		typedef glm_vec8 type;
+		static const length_t lanes = 8;
+
+		GLM_FUNC_QUALIFIER static type splat(float x) { return _mm256_set1_ps(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return _mm256_loadu_ps(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type a) { _mm256_storeu_ps(p, a); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return _mm256_add_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return _mm256_div_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return _mm256_min_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return _mm256_max_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		GLM_FUNC_QUALIFIER static type le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		GLM_FUNC_QUALIFIER static type and_(type a, type b) { return _mm256_and_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type or_(type a, type b) { return _mm256_or_ps(a, b); }
+		GLM_FUNC_QUALIFIER static type andnot(type m, type b) { return _mm256_andnot_ps(m, b); }
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+		GLM_FUNC_QUALIFIER static uint32 mask(type m) { return static_cast<uint32>(_mm256_movemask_ps(m)); }
+	};
+
+	typedef intersect_packet8 intersect_packet;
+#	else
+	typedef intersect_packet4 intersect_packet;
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	// Operations on 4 float lanes, the comparison masks are kept in float registers
+	struct intersect_packet4
+	{
+		typedef float32x4_t type;
+		static const length_t lanes = 4;
+
+		GLM_FUNC_QUALIFIER static type splat(float x) { return vdupq_n_f32(x); }
+		GLM_FUNC_QUALIFIER static type load(float const* p) { return vld1q_f32(p); }
+		GLM_FUNC_QUALIFIER static void store(float* p, type a) { vst1q_f32(p, a); }
+		GLM_FUNC_QUALIFIER static type add(type a, type b) { return vaddq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type sub(type a, type b) { return vsubq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type mul(type a, type b) { return vmulq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type div(type a, type b) { return vdivq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type min(type a, type b) { return vminq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type max(type a, type b) { return vmaxq_f32(a, b); }
+		GLM_FUNC_QUALIFIER static type lt(type a, type b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+		GLM_FUNC_QUALIFIER static type le(type a, type b) { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+		GLM_FUNC_QUALIFIER static type and_(type a, type b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+		GLM_FUNC_QUALIFIER static type or_(type a, type b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+		GLM_FUNC_QUALIFIER static type andnot(type m, type b) { return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(b), vreinterpretq_u32_f32(m))); }
+		GLM_FUNC_QUALIFIER static type select(type m, type a, type b) { return vbslq_f32(vreinterpretq_u32_f32(m), a, b); }
+		GLM_FUNC_QUALIFIER static uint32 mask(type m)
+		{
+			uint32 const Bits[4] = {1u, 2u, 4u, 8u};
+			return vaddvq_u32(vandq_u32(vreinterpretq_u32_f32(m), vld1q_u32(Bits)));
+		}
+	};
+
+	typedef intersect_packet4 intersect_packet;
+#endif
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+	// Möller-Trumbore on lanes of rays and triangles, with the operations of intersectRayTriangle in the same order.
+	// Returns the mask of the lanes where intersectRayTriangle returns true, u, v and distance are computed for all the lanes.
+	template<typename P>
+	GLM_FUNC_QUALIFIER typename P::type intersect_ray_triangle_packet(
+		typename P::type const Orig[3], typename P::type const Dir[3],
+		typename P::type const Vert0[3], typename P::type const Edge1[3], typename P::type const Edge2[3],
+		typename P::type& u, typename P::type& v, typename P::type& distance)
+	{
+		typedef typename P::type V;
+		V const Zero = P::splat(0.0f);
+
+		// p = cross(dir, edge2), det = dot(edge1, p)
+		V const Px = P::sub(P::mul(Dir[1], Edge2[2]), P::mul(Edge2[1], Dir[2]));
+		V const Py = P::sub(P::mul(Dir[2], Edge2[0]), P::mul(Edge2[2], Dir[0]));
+		V const Pz = P::sub(P::mul(Dir[0], Edge2[1]), P::mul(Edge2[0], Dir[1]));
+		V const Det = P::add(P::add(P::mul(Edge1[0], Px), P::mul(Edge1[1], Py)), P::mul(Edge1[2], Pz));
+
+		// dist = orig - vert0, u = dot(dist, p)
+		V const Sx = P::sub(Orig[0], Vert0[0]);
+		V const Sy = P::sub(Orig[1], Vert0[1]);
+		V const Sz = P::sub(Orig[2], Vert0[2]);
+		V const Bu = P::add(P::add(P::mul(Sx, Px), P::mul(Sy, Py)), P::mul(Sz, Pz));
+
+		// q = cross(dist, edge1), v = dot(dir, q)
+		V const Qx = P::sub(P::mul(Sy, Edge1[2]), P::mul(Edge1[1], Sz));
+		V const Qy = P::sub(P::mul(Sz, Edge1[0]), P::mul(Edge1[2], Sx));
+		V const Qz = P::sub(P::mul(Sx, Edge1[1]), P::mul(Edge1[0], Sy));
+		V const Bv = P::add(P::add(P::mul(Dir[0], Qx), P::mul(Dir[1], Qy)), P::mul(Dir[2], Qz));
+		V const Buv = P::add(Bu, Bv);
+
+		// Front faces: 0 <= u <= det, 0 <= v, u + v <= det; back faces: det <= u <= 0, v <= 0, det <= u + v
+		V const Front = P::and_(P::and_(P::lt(Zero, Det), P::and_(P::le(Zero, Bu), P::le(Bu, Det))), P::and_(P::le(Zero, Bv), P::le(Buv, Det)));
+		V const Back = P::and_(P::and_(P::lt(Det, Zero), P::and_(P::le(Bu, Zero), P::le(Det, Bu))), P::and_(P::le(Bv, Zero), P::le(Det, Buv)));
+
+		V const InvDet = P::div(P::splat(1.0f), Det);
+		u = P::mul(Bu, InvDet);
+		v = P::mul(Bv, InvDet);
+		distance = P::mul(P::add(P::add(P::mul(Edge2[0], Qx), P::mul(Edge2[1], Qy)), P::mul(Edge2[2], Qz)), InvDet);
+		return P::or_(Front, Back);
+	}
+
+	// Tests the ray against the triangles by packets of the widest lanes, then of 4 lanes, the remaining triangles are tested one by one
+	template<qualifier Q, length_t W>
+	struct compute_intersect_ray_triangles<float, Q, W, true>
+	{
+		template<typename P>
+		GLM_FUNC_QUALIFIER static uint32 packets(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			soa<3, float, W> const& vert0, soa<3, float, W> const& vert1, soa<3, float, W> const& vert2,
+			soa<2, float, W>& baryPosition, soa<1, float, W>& distance, length_t& i)
+		{
+			typedef typename P::type V;
+
+			V const Orig[3] = {P::splat(orig.x), P::splat(orig.y), P::splat(orig.z)};
+			V const Dir[3] = {P::splat(dir.x), P::splat(dir.y), P::splat(dir.z)};
+
+			uint32 Result = 0;
+			for(; i + P::lanes <= W; i += P::lanes)
+			{
+				V const Vert0[3] = {P::load(&vert0.x.data[i]), P::load(&vert0.y.data[i]), P::load(&vert0.z.data[i])};
+				V const Edge1[3] = {P::sub(P::load(&vert1.x.data[i]), Vert0[0]), P::sub(P::load(&vert1.y.data[i]), Vert0[1]), P::sub(P::load(&vert1.z.data[i]), Vert0[2])};
+				V const Edge2[3] = {P::sub(P::load(&vert2.x.data[i]), Vert0[0]), P::sub(P::load(&vert2.y.data[i]), Vert0[1]), P::sub(P::load(&vert2.z.data[i]), Vert0[2])};
+
+				V BaryU, BaryV, Distance;
+				V const Hit = intersect_ray_triangle_packet<P>(Orig, Dir, Vert0, Edge1, Edge2, BaryU, BaryV, Distance);
+				P::store(&baryPosition.x.data[i], BaryU);
+				P::store(&baryPosition.y.data[i], BaryV);
+				P::store(&distance.data[i], Distance);
+				Result |= P::mask(Hit) << i;
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static uint32 call(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			soa<3, float, W> const& vert0, soa<3, float, W> const& vert1, soa<3, float, W> const& vert2,
+			soa<2, float, W>& baryPosition, soa<1, float, W>& distance)
+		{
+			length_t i = 0;
+			uint32 Result = packets<intersect_packet>(orig, dir, vert0, vert1, vert2, baryPosition, distance, i);
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				Result |= packets<intersect_packet4>(orig, dir, vert0, vert1, vert2, baryPosition, distance, i);
+#			endif
+			for(; i < W; ++i)
+				if(intersect_ray_triangle_lane(orig, dir, vert0, vert1, vert2, baryPosition, distance, i))
+					Result |= 1u << i;
+			return Result;
+		}
+	};
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_ARMV8_BIT)
+}//namespace detail
+}//namespace glm
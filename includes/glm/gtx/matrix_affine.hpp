@@ -0,0 +1,147 @@
+/// @ref gtx_matrix_affine
+/// @file glm/gtx/matrix_affine.hpp
+///
+/// @see core (dependence)
+/// @see gtc_matrix_inverse (dependence)
+///
+/// @defgroup gtx_matrix_affine GLM_GTX_matrix_affine
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_affine.hpp> to use the features of this extension.
+///
+/// Products of affine 4x4 matrices that skip the constant bottom row, and an affine matrix type
+/// that keeps that structure so that its products and inverses take the affine paths.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/matrix_inverse.hpp"
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_matrix_affine is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_affine
+	/// @{
+
+	/// Returns m1 * m2 where the bottom rows of both matrices are assumed to be (0, 0, 0, 1).
+	/// Only the upper 3x4 blocks are multiplied, the bottom row of the result is (0, 0, 0, 1).
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> affineMultiply(mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2);
+
+	/// 4x4 matrix whose bottom row is always (0, 0, 0, 1).
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q = defaultp>
+	struct taffine
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<4, T, Q> col_type;
+		typedef mat<4, 4, T, Q> matrix_type;
+
+		// -- Data --
+
+		mat<4, 4, T, Q> value;
+
+		// -- Component accesses --
+
+		typedef length_t length_type;
+		/// Return the count of columns of an affine matrix
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 4;}
+
+		GLM_FUNC_DECL col_type const& operator[](length_type i) const;
+
+		// -- Implicit basic constructors --
+
+		/// Left uninitialized like mat unless GLM_FORCE_CTOR_INIT is defined, in which case it is the identity.
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL GLM_CONSTEXPR taffine() GLM_DEFAULT_CTOR;
+		GLM_DEFAULTED_FUNC_DECL GLM_CONSTEXPR taffine(taffine<T, Q> const& m) GLM_DEFAULT;
+
+		// -- Explicit basic constructors --
+
+		/// Builds an affine matrix from the upper 3x4 block of m, the bottom row of m is ignored.
+		GLM_CTOR_DECL GLM_EXPLICIT taffine(mat<4, 4, T, Q> const& m);
+		GLM_CTOR_DECL taffine(mat<3, 3, T, Q> const& linear, vec<3, T, Q> const& translation);
+
+		// -- Unary arithmetic operators --
+
+		GLM_DEFAULTED_FUNC_DECL taffine<T, Q> & operator=(taffine<T, Q> const& m) GLM_DEFAULT;
+
+		GLM_FUNC_DISCARD_DECL taffine<T, Q> & operator*=(taffine<T, Q> const& m);
+	};
+
+	// -- Binary operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> operator*(taffine<T, Q> const& m1, taffine<T, Q> const& m2);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<4, T, Q> operator*(taffine<T, Q> const& m, vec<4, T, Q> const& v);
+
+	/// Transforms the point v, as vec3(m * vec4(v, 1)).
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> operator*(taffine<T, Q> const& m, vec<3, T, Q> const& v);
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator==(taffine<T, Q> const& m1, taffine<T, Q> const& m2);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator!=(taffine<T, Q> const& m1, taffine<T, Q> const& m2);
+
+	/// Creates an identity affine matrix.
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> affine_identity();
+
+	/// Returns the inverse of an affine matrix, computed with affineInverse.
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> inverse(taffine<T, Q> const& m);
+
+	/// Returns the inverse of an affine matrix made only of a rotation and a translation, computed with rigidInverse.
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL taffine<T, Q> rigidInverse(taffine<T, Q> const& m);
+
+	/// Converts an affine matrix to a 4 * 4 matrix.
+	///
+	/// @see gtx_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(taffine<T, Q> const& m);
+
+
+	/// Affine matrix of single-qualifier floating-point numbers.
+	///
+	/// @see gtx_matrix_affine
+	typedef taffine<float, defaultp>		affine_mat4;
+
+	/// Affine matrix of double-qualifier floating-point numbers.
+	///
+	/// @see gtx_matrix_affine
+	typedef taffine<double, defaultp>		daffine_mat4;
+
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	/// Affine matrix of single-qualifier floating-point numbers using SIMD registers.
+	///
+	/// @see gtx_matrix_affine
+	typedef taffine<float, aligned_highp>	aligned_affine_mat4;
+#endif
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
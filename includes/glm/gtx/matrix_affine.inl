@@ -0,0 +1,162 @@
+/// @ref gtx_matrix_affine
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_affine_mul
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2)
+		{
+			mat<4, 4, T, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+				Result[i] = m1[0] * m2[i][0] + m1[1] * m2[i][1] + m1[2] * m2[i][2];
+			Result[3] = m1[0] * m2[3][0] + m1[1] * m2[3][1] + m1[2] * m2[3][2] + m1[3];
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> affineMultiply(mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2)
+	{
+		return detail::compute_affine_mul<T, Q, detail::is_aligned<Q>::value>::call(m1, m2);
+	}
+
+	// -- Component accesses --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename taffine<T, Q>::col_type const& taffine<T, Q>::operator[](typename taffine<T, Q>::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return value[i];
+	}
+
+	// -- Implicit basic constructors --
+
+#	if GLM_CONFIG_DEFAULTED_DEFAULT_CTOR == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine()
+#			if GLM_CONFIG_CTOR_INIT == GLM_CTOR_INITIALIZER_LIST
+				: value(static_cast<T>(1))
+#			endif
+		{
+#			if GLM_CONFIG_CTOR_INIT == GLM_CTOR_INITIALISATION
+				this->value = mat<4, 4, T, Q>(static_cast<T>(1));
+#			endif
+		}
+#	endif
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_DEFAULTED_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(taffine<T, Q> const& m)
+			: value(m.value)
+		{}
+#	endif
+
+	// -- Explicit basic constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(mat<4, 4, T, Q> const& m)
+		: value(
+			col_type(vec<3, T, Q>(m[0]), static_cast<T>(0)),
+			col_type(vec<3, T, Q>(m[1]), static_cast<T>(0)),
+			col_type(vec<3, T, Q>(m[2]), static_cast<T>(0)),
+			col_type(vec<3, T, Q>(m[3]), static_cast<T>(1)))
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR taffine<T, Q>::taffine(mat<3, 3, T, Q> const& l, vec<3, T, Q> const& t)
+		: value(
+			col_type(l[0], static_cast<T>(0)),
+			col_type(l[1], static_cast<T>(0)),
+			col_type(l[2], static_cast<T>(0)),
+			col_type(t, static_cast<T>(1)))
+	{}
+
+	// -- Unary arithmetic operators --
+
+#	if GLM_CONFIG_DEFAULTED_FUNCTIONS == GLM_DISABLE
+		template<typename T, qualifier Q>
+		GLM_DEFAULTED_FUNC_QUALIFIER taffine<T, Q> & taffine<T, Q>::operator=(taffine<T, Q> const& m)
+		{
+			this->value = m.value;
+			return *this;
+		}
+#	endif
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> & taffine<T, Q>::operator*=(taffine<T, Q> const& m)
+	{
+		this->value = affineMultiply(this->value, m.value);
+		return *this;
+	}
+
+	// -- Binary operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> operator*(taffine<T, Q> const& m1, taffine<T, Q> const& m2)
+	{
+		return taffine<T, Q>(m1) *= m2;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> operator*(taffine<T, Q> const& m, vec<4, T, Q> const& v)
+	{
+		return m.value * v;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> operator*(taffine<T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return vec<3, T, Q>(m.value * vec<4, T, Q>(v, static_cast<T>(1)));
+	}
+
+	// -- Boolean operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator==(taffine<T, Q> const& m1, taffine<T, Q> const& m2)
+	{
+		return m1.value == m2.value;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator!=(taffine<T, Q> const& m1, taffine<T, Q> const& m2)
+	{
+		return m1.value != m2.value;
+	}
+
+	// -- Operations --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> affine_identity()
+	{
+		return taffine<T, Q>(mat<4, 4, T, Q>(static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> inverse(taffine<T, Q> const& m)
+	{
+		taffine<T, Q> Result;
+		Result.value = affineInverse(m.value);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER taffine<T, Q> rigidInverse(taffine<T, Q> const& m)
+	{
+		taffine<T, Q> Result;
+		Result.value = rigidInverse(m.value);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(taffine<T, Q> const& m)
+	{
+		return m.value;
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_affine_simd.inl"
+#endif
@@ -0,0 +1,48 @@
+/// @ref gtx_matrix_affine
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_affine_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			for(length_t i = 0; i < 4; ++i)
+			{
+				float32x4_t r = neon::mul_lane(m1[0].data, m2[i].data, 0);
+				r = neon::madd_lane(r, m1[1].data, m2[i].data, 1);
+				r = neon::madd_lane(r, m1[2].data, m2[i].data, 2);
+				Result[i].data = r;
+			}
+			Result[3].data = vaddq_f32(Result[3].data, m1[3].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif
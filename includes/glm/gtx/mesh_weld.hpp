@@ -0,0 +1,66 @@
+/// @ref gtx_mesh_weld
+/// @file glm/gtx/mesh_weld.hpp
+///
+/// @see core (dependence)
+/// @see gtx_spatial_hash (dependence)
+///
+/// @defgroup gtx_mesh_weld GLM_GTX_mesh_weld
+/// @ingroup gtx
+///
+/// Include <glm/gtx/mesh_weld.hpp> to use the features of this extension.
+///
+/// Welding of the vertices of a mesh: the vertices whose attributes are equal within an epsilon are merged.
+/// Two vertices are equal within epsilon when |a - b| <= epsilon for every component of every attribute,
+/// so that an epsilon of 0 removes the exact duplicates.
+///
+/// The vertices are processed in order: a vertex is merged into the first earlier vertex that was kept and is equal within epsilon,
+/// or it is kept. The welded vertices are numbered in the order of the vertices they were kept from.
+/// The candidates are found with a spatial hash grid of the positions, whose cells are larger than twice the epsilon
+/// so that a vertex only looks up the cells of at most 2 x 2 x 2 neighbors.
+///
+/// The remap of an unindexed mesh, a triangle soup, is its index buffer. The index buffer of an indexed mesh is
+/// given by remap[indices[i]], and compactVertices builds the vertex buffers.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/spatial_hash.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_mesh_weld is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_mesh_weld extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_mesh_weld
+	/// @{
+
+	/// Welds the count vertices of positions equal within epsilon.
+	/// remap[i] receives the index of the welded vertex of the vertex i. Returns the number of welded vertices.
+	/// @see gtx_mesh_weld
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t weldVertices(vec<3, T, Q> const* positions, std::size_t count, T epsilon, uint32* remap);
+
+	/// Welds the count vertices of positions, normals and texcoords, equal within positionEpsilon, normalEpsilon and texcoordEpsilon.
+	/// normals or texcoords may be null, the attribute is then ignored.
+	/// remap[i] receives the index of the welded vertex of the vertex i. Returns the number of welded vertices.
+	/// @see gtx_mesh_weld
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t weldVertices(
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, vec<2, T, Q> const* texcoords, std::size_t count,
+		T positionEpsilon, T normalEpsilon, T texcoordEpsilon, uint32* remap);
+
+	/// Writes the vertex attribute of the welded vertices, out[remap[i]] = in[i] for the vertices i that were kept.
+	/// out holds as many values as the number of welded vertices.
+	/// @see gtx_mesh_weld
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void compactVertices(genType const* in, uint32 const* remap, std::size_t count, genType* out);
+
+	/// @}
+}//namespace glm
+
+#include "mesh_weld.inl"
@@ -0,0 +1,138 @@
+/// @ref gtx_mesh_weld
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool weld_equal(vec<L, T, Q> const& a, vec<L, T, Q> const& b, T Epsilon)
+	{
+		return all(lessThanEqual(abs(a - b), vec<L, T, Q>(Epsilon)));
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t weldVertices(vec<3, T, Q> const* positions, std::size_t count, T epsilon, uint32* remap)
+	{
+		return weldVertices(positions, static_cast<vec<3, T, Q> const*>(GLM_NULLPTR), static_cast<vec<2, T, Q> const*>(GLM_NULLPTR), count, epsilon, static_cast<T>(0), static_cast<T>(0), remap);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t weldVertices(
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, vec<2, T, Q> const* texcoords, std::size_t count,
+		T positionEpsilon, T normalEpsilon, T texcoordEpsilon, uint32* remap)
+	{
+		if(count == 0)
+			return 0;
+
+		vec<3, T, Q> Min(positions[0]);
+		vec<3, T, Q> Max(positions[0]);
+		for(std::size_t i = 1; i < count; ++i)
+		{
+			Min = min(Min, positions[i]);
+			Max = max(Max, positions[i]);
+		}
+		vec<3, T, Q> const Size(Max - Min);
+		T const Extent = max(Size.x, max(Size.y, Size.z));
+
+		// The cells are keyed on the positions relative to Min, at most 2^20 cells along an axis so that the keys don't overflow.
+		// The searched box is a little larger than the epsilon for the rounding of the relative positions,
+		// and the cells are 8 times as large as the box so that it overlaps 1 or 2 cells along an axis, 1 cell in all with a probability of 0.4.
+		T const Radius = positionEpsilon + positionEpsilon / static_cast<T>(1024) + Extent / static_cast<T>(1 << 22);
+		T CellSize = max(Radius * static_cast<T>(8), Extent / static_cast<T>(1 << 20));
+		if(CellSize <= static_cast<T>(0))
+			CellSize = static_cast<T>(1);
+		T const Scale = static_cast<T>(1) / CellSize;
+
+		// The grid only holds the kept vertices, linked in increasing order within a cell:
+		// Kept[k] is the vertex the welded vertex k was kept from, Next[k] the next welded vertex of its cell.
+		tspatial_hash<T, Q> Grid;
+		Grid.cellSize = CellSize;
+		Grid.table.assign(16, detail::spatial_hash_empty);
+
+		std::vector<uint32> Kept;
+		std::vector<uint32> Next;
+		std::vector<uint32> Tails;
+
+		vec<3, int, Q> Keys[detail::spatial_hash_block];
+		uint64 Hashes[detail::spatial_hash_block];
+		for(std::size_t Base = 0; Base < count; Base += detail::spatial_hash_block)
+		{
+			std::size_t const BlockSize = min(count - Base, static_cast<std::size_t>(detail::spatial_hash_block));
+			for(std::size_t i = 0; i < BlockSize; ++i)
+				Keys[i] = detail::spatial_hash_key(positions[Base + i] - Min, Scale);
+			hashArray(Keys, Hashes, BlockSize);
+
+			for(std::size_t b = 0; b < BlockSize; ++b)
+			{
+				std::size_t const i = Base + b;
+				vec<3, T, Q> const Relative(positions[i] - Min);
+				vec<3, int, Q> const First = detail::spatial_hash_key(Relative - Radius, Scale);
+				vec<3, int, Q> const Last = detail::spatial_hash_key(Relative + Radius, Scale);
+
+				uint32 Weld = detail::spatial_hash_empty;
+				for(int z = First.z; z <= Last.z; ++z)
+					for(int y = First.y; y <= Last.y; ++y)
+						for(int x = First.x; x <= Last.x; ++x)
+						{
+							vec<3, int, Q> const Key(x, y, z);
+							uint32 const Cell = Grid.table[detail::spatial_hash_find(Grid, Key, Key == Keys[b] ? Hashes[b] : hashValue(Key))];
+							if(Cell == detail::spatial_hash_empty)
+								continue;
+
+							// The first match of a cell is its earliest vertex
+							for(uint32 k = Grid.cells[Cell].first; k < Weld; k = Next[k])
+							{
+								uint32 const j = Kept[k];
+								if(!detail::weld_equal(positions[i], positions[j], positionEpsilon))
+									continue;
+								if(normals && !detail::weld_equal(normals[i], normals[j], normalEpsilon))
+									continue;
+								if(texcoords && !detail::weld_equal(texcoords[i], texcoords[j], texcoordEpsilon))
+									continue;
+
+								Weld = k;
+								break;
+							}
+						}
+
+				if(Weld != detail::spatial_hash_empty)
+				{
+					remap[i] = Weld;
+					continue;
+				}
+
+				uint32 const k = static_cast<uint32>(Kept.size());
+				uint32 const Cell = detail::spatial_hash_insert(Grid, Keys[b], Hashes[b]);
+				if(Cell == Tails.size())
+				{
+					Grid.cells[Cell].first = k;
+					Tails.push_back(k);
+				}
+				else
+				{
+					Next[Tails[Cell]] = k;
+					Tails[Cell] = k;
+				}
+				++Grid.cells[Cell].count;
+
+				remap[i] = k;
+				Kept.push_back(static_cast<uint32>(i));
+				Next.push_back(detail::spatial_hash_empty);
+			}
+		}
+
+		return Kept.size();
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void compactVertices(genType const* in, uint32 const* remap, std::size_t count, genType* out)
+	{
+		// The welded vertices are numbered in the order of the vertices they were kept from
+		uint32 Next = 0;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			if(remap[i] == Next)
+				out[Next++] = in[i];
+		}
+	}
+}//namespace glm
@@ -0,0 +1,112 @@
+/// @ref gtx_morton
+/// @file glm/gtx/morton.hpp
+///
+/// @see core (dependence)
+/// @see gtc_bitfield (dependence)
+/// @see gtx_aabb (dependence)
+///
+/// @defgroup gtx_morton GLM_GTX_morton
+/// @ingroup gtx
+///
+/// Include <glm/gtx/morton.hpp> to use the features of this extension.
+///
+/// Morton codes of positions, their sort and the linear bounding volume hierarchy built from them.
+/// A position is quantized on a grid covering a box, then the bits of its 3 grid coordinates are interleaved
+/// as by bitfieldInterleave: x in the bits 0, 3, 6..., y in the bits 1, 4, 7... and z in the bits 2, 5, 8...
+/// Sorting the codes orders the positions along a Z-order curve, where close positions tend to be close in the order.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/bitfield.hpp"
+#include "../gtx/aabb.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_morton is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_morton extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_morton
+	/// @{
+
+	/// Linear bounding volume hierarchy built from the sorted Morton codes of primitives.
+	/// @see gtx_morton
+	template<typename T, qualifier Q = defaultp>
+	struct tlbvh
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+
+		/// Set on a child index that refers to a leaf, the other bits are the position of the leaf in primitives
+		static const uint32 leaf_bit = 0x80000000u;
+
+		/// An inner node and the indices of its 2 children, either inner nodes or leaves.
+		struct node
+		{
+			aabb<3, T, Q> bounds;
+			uint32 children[2];
+		};
+
+		// -- Data --
+
+		/// The count - 1 inner nodes, the root is nodes[0] and a hierarchy of a single primitive has no inner node
+		std::vector<node> nodes;
+
+		/// The index of the primitive of each leaf, in the order of the Morton codes
+		std::vector<uint32> primitives;
+	};
+
+	/// Computes the 30-bit Morton codes of the count positions: 10 bits per axis on the grid of 1024^3 cells covering bounds.
+	/// Positions outside of bounds are clamped to the border cells.
+	/// @see gtx_morton
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mortonCodes(vec<3, T, Q> const* positions, std::size_t count, aabb<3, T, Q> const& bounds, uint32* codes);
+
+	/// Computes the 63-bit Morton codes of the count positions: 21 bits per axis on the grid of 2097152^3 cells covering bounds.
+	/// Positions outside of bounds are clamped to the border cells.
+	/// @see gtx_morton
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mortonCodes(vec<3, T, Q> const* positions, std::size_t count, aabb<3, T, Q> const& bounds, uint64* codes);
+
+	/// Sorts the count codes in increasing order with a stable least significant digit radix sort,
+	/// indices[i] receives the index before the sort of the code sorted at i.
+	/// The passes over the bytes that are equal for all the codes are skipped.
+	/// @see gtx_morton
+	GLM_FUNC_DISCARD_DECL void mortonSort(uint32* codes, uint32* indices, std::size_t count);
+
+	/// Sorts the count codes in increasing order with a stable least significant digit radix sort,
+	/// indices[i] receives the index before the sort of the code sorted at i.
+	/// The passes over the bytes that are equal for all the codes are skipped.
+	/// @see gtx_morton
+	GLM_FUNC_DISCARD_DECL void mortonSort(uint64* codes, uint32* indices, std::size_t count);
+
+	/// Builds the hierarchy of the count boxes from the 30-bit Morton codes of their centers, with the method of Karras:
+	/// the hierarchy is the binary radix tree of the sorted codes, where primitives of equal codes are ordered by index.
+	/// @see gtx_morton
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void buildLBVH(tlbvh<T, Q>& tree, aabb<3, T, Q> const* boxes, std::size_t count);
+
+	/// Builds the hierarchy of the count points from their 30-bit Morton codes.
+	/// @see gtx_morton
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void buildLBVH(tlbvh<T, Q>& tree, vec<3, T, Q> const* points, std::size_t count);
+
+	/// Linear bounding volume hierarchy of single-qualifier floating-point primitives.
+	/// @see gtx_morton
+	typedef tlbvh<float, defaultp>			lbvh;
+
+	/// Linear bounding volume hierarchy of double-qualifier floating-point primitives.
+	/// @see gtx_morton
+	typedef tlbvh<double, defaultp>			dlbvh;
+
+	/// @}
+}//namespace glm
+
+#include "morton.inl"
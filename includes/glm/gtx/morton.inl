@@ -0,0 +1,291 @@
+/// @ref gtx_morton
+
+#include <algorithm>
+
+namespace glm{
+namespace detail
+{
+	// Grid coordinates of the positions with 10 bits per axis for the 30-bit codes and 21 bits for the 63-bit codes
+	template<typename code>
+	struct morton_traits{};
+
+	template<>
+	struct morton_traits<uint32>
+	{
+		static const int bits = 10;
+
+		GLM_FUNC_QUALIFIER static uint32 call(uint32 x, uint32 y, uint32 z)
+		{
+			return static_cast<uint32>(glm::bitfieldInterleave(static_cast<uint16>(x), static_cast<uint16>(y), static_cast<uint16>(z)));
+		}
+	};
+
+	template<>
+	struct morton_traits<uint64>
+	{
+		static const int bits = 21;
+
+		GLM_FUNC_QUALIFIER static uint64 call(uint32 x, uint32 y, uint32 z)
+		{
+			return glm::bitfieldInterleave(x, y, z);
+		}
+	};
+
+	// Scale from the box to the grid of 2^bits cells per axis, an empty axis maps to the cell 0
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> morton_scale(aabb<3, T, Q> const& bounds, int bits)
+	{
+		T const Cells = static_cast<T>(static_cast<uint32>(1) << bits);
+		vec<3, T, Q> Scale;
+		for(length_t i = 0; i < 3; ++i)
+		{
+			T const Extent = bounds.max[i] - bounds.min[i];
+			Scale[i] = Extent > static_cast<T>(0) ? Cells / Extent : static_cast<T>(0);
+		}
+		return Scale;
+	}
+
+	template<typename T, qualifier Q, typename code, bool UseSimd>
+	struct compute_morton_codes
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, T, Q> const* positions, std::size_t first, std::size_t last, aabb<3, T, Q> const& bounds, code* codes)
+		{
+			vec<3, T, Q> const Scale(morton_scale(bounds, morton_traits<code>::bits));
+			T const Max = static_cast<T>((static_cast<uint32>(1) << morton_traits<code>::bits) - 1u);
+
+			for(std::size_t i = first; i < last; ++i)
+			{
+				vec<3, T, Q> const Cell(glm::clamp((positions[i] - bounds.min) * Scale, static_cast<T>(0), Max));
+				codes[i] = morton_traits<code>::call(static_cast<uint32>(Cell.x), static_cast<uint32>(Cell.y), static_cast<uint32>(Cell.z));
+			}
+		}
+	};
+
+	// Stable least significant digit radix sort of the codes and of their indices, by digits of 8 bits
+	template<typename code>
+	GLM_FUNC_QUALIFIER void morton_sort(code* codes, uint32* indices, std::size_t count)
+	{
+		static const std::size_t Digits = sizeof(code);
+
+		for(std::size_t i = 0; i < count; ++i)
+			indices[i] = static_cast<uint32>(i);
+		if(count < 2)
+			return;
+
+		// Histograms of all the digits in a single pass
+		std::vector<std::size_t> Histogram(Digits * 256, 0);
+		for(std::size_t i = 0; i < count; ++i)
+			for(std::size_t d = 0; d < Digits; ++d)
+				++Histogram[d * 256 + ((codes[i] >> (d * 8)) & 0xFF)];
+
+		std::vector<code> CodeBuffer(count);
+		std::vector<uint32> IndexBuffer(count);
+		code* SrcCodes = codes;
+		uint32* SrcIndices = indices;
+		code* DstCodes = &CodeBuffer[0];
+		uint32* DstIndices = &IndexBuffer[0];
+
+		for(std::size_t d = 0; d < Digits; ++d)
+		{
+			std::size_t* Offsets = &Histogram[d * 256];
+
+			// The digit is the same for all the codes, the pass would not move any code
+			if(Offsets[(codes[0] >> (d * 8)) & 0xFF] == count)
+				continue;
+
+			std::size_t Sum = 0;
+			for(std::size_t b = 0; b < 256; ++b)
+			{
+				std::size_t const Count = Offsets[b];
+				Offsets[b] = Sum;
+				Sum += Count;
+			}
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				std::size_t const Dst = Offsets[(SrcCodes[i] >> (d * 8)) & 0xFF]++;
+				DstCodes[Dst] = SrcCodes[i];
+				DstIndices[Dst] = SrcIndices[i];
+			}
+
+			std::swap(SrcCodes, DstCodes);
+			std::swap(SrcIndices, DstIndices);
+		}
+
+		if(SrcCodes != codes)
+		{
+			std::copy(SrcCodes, SrcCodes + count, codes);
+			std::copy(SrcIndices, SrcIndices + count, indices);
+		}
+	}
+
+	// Length of the common prefix of the sorted codes i and j, where j may be out of the array.
+	// Equal codes are made unique by appending the index of the code.
+	GLM_FUNC_QUALIFIER int lbvh_prefix(uint32 const* codes, std::size_t count, std::size_t i, std::ptrdiff_t j)
+	{
+		if(j < 0 || static_cast<std::size_t>(j) >= count)
+			return -1;
+
+		uint32 const Diff = codes[i] ^ codes[j];
+		if(Diff != 0)
+			return 31 - findMSB(Diff);
+		return 32 + 31 - findMSB(static_cast<uint32>(i) ^ static_cast<uint32>(j));
+	}
+
+	template<typename T, qualifier Q>
+	struct lbvh_point
+	{
+		vec<3, T, Q> const* points;
+
+		GLM_FUNC_QUALIFIER aabb<3, T, Q> operator()(std::size_t i) const
+		{
+			return aabb<3, T, Q>(points[i]);
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct lbvh_box
+	{
+		aabb<3, T, Q> const* boxes;
+
+		GLM_FUNC_QUALIFIER aabb<3, T, Q> const& operator()(std::size_t i) const
+		{
+			return boxes[i];
+		}
+	};
+
+	template<typename T, qualifier Q, typename primitive>
+	GLM_FUNC_QUALIFIER void lbvh_build(tlbvh<T, Q>& tree, primitive const& Primitive, std::size_t count)
+	{
+		typedef typename tlbvh<T, Q>::node node;
+		uint32 const Leaf = tlbvh<T, Q>::leaf_bit;
+
+		tree.nodes.clear();
+		tree.primitives.clear();
+		if(count == 0)
+			return;
+
+		assert(count < static_cast<std::size_t>(Leaf));
+
+		// Codes of the centers on the grid covering the centers
+		std::vector<vec<3, T, Q> > Centers;
+		Centers.reserve(count);
+		aabb<3, T, Q> Bounds;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			aabb<3, T, Q> const Box(Primitive(i));
+			Centers.push_back((Box.min + Box.max) * static_cast<T>(0.5));
+			Bounds = i == 0 ? aabb<3, T, Q>(Centers[0]) : merge(Bounds, Centers[i]);
+		}
+
+		std::vector<uint32> Codes(count);
+		mortonCodes(&Centers[0], count, Bounds, &Codes[0]);
+
+		tree.primitives.resize(count);
+		mortonSort(&Codes[0], &tree.primitives[0], count);
+		if(count == 1)
+			return;
+
+		node Empty;
+		Empty.bounds = aabb<3, T, Q>(vec<3, T, Q>(static_cast<T>(0)));
+		Empty.children[0] = Empty.children[1] = 0;
+		tree.nodes.resize(count - 1, Empty);
+
+		// Each inner node is built independently: find the direction and the end of its range, then the split of the range
+		uint32 const* Sorted = &Codes[0];
+		for(std::size_t i = 0; i < count - 1; ++i)
+		{
+			std::ptrdiff_t const I = static_cast<std::ptrdiff_t>(i);
+			std::ptrdiff_t const Direction = lbvh_prefix(Sorted, count, i, I + 1) > lbvh_prefix(Sorted, count, i, I - 1) ? 1 : -1;
+			int const PrefixMin = lbvh_prefix(Sorted, count, i, I - Direction);
+
+			std::ptrdiff_t LengthMax = 2;
+			while(lbvh_prefix(Sorted, count, i, I + LengthMax * Direction) > PrefixMin)
+				LengthMax *= 2;
+
+			std::ptrdiff_t Length = 0;
+			for(std::ptrdiff_t Step = LengthMax / 2; Step >= 1; Step /= 2)
+				if(lbvh_prefix(Sorted, count, i, I + (Length + Step) * Direction) > PrefixMin)
+					Length += Step;
+
+			std::ptrdiff_t const J = I + Length * Direction;
+			int const PrefixNode = lbvh_prefix(Sorted, count, i, J);
+
+			std::ptrdiff_t Split = 0;
+			for(std::ptrdiff_t Divisor = 2, Step = Length; Step > 1; Divisor *= 2)
+			{
+				Step = (Length + Divisor - 1) / Divisor;
+				if(lbvh_prefix(Sorted, count, i, I + (Split + Step) * Direction) > PrefixNode)
+					Split += Step;
+			}
+
+			std::ptrdiff_t const Gamma = I + Split * Direction + glm::min(Direction, static_cast<std::ptrdiff_t>(0));
+			tree.nodes[i].children[0] = static_cast<uint32>(Gamma) | (glm::min(I, J) == Gamma ? Leaf : 0u);
+			tree.nodes[i].children[1] = static_cast<uint32>(Gamma + 1) | (glm::max(I, J) == Gamma + 1 ? Leaf : 0u);
+		}
+
+		// Bounds from the leaves up: the inner nodes in reverse depth first order come after their children
+		std::vector<uint32> Order;
+		Order.reserve(count - 1);
+		Order.push_back(0);
+		for(std::size_t i = 0; i < Order.size(); ++i)
+			for(length_t c = 0; c < 2; ++c)
+				if(!(tree.nodes[Order[i]].children[c] & Leaf))
+					Order.push_back(tree.nodes[Order[i]].children[c]);
+
+		for(std::size_t i = Order.size(); i-- > 0;)
+		{
+			node& Node = tree.nodes[Order[i]];
+			aabb<3, T, Q> Children[2];
+			for(length_t c = 0; c < 2; ++c)
+			{
+				uint32 const Child = Node.children[c];
+				Children[c] = (Child & Leaf) ? aabb<3, T, Q>(Primitive(tree.primitives[Child & ~Leaf])) : tree.nodes[Child].bounds;
+			}
+			Node.bounds = merge(Children[0], Children[1]);
+		}
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mortonCodes(vec<3, T, Q> const* positions, std::size_t count, aabb<3, T, Q> const& bounds, uint32* codes)
+	{
+		detail::compute_morton_codes<T, Q, uint32, GLM_CONFIG_SIMD == GLM_ENABLE>::call(positions, 0, count, bounds, codes);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mortonCodes(vec<3, T, Q> const* positions, std::size_t count, aabb<3, T, Q> const& bounds, uint64* codes)
+	{
+		detail::compute_morton_codes<T, Q, uint64, GLM_CONFIG_SIMD == GLM_ENABLE>::call(positions, 0, count, bounds, codes);
+	}
+
+	GLM_FUNC_QUALIFIER void mortonSort(uint32* codes, uint32* indices, std::size_t count)
+	{
+		detail::morton_sort(codes, indices, count);
+	}
+
+	GLM_FUNC_QUALIFIER void mortonSort(uint64* codes, uint32* indices, std::size_t count)
+	{
+		detail::morton_sort(codes, indices, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildLBVH(tlbvh<T, Q>& tree, aabb<3, T, Q> const* boxes, std::size_t count)
+	{
+		detail::lbvh_box<T, Q> Primitive;
+		Primitive.boxes = boxes;
+		detail::lbvh_build(tree, Primitive, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildLBVH(tlbvh<T, Q>& tree, vec<3, T, Q> const* points, std::size_t count)
+	{
+		detail::lbvh_point<T, Q> Primitive;
+		Primitive.points = points;
+		detail::lbvh_build(tree, Primitive, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "morton_simd.inl"
+#endif
@@ -0,0 +1,160 @@
+/// @ref gtx_morton
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// The 30-bit codes are computed for 4 positions at once, 8 with AVX2: the positions are transposed to lanes,
+	// quantized with the operations of the generic path in the same order, then the 10 bits of each coordinate
+	// are spread to every third bit with shifts and masks on 32 bits lanes.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void morton_load4(vec<3, float, Q> const* p, glm_vec4 out[3])
+	{
+		float const* v = &p[0].x;
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			glm_vec4 const in[3] = {_mm_loadu_ps(v), _mm_loadu_ps(v + 4), _mm_loadu_ps(v + 8)};
+			glm_vec4_deinterleave3(in, out);
+		}
+		else
+		{
+			glm_vec4 const in[4] = {_mm_loadu_ps(&p[0].x), _mm_loadu_ps(&p[1].x), _mm_loadu_ps(&p[2].x), _mm_loadu_ps(&p[3].x)};
+			glm_vec4 Transposed[4];
+			glm_mat4_transpose(in, Transposed);
+			out[0] = Transposed[0];
+			out[1] = Transposed[1];
+			out[2] = Transposed[2];
+		}
+	}
+
+	// Grid coordinates of 4 positions
+	GLM_FUNC_QUALIFIER glm_uvec4 morton_cell4(glm_vec4 x, glm_vec4 Min, glm_vec4 Scale, glm_vec4 Max)
+	{
+		return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(x, Min), Scale), _mm_setzero_ps()), Max));
+	}
+
+	GLM_FUNC_QUALIFIER glm_uvec4 morton_spread4(glm_uvec4 x)
+	{
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 16)), _mm_set1_epi32(0x030000FF));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 8)), _mm_set1_epi32(0x0300F00F));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 4)), _mm_set1_epi32(0x030C30C3));
+		x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 2)), _mm_set1_epi32(0x09249249));
+		return x;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER __m256i morton_spread8(__m256i x)
+	{
+		x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 16)), _mm256_set1_epi32(0x030000FF));
+		x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 8)), _mm256_set1_epi32(0x0300F00F));
+		x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 4)), _mm256_set1_epi32(0x030C30C3));
+		x = _mm256_and_si256(_mm256_or_si256(x, _mm256_slli_epi32(x, 2)), _mm256_set1_epi32(0x09249249));
+		return x;
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+	template<qualifier Q>
+	struct compute_morton_codes<float, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* positions, std::size_t first, std::size_t last, aabb<3, float, Q> const& bounds, uint32* codes)
+		{
+			vec<3, float, Q> const Scale(morton_scale(bounds, morton_traits<uint32>::bits));
+			glm_vec4 const Min[3] = {_mm_set1_ps(bounds.min.x), _mm_set1_ps(bounds.min.y), _mm_set1_ps(bounds.min.z)};
+			glm_vec4 const Scales[3] = {_mm_set1_ps(Scale.x), _mm_set1_ps(Scale.y), _mm_set1_ps(Scale.z)};
+			glm_vec4 const Max = _mm_set1_ps(1023.0f);
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= last; i += 8)
+				{
+					glm_vec4 Lo[3], Hi[3];
+					morton_load4(positions + i, Lo);
+					morton_load4(positions + i + 4, Hi);
+
+					__m256i Cell[3];
+					for(length_t c = 0; c < 3; ++c)
+						Cell[c] = _mm256_set_m128i(morton_cell4(Hi[c], Min[c], Scales[c], Max), morton_cell4(Lo[c], Min[c], Scales[c], Max));
+
+					__m256i const Code = _mm256_or_si256(morton_spread8(Cell[0]),
+						_mm256_or_si256(_mm256_slli_epi32(morton_spread8(Cell[1]), 1), _mm256_slli_epi32(morton_spread8(Cell[2]), 2)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(codes + i), Code);
+				}
+#			endif
+			for(; i + 4 <= last; i += 4)
+			{
+				glm_vec4 P[3];
+				morton_load4(positions + i, P);
+
+				glm_uvec4 const Code = _mm_or_si128(morton_spread4(morton_cell4(P[0], Min[0], Scales[0], Max)),
+					_mm_or_si128(_mm_slli_epi32(morton_spread4(morton_cell4(P[1], Min[1], Scales[1], Max)), 1), _mm_slli_epi32(morton_spread4(morton_cell4(P[2], Min[2], Scales[2], Max)), 2)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(codes + i), Code);
+			}
+
+			compute_morton_codes<float, Q, uint32, false>::call(positions, i, last, bounds, codes);
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void morton_load4(vec<3, float, Q> const* p, float32x4_t out[3])
+	{
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			float32x4x3_t const In = vld3q_f32(&p[0].x);
+			out[0] = In.val[0];
+			out[1] = In.val[1];
+			out[2] = In.val[2];
+		}
+		else
+		{
+			float32x4x4_t const In = vld4q_f32(&p[0].x);
+			out[0] = In.val[0];
+			out[1] = In.val[1];
+			out[2] = In.val[2];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER uint32x4_t morton_cell4(float32x4_t x, float32x4_t Min, float32x4_t Scale, float32x4_t Max)
+	{
+		return vcvtq_u32_f32(vminq_f32(vmaxq_f32(vmulq_f32(vsubq_f32(x, Min), Scale), vdupq_n_f32(0.0f)), Max));
+	}
+
+	GLM_FUNC_QUALIFIER uint32x4_t morton_spread4(uint32x4_t x)
+	{
+		x = vandq_u32(vorrq_u32(x, vshlq_n_u32(x, 16)), vdupq_n_u32(0x030000FF));
+		x = vandq_u32(vorrq_u32(x, vshlq_n_u32(x, 8)), vdupq_n_u32(0x0300F00F));
+		x = vandq_u32(vorrq_u32(x, vshlq_n_u32(x, 4)), vdupq_n_u32(0x030C30C3));
+		x = vandq_u32(vorrq_u32(x, vshlq_n_u32(x, 2)), vdupq_n_u32(0x09249249));
+		return x;
+	}
+
+	template<qualifier Q>
+	struct compute_morton_codes<float, Q, uint32, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* positions, std::size_t first, std::size_t last, aabb<3, float, Q> const& bounds, uint32* codes)
+		{
+			vec<3, float, Q> const Scale(morton_scale(bounds, morton_traits<uint32>::bits));
+			float32x4_t const Min[3] = {vdupq_n_f32(bounds.min.x), vdupq_n_f32(bounds.min.y), vdupq_n_f32(bounds.min.z)};
+			float32x4_t const Scales[3] = {vdupq_n_f32(Scale.x), vdupq_n_f32(Scale.y), vdupq_n_f32(Scale.z)};
+			float32x4_t const Max = vdupq_n_f32(1023.0f);
+
+			std::size_t i = first;
+			for(; i + 4 <= last; i += 4)
+			{
+				float32x4_t P[3];
+				morton_load4(positions + i, P);
+
+				uint32x4_t const Code = vorrq_u32(morton_spread4(morton_cell4(P[0], Min[0], Scales[0], Max)),
+					vorrq_u32(vshlq_n_u32(morton_spread4(morton_cell4(P[1], Min[1], Scales[1], Max)), 1), vshlq_n_u32(morton_spread4(morton_cell4(P[2], Min[2], Scales[2], Max)), 2)));
+				vst1q_u32(codes + i, Code);
+			}
+
+			compute_morton_codes<float, Q, uint32, false>::call(positions, i, last, bounds, codes);
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,79 @@
+/// @ref gtx_noise_field
+/// @file glm/gtx/noise_field.hpp
+///
+/// @see core (dependence)
+/// @see gtc_noise (dependence)
+///
+/// @defgroup gtx_noise_field GLM_GTX_noise_field
+/// @ingroup gtx
+///
+/// Include <glm/gtx/noise_field.hpp> to use the features of this extension.
+///
+/// Evaluation of the perlin and simplex noises of gtc_noise on arrays of positions and on regular grids,
+/// with fractal Brownian motion (fBm): the sum over the octaves o in [0, octaves) of gain^o * noise(p * lacunarity^o).
+/// The SIMD paths evaluate 2D and 3D float noises on 4 positions at once, 8 with AVX,
+/// following the operations of the scalar functions. The results are those of the scalar functions,
+/// except where the compiler contracts multiplications and additions differently (e.g. -ffp-contract=fast with FMA):
+/// the 3D perlin noise may then select a different gradient at the lattice points where the selection is tied,
+/// as the scalar function does between builds with and without FMA.
+///
+/// Grid samples are independent: a large grid may be split in slabs of rows or slices computed on different threads,
+/// each slab being a grid of its own with an origin moved by the index of its first row or slice times spacing,
+/// and its results written at the offset of that row or slice in the output.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/noise.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_noise_field is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_noise_field extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_noise_field
+	/// @{
+
+	/// Computes out[i] = perlin(p[i]) for i in [0, count).
+	/// @see gtx_noise_field
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinArray(vec<L, T, Q> const* p, T* out, std::size_t count);
+
+	/// Computes out[i] = simplex(p[i]) for i in [0, count).
+	/// @see gtx_noise_field
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexArray(vec<L, T, Q> const* p, T* out, std::size_t count);
+
+	/// Computes the fBm of perlin on the size.x * size.y grid of positions origin + vec2(i, j) * spacing,
+	/// out[i + size.x * j] receiving the sum over the octaves of gain^o * perlin(p * lacunarity^o).
+	/// @see gtx_noise_field
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(vec<2, T, Q> const& origin, vec<2, T, Q> const& spacing, vec<2, int, Q> const& size, int octaves, T lacunarity, T gain, T* out);
+
+	/// Computes the fBm of perlin on the size.x * size.y * size.z grid of positions origin + vec3(i, j, k) * spacing,
+	/// out[i + size.x * (j + size.y * k)] receiving the sum over the octaves of gain^o * perlin(p * lacunarity^o).
+	/// @see gtx_noise_field
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinGrid(vec<3, T, Q> const& origin, vec<3, T, Q> const& spacing, vec<3, int, Q> const& size, int octaves, T lacunarity, T gain, T* out);
+
+	/// Computes the fBm of simplex on the size.x * size.y grid of positions origin + vec2(i, j) * spacing,
+	/// out[i + size.x * j] receiving the sum over the octaves of gain^o * simplex(p * lacunarity^o).
+	/// @see gtx_noise_field
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexGrid(vec<2, T, Q> const& origin, vec<2, T, Q> const& spacing, vec<2, int, Q> const& size, int octaves, T lacunarity, T gain, T* out);
+
+	/// Computes the fBm of simplex on the size.x * size.y * size.z grid of positions origin + vec3(i, j, k) * spacing,
+	/// out[i + size.x * (j + size.y * k)] receiving the sum over the octaves of gain^o * simplex(p * lacunarity^o).
+	/// @see gtx_noise_field
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexGrid(vec<3, T, Q> const& origin, vec<3, T, Q> const& spacing, vec<3, int, Q> const& size, int octaves, T lacunarity, T gain, T* out);
+
+	/// @}
+}//namespace glm
+
+#include "noise_field.inl"
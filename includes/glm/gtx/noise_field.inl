@@ -0,0 +1,117 @@
+/// @ref gtx_noise_field
+
+namespace glm{
+namespace detail
+{
+	template<bool Simplex>
+	struct noise_eval
+	{
+		template<length_t L, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& p)
+		{
+			return perlin(p);
+		}
+	};
+
+	template<>
+	struct noise_eval<true>
+	{
+		template<length_t L, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& p)
+		{
+			return simplex(p);
+		}
+	};
+
+	template<bool Simplex, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T noise_fbm(vec<L, T, Q> const& p, int octaves, T lacunarity, T gain)
+	{
+		T Sum(0);
+		T Frequency(1);
+		T Amplitude(1);
+		for(int o = 0; o < octaves; ++o)
+		{
+			Sum += Amplitude * noise_eval<Simplex>::call(p * Frequency);
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}
+		return Sum;
+	}
+
+	template<length_t L, typename T, qualifier Q, bool Simplex, bool UseSimd>
+	struct compute_noise_array
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const* p, T* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = noise_eval<Simplex>::call(p[i]);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Simplex, bool UseSimd>
+	struct compute_noise_grid{};
+
+	template<typename T, qualifier Q, bool Simplex, bool UseSimd>
+	struct compute_noise_grid<2, T, Q, Simplex, UseSimd>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, T, Q> const& origin, vec<2, T, Q> const& spacing, vec<2, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+		{
+			for(int y = 0; y < size.y; ++y, out += size.x)
+				for(int x = 0; x < size.x; ++x)
+					out[x] = noise_fbm<Simplex>(origin + vec<2, T, Q>(static_cast<T>(x), static_cast<T>(y)) * spacing, octaves, lacunarity, gain);
+		}
+	};
+
+	template<typename T, qualifier Q, bool Simplex, bool UseSimd>
+	struct compute_noise_grid<3, T, Q, Simplex, UseSimd>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, T, Q> const& origin, vec<3, T, Q> const& spacing, vec<3, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+		{
+			for(int z = 0; z < size.z; ++z)
+				for(int y = 0; y < size.y; ++y, out += size.x)
+					for(int x = 0; x < size.x; ++x)
+						out[x] = noise_fbm<Simplex>(origin + vec<3, T, Q>(static_cast<T>(x), static_cast<T>(y), static_cast<T>(z)) * spacing, octaves, lacunarity, gain);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinArray(vec<L, T, Q> const* p, T* out, std::size_t count)
+	{
+		detail::compute_noise_array<L, T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, out, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexArray(vec<L, T, Q> const* p, T* out, std::size_t count)
+	{
+		detail::compute_noise_array<L, T, Q, true, GLM_CONFIG_SIMD == GLM_ENABLE>::call(p, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<2, T, Q> const& origin, vec<2, T, Q> const& spacing, vec<2, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+	{
+		detail::compute_noise_grid<2, T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(origin, spacing, size, octaves, lacunarity, gain, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinGrid(vec<3, T, Q> const& origin, vec<3, T, Q> const& spacing, vec<3, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+	{
+		detail::compute_noise_grid<3, T, Q, false, GLM_CONFIG_SIMD == GLM_ENABLE>::call(origin, spacing, size, octaves, lacunarity, gain, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<2, T, Q> const& origin, vec<2, T, Q> const& spacing, vec<2, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+	{
+		detail::compute_noise_grid<2, T, Q, true, GLM_CONFIG_SIMD == GLM_ENABLE>::call(origin, spacing, size, octaves, lacunarity, gain, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexGrid(vec<3, T, Q> const& origin, vec<3, T, Q> const& spacing, vec<3, int, Q> const& size, int octaves, T lacunarity, T gain, T* out)
+	{
+		detail::compute_noise_grid<3, T, Q, true, GLM_CONFIG_SIMD == GLM_ENABLE>::call(origin, spacing, size, octaves, lacunarity, gain, out);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "noise_field_simd.inl"
+#endif
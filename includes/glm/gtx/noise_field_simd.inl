@@ -0,0 +1,613 @@
+/// @ref gtx_noise_field
+
+#include "../simd/matrix.h"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+
+namespace glm{
+namespace detail
+{
+	// The noises are computed on lanes of positions, with the operations of gtc/noise.inl in the same order:
+	// a lane type holds 4 or 8 floats and provides the few operators and functions used by the kernels.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct noise_f32x4
+	{
+		enum {size = 4};
+
+		glm_vec4 data;
+
+		GLM_FUNC_QUALIFIER noise_f32x4() {}
+		GLM_FUNC_QUALIFIER noise_f32x4(glm_vec4 v) : data(v) {}
+		GLM_FUNC_QUALIFIER explicit noise_f32x4(float s) : data(_mm_set1_ps(s)) {}
+
+		GLM_FUNC_QUALIFIER static noise_f32x4 iota()
+		{
+			return noise_f32x4(_mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void load(vec<2, float, Q> const* p, noise_f32x4* out)
+		{
+			glm_vec4 const a = _mm_loadu_ps(&p[0].x);
+			glm_vec4 const b = _mm_loadu_ps(&p[2].x);
+			out[0] = noise_f32x4(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			out[1] = noise_f32x4(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void load(vec<3, float, Q> const* p, noise_f32x4* out)
+		{
+			glm_vec4 Lanes[4];
+			if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+			{
+				float const* v = &p[0].x;
+				glm_vec4 const in[3] = {_mm_loadu_ps(v), _mm_loadu_ps(v + 4), _mm_loadu_ps(v + 8)};
+				glm_vec4_deinterleave3(in, Lanes);
+			}
+			else
+			{
+				glm_vec4 const in[4] = {_mm_loadu_ps(&p[0].x), _mm_loadu_ps(&p[1].x), _mm_loadu_ps(&p[2].x), _mm_loadu_ps(&p[3].x)};
+				glm_mat4_transpose(in, Lanes);
+			}
+			out[0] = noise_f32x4(Lanes[0]);
+			out[1] = noise_f32x4(Lanes[1]);
+			out[2] = noise_f32x4(Lanes[2]);
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			_mm_storeu_ps(p, data);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER noise_f32x4 operator+(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_add_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator-(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_sub_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator*(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_mul_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator/(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_div_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_floor(noise_f32x4 a){return noise_f32x4(glm_vec4_floor(a.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_abs(noise_f32x4 a){return noise_f32x4(glm_vec4_abs(a.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_min(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_min_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_max(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_max_ps(a.data, b.data));}
+
+	// 1 where a < b, 0 elsewhere
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_lessThan(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_and_ps(_mm_cmplt_ps(a.data, b.data), _mm_set1_ps(1.0f)));}
+
+	// 1 where a <= b, 0 elsewhere
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_lessThanEqual(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(_mm_and_ps(_mm_cmple_ps(a.data, b.data), _mm_set1_ps(1.0f)));}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct noise_f32x8
+	{
+		enum {size = 8};
+
+		glm_vec8 data;
+
+		GLM_FUNC_QUALIFIER noise_f32x8() {}
+		GLM_FUNC_QUALIFIER noise_f32x8(glm_vec8 v) : data(v) {}
+		GLM_FUNC_QUALIFIER explicit noise_f32x8(float s) : data(_mm256_set1_ps(s)) {}
+
+		GLM_FUNC_QUALIFIER static noise_f32x8 iota()
+		{
+			return noise_f32x8(_mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f));
+		}
+
+		template<length_t L, qualifier Q>
+		GLM_FUNC_QUALIFIER static void load(vec<L, float, Q> const* p, noise_f32x8* out)
+		{
+			noise_f32x4 Lo[L], Hi[L];
+			noise_f32x4::load(p, Lo);
+			noise_f32x4::load(p + 4, Hi);
+			for(length_t c = 0; c < L; ++c)
+				out[c] = noise_f32x8(_mm256_set_m128(Hi[c].data, Lo[c].data));
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			_mm256_storeu_ps(p, data);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER noise_f32x8 operator+(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_add_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 operator-(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_sub_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 operator*(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_mul_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 operator/(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_div_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_floor(noise_f32x8 a){return noise_f32x8(_mm256_floor_ps(a.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_abs(noise_f32x8 a){return noise_f32x8(_mm256_and_ps(a.data, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF))));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_min(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_min_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_max(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_max_ps(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_lessThan(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_and_ps(_mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ), _mm256_set1_ps(1.0f)));}
+	GLM_FUNC_QUALIFIER noise_f32x8 noise_lessThanEqual(noise_f32x8 a, noise_f32x8 b){return noise_f32x8(_mm256_and_ps(_mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ), _mm256_set1_ps(1.0f)));}
+
+	typedef noise_f32x8 noise_lanes;
+#	else
+	typedef noise_f32x4 noise_lanes;
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct noise_f32x4
+	{
+		enum {size = 4};
+
+		float32x4_t data;
+
+		GLM_FUNC_QUALIFIER noise_f32x4() {}
+		GLM_FUNC_QUALIFIER noise_f32x4(float32x4_t v) : data(v) {}
+		GLM_FUNC_QUALIFIER explicit noise_f32x4(float s) : data(vdupq_n_f32(s)) {}
+
+		GLM_FUNC_QUALIFIER static noise_f32x4 iota()
+		{
+			float const Iota[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+			return noise_f32x4(vld1q_f32(Iota));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void load(vec<2, float, Q> const* p, noise_f32x4* out)
+		{
+			float32x4x2_t const In = vld2q_f32(&p[0].x);
+			out[0] = noise_f32x4(In.val[0]);
+			out[1] = noise_f32x4(In.val[1]);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void load(vec<3, float, Q> const* p, noise_f32x4* out)
+		{
+			if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+			{
+				float32x4x3_t const In = vld3q_f32(&p[0].x);
+				out[0] = noise_f32x4(In.val[0]);
+				out[1] = noise_f32x4(In.val[1]);
+				out[2] = noise_f32x4(In.val[2]);
+			}
+			else
+			{
+				float32x4x4_t const In = vld4q_f32(&p[0].x);
+				out[0] = noise_f32x4(In.val[0]);
+				out[1] = noise_f32x4(In.val[1]);
+				out[2] = noise_f32x4(In.val[2]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER void store(float* p) const
+		{
+			vst1q_f32(p, data);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER noise_f32x4 operator+(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vaddq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator-(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vsubq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator*(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vmulq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 operator/(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vdivq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_floor(noise_f32x4 a){return noise_f32x4(vrndmq_f32(a.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_abs(noise_f32x4 a){return noise_f32x4(vabsq_f32(a.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_min(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vminq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_max(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vmaxq_f32(a.data, b.data));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_lessThan(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vreinterpretq_f32_u32(vandq_u32(vcltq_f32(a.data, b.data), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));}
+	GLM_FUNC_QUALIFIER noise_f32x4 noise_lessThanEqual(noise_f32x4 a, noise_f32x4 b){return noise_f32x4(vreinterpretq_f32_u32(vandq_u32(vcleq_f32(a.data, b.data), vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));}
+
+	typedef noise_f32x4 noise_lanes;
+#endif
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_fract(V const& x)
+	{
+		return x - noise_floor(x);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_mod(V const& x, V const& y)
+	{
+		return x - y * noise_floor(x / y);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_mod289(V const& x)
+	{
+		return x - noise_floor(x * V(1.0f / 289.0f)) * V(289.0f);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_permute(V const& x)
+	{
+		return noise_mod289(((x * V(34.0f)) + V(1.0f)) * x);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_taylorInvSqrt(V const& r)
+	{
+		return V(static_cast<float>(1.79284291400159)) - V(static_cast<float>(0.85373472095314)) * r;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_fade(V const& t)
+	{
+		return (t * t * t) * (t * (t * V(6.0f) - V(15.0f)) + V(10.0f));
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_mix(V const& x, V const& y, V const& a)
+	{
+		return x * (V(1.0f) - a) + y * a;
+	}
+
+	// step(edge, x): 0 where x < edge, 1 elsewhere
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_step(V const& edge, V const& x)
+	{
+		return noise_lessThanEqual(edge, x);
+	}
+
+	// Contribution of a corner of the 2D perlin noise: the gradient of the permuted index i times the offset (fx, fy)
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_perlin_corner(V const& i, V const& fx, V const& fy)
+	{
+		V gx = V(2.0f) * noise_fract(i / V(41.0f)) - V(1.0f);
+		V const gy = noise_abs(gx) - V(0.5f);
+		V const tx = noise_floor(gx + V(0.5f));
+		gx = gx - tx;
+
+		V const norm = noise_taylorInvSqrt(gx * gx + gy * gy);
+		return (gx * norm) * fx + (gy * norm) * fy;
+	}
+
+	// Contribution of a corner of the 3D perlin noise: the gradient of the permuted index i times the offset (fx, fy, fz)
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_perlin_corner(V const& i, V const& fx, V const& fy, V const& fz)
+	{
+		V gx = i * V(static_cast<float>(1.0 / 7.0));
+		V gy = noise_fract(noise_floor(gx) * V(static_cast<float>(1.0 / 7.0))) - V(0.5f);
+		gx = noise_fract(gx);
+		V const gz = V(0.5f) - noise_abs(gx) - noise_abs(gy);
+		V const sz = noise_step(gz, V(0.0f));
+		gx = gx - sz * (noise_step(V(0.0f), gx) - V(0.5f));
+		gy = gy - sz * (noise_step(V(0.0f), gy) - V(0.5f));
+
+		V const norm = noise_taylorInvSqrt(gx * gx + gy * gy + gz * gz);
+		return (gx * norm) * fx + (gy * norm) * fy + (gz * norm) * fz;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_perlin(V const& x, V const& y)
+	{
+		V const Fx = noise_floor(x);
+		V const Fy = noise_floor(y);
+		V const Ix0 = noise_mod(Fx, V(289.0f));
+		V const Iy0 = noise_mod(Fy, V(289.0f));
+		V const Ix1 = noise_mod(Fx + V(1.0f), V(289.0f));
+		V const Iy1 = noise_mod(Fy + V(1.0f), V(289.0f));
+		V const Fx0 = noise_fract(x);
+		V const Fy0 = noise_fract(y);
+		V const Fx1 = Fx0 - V(1.0f);
+		V const Fy1 = Fy0 - V(1.0f);
+
+		V const Px0 = noise_permute(Ix0);
+		V const Px1 = noise_permute(Ix1);
+		V const n00 = noise_perlin_corner(noise_permute(Px0 + Iy0), Fx0, Fy0);
+		V const n10 = noise_perlin_corner(noise_permute(Px1 + Iy0), Fx1, Fy0);
+		V const n01 = noise_perlin_corner(noise_permute(Px0 + Iy1), Fx0, Fy1);
+		V const n11 = noise_perlin_corner(noise_permute(Px1 + Iy1), Fx1, Fy1);
+
+		V const FadeX = noise_fade(Fx0);
+		V const FadeY = noise_fade(Fy0);
+		return V(2.3f) * noise_mix(noise_mix(n00, n10, FadeX), noise_mix(n01, n11, FadeX), FadeY);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_perlin(V const& x, V const& y, V const& z)
+	{
+		V const Fx = noise_floor(x);
+		V const Fy = noise_floor(y);
+		V const Fz = noise_floor(z);
+		V const Ix0 = noise_mod289(Fx);
+		V const Iy0 = noise_mod289(Fy);
+		V const Iz0 = noise_mod289(Fz);
+		V const Ix1 = noise_mod289(Fx + V(1.0f));
+		V const Iy1 = noise_mod289(Fy + V(1.0f));
+		V const Iz1 = noise_mod289(Fz + V(1.0f));
+		V const Fx0 = noise_fract(x);
+		V const Fy0 = noise_fract(y);
+		V const Fz0 = noise_fract(z);
+		V const Fx1 = Fx0 - V(1.0f);
+		V const Fy1 = Fy0 - V(1.0f);
+		V const Fz1 = Fz0 - V(1.0f);
+
+		V const Px0 = noise_permute(Ix0);
+		V const Px1 = noise_permute(Ix1);
+		V const Pxy00 = noise_permute(Px0 + Iy0);
+		V const Pxy10 = noise_permute(Px1 + Iy0);
+		V const Pxy01 = noise_permute(Px0 + Iy1);
+		V const Pxy11 = noise_permute(Px1 + Iy1);
+
+		V const n000 = noise_perlin_corner(noise_permute(Pxy00 + Iz0), Fx0, Fy0, Fz0);
+		V const n100 = noise_perlin_corner(noise_permute(Pxy10 + Iz0), Fx1, Fy0, Fz0);
+		V const n010 = noise_perlin_corner(noise_permute(Pxy01 + Iz0), Fx0, Fy1, Fz0);
+		V const n110 = noise_perlin_corner(noise_permute(Pxy11 + Iz0), Fx1, Fy1, Fz0);
+		V const n001 = noise_perlin_corner(noise_permute(Pxy00 + Iz1), Fx0, Fy0, Fz1);
+		V const n101 = noise_perlin_corner(noise_permute(Pxy10 + Iz1), Fx1, Fy0, Fz1);
+		V const n011 = noise_perlin_corner(noise_permute(Pxy01 + Iz1), Fx0, Fy1, Fz1);
+		V const n111 = noise_perlin_corner(noise_permute(Pxy11 + Iz1), Fx1, Fy1, Fz1);
+
+		V const FadeX = noise_fade(Fx0);
+		V const FadeY = noise_fade(Fy0);
+		V const FadeZ = noise_fade(Fz0);
+		V const n00 = noise_mix(n000, n001, FadeZ);
+		V const n10 = noise_mix(n100, n101, FadeZ);
+		V const n01 = noise_mix(n010, n011, FadeZ);
+		V const n11 = noise_mix(n110, n111, FadeZ);
+		return V(2.2f) * noise_mix(noise_mix(n00, n01, FadeY), noise_mix(n10, n11, FadeY), FadeX);
+	}
+
+	// Contribution of a corner of the 2D simplex noise of permuted index p at the offset (x, y)
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_simplex_corner(V const& p, V const& x, V const& y)
+	{
+		V m = noise_max(V(0.5f) - (x * x + y * y), V(0.0f));
+		m = m * m;
+		m = m * m;
+
+		V const gx = V(2.0f) * noise_fract(p * V(static_cast<float>(0.024390243902439))) - V(1.0f);
+		V const h = noise_abs(gx) - V(0.5f);
+		V const ox = noise_floor(gx + V(0.5f));
+		V const a0 = gx - ox;
+
+		m = m * (V(static_cast<float>(1.79284291400159)) - V(static_cast<float>(0.85373472095314)) * (a0 * a0 + h * h));
+		return m * (a0 * x + h * y);
+	}
+
+	// Contribution of a corner of the 3D simplex noise of permuted index p at the offset (x, y, z)
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_simplex_corner(V const& p, V const& x, V const& y, V const& z)
+	{
+		float const n_ = static_cast<float>(0.142857142857); // 1.0/7.0
+		V const nsx(n_ * 2.0f);
+		V const nsy(n_ * 0.5f - 1.0f);
+		V const nsz(n_);
+
+		V const j = p - V(49.0f) * noise_floor(p * nsz * nsz);
+		V const x_ = noise_floor(j * nsz);
+		V const y_ = noise_floor(j - V(7.0f) * x_);
+
+		V const gx = x_ * nsx + nsy;
+		V const gy = y_ * nsx + nsy;
+		V const h = V(1.0f) - noise_abs(gx) - noise_abs(gy);
+		V const sh = V(0.0f) - noise_step(h, V(0.0f));
+
+		V const ax = gx + (noise_floor(gx) * V(2.0f) + V(1.0f)) * sh;
+		V const ay = gy + (noise_floor(gy) * V(2.0f) + V(1.0f)) * sh;
+		V const norm = noise_taylorInvSqrt(ax * ax + ay * ay + h * h);
+
+		V m = noise_max(V(0.6f) - (x * x + y * y + z * z), V(0.0f));
+		m = m * m;
+		return (m * m) * ((ax * norm) * x + (ay * norm) * y + (h * norm) * z);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_simplex(V const& vx, V const& vy)
+	{
+		V const Cx(static_cast<float>(0.211324865405187));
+		V const Cy(static_cast<float>(0.366025403784439));
+		V const Cz(static_cast<float>(-0.577350269189626));
+
+		// First corner
+		V const s = vx * Cy + vy * Cy;
+		V ix = noise_floor(vx + s);
+		V iy = noise_floor(vy + s);
+		V const t = ix * Cx + iy * Cx;
+		V const x0 = vx - ix + t;
+		V const y0 = vy - iy + t;
+
+		// Other corners
+		V const i1x = noise_lessThan(y0, x0);
+		V const i1y = V(1.0f) - i1x;
+		V const x1 = x0 + Cx - i1x;
+		V const y1 = y0 + Cx - i1y;
+		V const x2 = x0 + Cz;
+		V const y2 = y0 + Cz;
+
+		// Permutations
+		ix = noise_mod(ix, V(289.0f));
+		iy = noise_mod(iy, V(289.0f));
+		V const p0 = noise_permute(noise_permute(iy) + ix);
+		V const p1 = noise_permute(noise_permute(iy + i1y) + ix + i1x);
+		V const p2 = noise_permute(noise_permute(iy + V(1.0f)) + ix + V(1.0f));
+
+		return V(130.0f) * (noise_simplex_corner(p0, x0, y0) + noise_simplex_corner(p1, x1, y1) + noise_simplex_corner(p2, x2, y2));
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_simplex(V const& vx, V const& vy, V const& vz)
+	{
+		V const Cx(static_cast<float>(1.0 / 6.0));
+		V const Cy(static_cast<float>(1.0 / 3.0));
+
+		// First corner
+		V const s = vx * Cy + vy * Cy + vz * Cy;
+		V ix = noise_floor(vx + s);
+		V iy = noise_floor(vy + s);
+		V iz = noise_floor(vz + s);
+		V const t = ix * Cx + iy * Cx + iz * Cx;
+		V const x0 = vx - ix + t;
+		V const y0 = vy - iy + t;
+		V const z0 = vz - iz + t;
+
+		// Other corners
+		V const gx = noise_step(y0, x0);
+		V const gy = noise_step(z0, y0);
+		V const gz = noise_step(x0, z0);
+		V const lx = V(1.0f) - gx;
+		V const ly = V(1.0f) - gy;
+		V const lz = V(1.0f) - gz;
+		V const i1x = noise_min(gx, lz);
+		V const i1y = noise_min(gy, lx);
+		V const i1z = noise_min(gz, ly);
+		V const i2x = noise_max(gx, lz);
+		V const i2y = noise_max(gy, lx);
+		V const i2z = noise_max(gz, ly);
+
+		V const x1 = x0 - i1x + Cx;
+		V const y1 = y0 - i1y + Cx;
+		V const z1 = z0 - i1z + Cx;
+		V const x2 = x0 - i2x + Cy;
+		V const y2 = y0 - i2y + Cy;
+		V const z2 = z0 - i2z + Cy;
+		V const x3 = x0 - V(0.5f);
+		V const y3 = y0 - V(0.5f);
+		V const z3 = z0 - V(0.5f);
+
+		// Permutations
+		ix = noise_mod289(ix);
+		iy = noise_mod289(iy);
+		iz = noise_mod289(iz);
+		V const p0 = noise_permute(noise_permute(noise_permute(iz) + iy) + ix);
+		V const p1 = noise_permute(noise_permute(noise_permute(iz + i1z) + iy + i1y) + ix + i1x);
+		V const p2 = noise_permute(noise_permute(noise_permute(iz + i2z) + iy + i2y) + ix + i2x);
+		V const p3 = noise_permute(noise_permute(noise_permute(iz + V(1.0f)) + iy + V(1.0f)) + ix + V(1.0f));
+
+		V const n0 = noise_simplex_corner(p0, x0, y0, z0);
+		V const n1 = noise_simplex_corner(p1, x1, y1, z1);
+		V const n2 = noise_simplex_corner(p2, x2, y2, z2);
+		V const n3 = noise_simplex_corner(p3, x3, y3, z3);
+		return V(42.0f) * ((n0 + n1) + (n2 + n3));
+	}
+
+	template<bool Simplex>
+	struct noise_eval_lanes
+	{
+		template<typename V>
+		GLM_FUNC_QUALIFIER static V call(V const& x, V const& y){return noise_perlin(x, y);}
+
+		template<typename V>
+		GLM_FUNC_QUALIFIER static V call(V const& x, V const& y, V const& z){return noise_perlin(x, y, z);}
+	};
+
+	template<>
+	struct noise_eval_lanes<true>
+	{
+		template<typename V>
+		GLM_FUNC_QUALIFIER static V call(V const& x, V const& y){return noise_simplex(x, y);}
+
+		template<typename V>
+		GLM_FUNC_QUALIFIER static V call(V const& x, V const& y, V const& z){return noise_simplex(x, y, z);}
+	};
+
+	template<bool Simplex, typename V>
+	GLM_FUNC_QUALIFIER V noise_fbm_lanes(V const& x, V const& y, int octaves, float lacunarity, float gain)
+	{
+		V Sum(0.0f);
+		float Frequency = 1.0f;
+		float Amplitude = 1.0f;
+		for(int o = 0; o < octaves; ++o)
+		{
+			V const Frequencies(Frequency);
+			Sum = Sum + V(Amplitude) * noise_eval_lanes<Simplex>::call(x * Frequencies, y * Frequencies);
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}
+		return Sum;
+	}
+
+	template<bool Simplex, typename V>
+	GLM_FUNC_QUALIFIER V noise_fbm_lanes(V const& x, V const& y, V const& z, int octaves, float lacunarity, float gain)
+	{
+		V Sum(0.0f);
+		float Frequency = 1.0f;
+		float Amplitude = 1.0f;
+		for(int o = 0; o < octaves; ++o)
+		{
+			V const Frequencies(Frequency);
+			Sum = Sum + V(Amplitude) * noise_eval_lanes<Simplex>::call(x * Frequencies, y * Frequencies, z * Frequencies);
+			Frequency *= lacunarity;
+			Amplitude *= gain;
+		}
+		return Sum;
+	}
+
+	template<qualifier Q, bool Simplex>
+	struct compute_noise_array<2, float, Q, Simplex, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const* p, float* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + noise_lanes::size <= count; i += noise_lanes::size)
+			{
+				noise_lanes P[2];
+				noise_lanes::load(p + i, P);
+				noise_eval_lanes<Simplex>::call(P[0], P[1]).store(out + i);
+			}
+			compute_noise_array<2, float, Q, Simplex, false>::call(p + i, out + i, count - i);
+		}
+	};
+
+	template<qualifier Q, bool Simplex>
+	struct compute_noise_array<3, float, Q, Simplex, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* p, float* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + noise_lanes::size <= count; i += noise_lanes::size)
+			{
+				noise_lanes P[3];
+				noise_lanes::load(p + i, P);
+				noise_eval_lanes<Simplex>::call(P[0], P[1], P[2]).store(out + i);
+			}
+			compute_noise_array<3, float, Q, Simplex, false>::call(p + i, out + i, count - i);
+		}
+	};
+
+	template<qualifier Q, bool Simplex>
+	struct compute_noise_grid<2, float, Q, Simplex, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<2, float, Q> const& origin, vec<2, float, Q> const& spacing, vec<2, int, Q> const& size, int octaves, float lacunarity, float gain, float* out)
+		{
+			noise_lanes const Iota(noise_lanes::iota());
+			noise_lanes const OriginX(origin.x);
+			noise_lanes const SpacingX(spacing.x);
+
+			for(int y = 0; y < size.y; ++y, out += size.x)
+			{
+				noise_lanes const Py(origin.y + static_cast<float>(y) * spacing.y);
+
+				int x = 0;
+				for(; x + noise_lanes::size <= size.x; x += noise_lanes::size)
+				{
+					noise_lanes const Px = OriginX + (noise_lanes(static_cast<float>(x)) + Iota) * SpacingX;
+					noise_fbm_lanes<Simplex>(Px, Py, octaves, lacunarity, gain).store(out + x);
+				}
+				for(; x < size.x; ++x)
+					out[x] = noise_fbm<Simplex>(origin + vec<2, float, Q>(static_cast<float>(x), static_cast<float>(y)) * spacing, octaves, lacunarity, gain);
+			}
+		}
+	};
+
+	template<qualifier Q, bool Simplex>
+	struct compute_noise_grid<3, float, Q, Simplex, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const& origin, vec<3, float, Q> const& spacing, vec<3, int, Q> const& size, int octaves, float lacunarity, float gain, float* out)
+		{
+			noise_lanes const Iota(noise_lanes::iota());
+			noise_lanes const OriginX(origin.x);
+			noise_lanes const SpacingX(spacing.x);
+
+			for(int z = 0; z < size.z; ++z)
+			{
+				noise_lanes const Pz(origin.z + static_cast<float>(z) * spacing.z);
+				for(int y = 0; y < size.y; ++y, out += size.x)
+				{
+					noise_lanes const Py(origin.y + static_cast<float>(y) * spacing.y);
+
+					int x = 0;
+					for(; x + noise_lanes::size <= size.x; x += noise_lanes::size)
+					{
+						noise_lanes const Px = OriginX + (noise_lanes(static_cast<float>(x)) + Iota) * SpacingX;
+						noise_fbm_lanes<Simplex>(Px, Py, Pz, octaves, lacunarity, gain).store(out + x);
+					}
+					for(; x < size.x; ++x)
+						out[x] = noise_fbm<Simplex>(origin + vec<3, float, Q>(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)) * spacing, octaves, lacunarity, gain);
+				}
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
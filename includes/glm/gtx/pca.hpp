@@ -15,6 +15,19 @@
 /// This is useful, e.g., to compute an object-aligned bounding box from vertices of an object.
 /// https://en.wikipedia.org/wiki/Principal_component_analysis
 ///
+/// For large point sets, covariance_accumulator computes the mean and the covariance matrix in a single pass.
+/// Accumulators of separate parts of the points, e.g. computed on different threads, are combined with mergeCovariance:
+/// ```
+/// glm::covariance_accumulator<3, float> parts[2];
+/// glm::accumulateCovariance(parts[0], ptData.data(), half);                     // e.g. on a first thread
+/// glm::accumulateCovariance(parts[1], ptData.data() + half, ptData.size() - half); // e.g. on a second thread
+/// glm::covariance_accumulator<3, float> acc = glm::mergeCovariance(parts[0], parts[1]);
+///
+/// glm::vec3 evals;
+/// glm::mat3 evecs;
+/// int evcnt = glm::findEigenvaluesSymReal3(glm::computeCovarianceMatrix(acc), evals, evecs); // sorted, largest first
+/// ```
+///
 /// Example:
 /// ```
 /// std::vector<glm::dvec3> ptData;
@@ -40,6 +53,7 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include "../gtc/constants.hpp"
 #include "../ext/scalar_relational.hpp"
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
@@ -75,6 +89,51 @@ namespace glm {
 	template<length_t D, typename T, qualifier Q, typename I>
 	GLM_FUNC_DECL mat<D, D, T, Q> computeCovarianceMatrix(I const& b, I const& e, vec<D, T, Q> const& c);
 
+	/// Running mean and sum of the outer products of the deviations from the mean of a set of points, updated one point or one array at a time.
+	/// The update is numerically stable (Welford): the points don't need to be relative to their center of gravity.
+	/// @see gtx_pca
+	template<length_t D, typename T, qualifier Q = defaultp>
+	struct covariance_accumulator
+	{
+		typedef T value_type;
+
+		/// Builds the accumulator of an empty set of points
+		GLM_FUNC_DISCARD_DECL covariance_accumulator();
+
+		/// Number of accumulated points
+		size_t count;
+
+		/// Center of gravity of the accumulated points
+		vec<D, T, Q> mean;
+
+		/// Sum of the outer products of the deviations from mean
+		mat<D, D, T, Q> m2;
+	};
+
+	/// Adds the point `v` to the accumulator `acc`
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const& v);
+
+	/// Adds the `n` points of `v` to the accumulator `acc`, reading each point once.
+	/// The points are accumulated by blocks: the block is centered on its own mean, then merged into `acc`.
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const* v, size_t n);
+
+	/// Adds the points of a pair of iterators `b` (begin) and `e` (end) to the accumulator `acc`, dereferencing each iterator once.
+	/// Dereferencing an iterator of type I must yield a `vec&lt;D, T, Q%gt;`
+	template<length_t D, typename T, qualifier Q, typename I>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, I const& b, I const& e);
+
+	/// Returns the accumulator of the union of the points of `a` and `b` (Chan et al. pairwise update).
+	/// Disjoint parts of a point set may be accumulated independently, e.g. on different threads, then merged in any order.
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DECL covariance_accumulator<D, T, Q> mergeCovariance(covariance_accumulator<D, T, Q> const& a, covariance_accumulator<D, T, Q> const& b);
+
+	/// Compute the covariance matrix of the points accumulated in `acc`, relative to their center of gravity `acc.mean`.
+	/// The result matches computeCovarianceMatrix of the same points relative to their center.
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DECL mat<D, D, T, Q> computeCovarianceMatrix(covariance_accumulator<D, T, Q> const& acc);
+
 	/// Assuming the provided covariance matrix `covarMat` is symmetric and real-valued, this function find the `D` Eigenvalues of the matrix, and also provides the corresponding Eigenvectors.
 	/// Note: the data in `outEigenvalues` and `outEigenvectors` are in matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	/// This is a numeric implementation to find the Eigenvalues, using 'QL decomposition` (variant of QR decomposition: https://en.wikipedia.org/wiki/QR_decomposition).
@@ -91,6 +150,25 @@ namespace glm {
 		mat<D, D, T, Q>& outEigenvectors
 	);
 
+	/// Closed form alternative to findEigenvaluesSymReal for a symmetric, real-valued 3x3 matrix, without iterations.
+	/// The eigenvalues are the roots of the characteristic polynomial of `(covarMat - q * I) / p`, q being the mean of the eigenvalues
+	/// and p their deviation, found with trigonometric functions. A matrix whose deviation is below epsilon<T>() * q is a multiple of the identity.
+	/// The eigenvector of the most separated eigenvalue is the largest cross product of two rows of the shifted matrix,
+	/// the second eigenvector is solved by a rotation in the plane orthogonal to the first, the third one is their cross product.
+	/// Note: unlike findEigenvaluesSymReal, the eigenvalues are sorted, from largest to smallest, as by sortEigenvalues.
+	///
+	/// @param[in] covarMat A symmetric, real-valued 3x3 matrix, e.g. computed from computeCovarianceMatrix
+	/// @param[out] outEigenvalues Vector to receive the eigenvalues, sorted from largest to smallest
+	/// @param[out] outEigenvectors Matrix to receive the orthonormal eigenvectors corresponding to the eigenvalues, as column vectors
+	/// @return The number of eigenvalues found, always 3.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL unsigned int findEigenvaluesSymReal3
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors
+	);
+
 	/// Sorts a group of Eigenvalues&Eigenvectors, for largest Eigenvalue to smallest Eigenvalue.
 	/// The data in `outEigenvalues` and `outEigenvectors` are assumed to be matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	template<typename T, qualifier Q>
@@ -65,9 +65,32 @@ namespace glm {
 		return m;
 	}
 
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER covariance_accumulator<D, T, Q>::covariance_accumulator()
+		: count(0), mean(static_cast<T>(0)), m2(static_cast<T>(0))
+	{}
+
 	namespace _internal_
 	{
 
+		// Merges the n points of center of gravity `mean` and sum of outer products of deviations `m2` into `acc`
+		template<length_t D, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER void mergeCovariance(covariance_accumulator<D, T, Q>& acc, size_t n, vec<D, T, Q> const& mean, mat<D, D, T, Q> const& m2)
+		{
+			size_t const cnt = acc.count + n;
+			if(n == 0)
+				return;
+
+			vec<D, T, Q> const delta = mean - acc.mean;
+			T const wb = static_cast<T>(n) / static_cast<T>(cnt);
+			T const wab = static_cast<T>(acc.count) * wb;
+			for(length_t x = 0; x < D; ++x)
+				for(length_t y = 0; y < D; ++y)
+					acc.m2[x][y] += m2[x][y] + delta[x] * delta[y] * wab;
+			acc.mean += delta * wb;
+			acc.count = cnt;
+		}
+
 		template<typename T>
 		GLM_FUNC_QUALIFIER static T transferSign(T const& v, T const& s)
 		{
@@ -280,6 +303,233 @@ namespace glm {
 		return D;
 	}
 
+namespace detail
+{
+	// Two passes over a block small enough to stay in cache: its mean, then the outer products of the deviations from it
+	template<length_t D, typename T, qualifier Q, bool UseSimd>
+	struct compute_covariance_block
+	{
+		GLM_FUNC_QUALIFIER static void call(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const* v, size_t n)
+		{
+			vec<D, T, Q> sum(0);
+			for(size_t i = 0; i < n; ++i)
+				sum += v[i];
+			vec<D, T, Q> const mean = sum / static_cast<T>(n);
+
+			mat<D, D, T, Q> m2(0);
+			for(size_t i = 0; i < n; ++i)
+			{
+				vec<D, T, Q> const d = v[i] - mean;
+				for(length_t x = 0; x < D; ++x)
+					for(length_t y = 0; y < D; ++y)
+						m2[x][y] += d[x] * d[y];
+			}
+
+			_internal_::mergeCovariance(acc, n, mean, m2);
+		}
+	};
+}//namespace detail
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const& v)
+	{
+		++acc.count;
+		vec<D, T, Q> const delta = v - acc.mean;
+		acc.mean += delta / static_cast<T>(acc.count);
+		vec<D, T, Q> const delta2 = v - acc.mean;
+		for(length_t x = 0; x < D; ++x)
+			for(length_t y = x; y < D; ++y)
+				acc.m2[x][y] += delta[x] * delta2[y];
+		for(length_t x = 0; x < D; ++x)
+			for(length_t y = x + 1; y < D; ++y)
+				acc.m2[y][x] = acc.m2[x][y];
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const* v, size_t n)
+	{
+		size_t const block = 256;
+		for(size_t i = 0; i < n; i += block)
+			detail::compute_covariance_block<D, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(acc, v + i, glm::min(block, n - i));
+	}
+
+	template<length_t D, typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, I const& b, I const& e)
+	{
+		vec<D, T, Q> buffer[256];
+		size_t cnt = 0;
+		for(I i = b; i != e; i++)
+		{
+			buffer[cnt++] = *i;
+			if(cnt == 256)
+			{
+				detail::compute_covariance_block<D, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(acc, buffer, cnt);
+				cnt = 0;
+			}
+		}
+		if(cnt > 0)
+			detail::compute_covariance_block<D, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(acc, buffer, cnt);
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER covariance_accumulator<D, T, Q> mergeCovariance(covariance_accumulator<D, T, Q> const& a, covariance_accumulator<D, T, Q> const& b)
+	{
+		covariance_accumulator<D, T, Q> acc(a);
+		_internal_::mergeCovariance(acc, b.count, b.mean, b.m2);
+		return acc;
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<D, D, T, Q> computeCovarianceMatrix(covariance_accumulator<D, T, Q> const& acc)
+	{
+		if(acc.count == 0)
+			return mat<D, D, T, Q>(static_cast<T>(0));
+		return acc.m2 / static_cast<T>(acc.count);
+	}
+
+	namespace _internal_
+	{
+
+		// Unit vectors u and v such that (w, u, v) is a right-handed orthonormal basis, w being a unit vector
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER void orthogonalComplement(vec<3, T, Q> const& w, vec<3, T, Q>& u, vec<3, T, Q>& v)
+		{
+			if(glm::abs(w.x) > glm::abs(w.y))
+				u = vec<3, T, Q>(-w.z, 0, w.x) / glm::sqrt(w.x * w.x + w.z * w.z);
+			else
+				u = vec<3, T, Q>(0, w.z, -w.y) / glm::sqrt(w.y * w.y + w.z * w.z);
+			v = glm::cross(w, u);
+		}
+
+		// Eigenvector of a simple eigenvalue: orthogonal to the rows of m - eigenvalue * I, which span a plane
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER vec<3, T, Q> eigenvector0(mat<3, 3, T, Q> const& m, T eigenvalue)
+		{
+			vec<3, T, Q> const r0(m[0][0] - eigenvalue, m[1][0], m[2][0]);
+			vec<3, T, Q> const r1(m[0][1], m[1][1] - eigenvalue, m[2][1]);
+			vec<3, T, Q> const r2(m[0][2], m[1][2], m[2][2] - eigenvalue);
+			vec<3, T, Q> const c[3] = {glm::cross(r0, r1), glm::cross(r0, r2), glm::cross(r1, r2)};
+
+			// The cross products are compared and normalized by their largest component, their squared lengths can underflow
+			T d[3];
+			for(length_t i = 0; i < 3; ++i)
+				d[i] = glm::max(glm::max(glm::abs(c[i].x), glm::abs(c[i].y)), glm::abs(c[i].z));
+
+			length_t imax = 0;
+			if(d[1] > d[imax])
+				imax = 1;
+			if(d[2] > d[imax])
+				imax = 2;
+			if(d[imax] > static_cast<T>(0))
+			{
+				vec<3, T, Q> const n(c[imax] / d[imax]);
+				return n / glm::sqrt(glm::dot(n, n));
+			}
+
+			// The rows are parallel, the eigenvalue is double: any vector orthogonal to the largest row
+			vec<3, T, Q> const r[3] = {r0, r1, r2};
+			T const l[3] = {glm::dot(r0, r0), glm::dot(r1, r1), glm::dot(r2, r2)};
+			imax = 0;
+			if(l[1] > l[imax])
+				imax = 1;
+			if(l[2] > l[imax])
+				imax = 2;
+			if(l[imax] <= static_cast<T>(0))
+				return vec<3, T, Q>(1, 0, 0);
+
+			vec<3, T, Q> u, v;
+			orthogonalComplement(r[imax] / glm::sqrt(l[imax]), u, v);
+			return u;
+		}
+
+		// Eigenvector orthogonal to the eigenvector e0: the restriction of m to the plane orthogonal to e0 is a 2x2 symmetric matrix,
+		// diagonalized by a rotation. Its eigenvectors don't depend on the roots, which lose half of the precision around a double eigenvalue
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER vec<3, T, Q> eigenvector1(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& e0)
+		{
+			vec<3, T, Q> u, v;
+			orthogonalComplement(e0, u, v);
+
+			vec<3, T, Q> const mu = m * u;
+			vec<3, T, Q> const mv = m * v;
+			T const m00 = glm::dot(u, mu);
+			T const m01 = glm::dot(u, mv);
+			T const m11 = glm::dot(v, mv);
+
+			T const angle = glm::atan(static_cast<T>(2) * m01, m00 - m11) * static_cast<T>(0.5);
+			return u * glm::cos(angle) + v * glm::sin(angle);
+		}
+
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymReal3
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors
+	)
+	{
+		// Scale by the largest coefficient to avoid overflows and underflows
+		T const scale = glm::max(
+			glm::max(glm::max(glm::abs(covarMat[0][0]), glm::abs(covarMat[1][0])), glm::max(glm::abs(covarMat[2][0]), glm::abs(covarMat[1][1]))),
+			glm::max(glm::abs(covarMat[2][1]), glm::abs(covarMat[2][2])));
+		if(scale <= static_cast<T>(0))
+		{
+			outEigenvalues = vec<3, T, Q>(static_cast<T>(0));
+			outEigenvectors = mat<3, 3, T, Q>(static_cast<T>(1));
+			return 3;
+		}
+
+		mat<3, 3, T, Q> const a = covarMat / scale;
+		T const a01 = a[1][0];
+		T const a02 = a[2][0];
+		T const a12 = a[2][1];
+		T const q = (a[0][0] + a[1][1] + a[2][2]) / static_cast<T>(3);
+		T const b00 = a[0][0] - q;
+		T const b11 = a[1][1] - q;
+		T const b22 = a[2][2] - q;
+		T const p = glm::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + static_cast<T>(2) * (a01 * a01 + a02 * a02 + a12 * a12)) / static_cast<T>(6));
+		if(p <= epsilon<T>() * glm::abs(q))
+		{
+			outEigenvalues = vec<3, T, Q>(q * scale);
+			outEigenvectors = mat<3, 3, T, Q>(static_cast<T>(1));
+			return 3;
+		}
+
+		// The eigenvalues of a are q + p * beta where beta are the eigenvalues of b = (a - q * I) / p:
+		// 2 * cos(angle + k * 2 * pi / 3) with cos(3 * angle) = det(b) / 2. b and its eigenvectors don't depend on the scale of p
+		mat<3, 3, T, Q> const b = (a - mat<3, 3, T, Q>(q)) / p;
+		T const halfDet = glm::clamp(glm::determinant(b) * static_cast<T>(0.5), static_cast<T>(-1), static_cast<T>(1));
+		T const angle = glm::acos(halfDet) / static_cast<T>(3);
+		T const twoThirdsPi = static_cast<T>(2.09439510239319549);
+		T const beta0 = glm::cos(angle) * static_cast<T>(2);
+		T const beta2 = glm::cos(angle + twoThirdsPi) * static_cast<T>(2);
+
+		// The eigenvector of the eigenvalue farthest from the two others is the best conditioned
+		vec<3, T, Q> e0, e1, e2;
+		if(halfDet >= static_cast<T>(0))
+		{
+			e0 = _internal_::eigenvector0(b, beta0);
+			e1 = _internal_::eigenvector1(b, e0);
+			e2 = glm::cross(e0, e1);
+		}
+		else
+		{
+			e2 = _internal_::eigenvector0(b, beta2);
+			e1 = _internal_::eigenvector1(b, e2);
+			e0 = glm::cross(e1, e2);
+		}
+
+		// The roots lose half of the precision around a double eigenvalue, the Rayleigh quotients of the eigenvectors don't
+		outEigenvalues = vec<3, T, Q>(glm::dot(e0, a * e0), glm::dot(e1, a * e1), glm::dot(e2, a * e2)) * scale;
+		outEigenvectors = mat<3, 3, T, Q>(e0, e1, e2);
+		sortEigenvalues(outEigenvalues, outEigenvectors);
+		if(glm::dot(glm::cross(outEigenvectors[0], outEigenvectors[1]), outEigenvectors[2]) < static_cast<T>(0))
+			outEigenvectors[2] = -outEigenvectors[2];
+		return 3;
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER void sortEigenvalues(vec<2, T, Q>& eigenvalues, mat<2, 2, T, Q>& eigenvectors)
 	{
@@ -341,3 +591,7 @@ namespace glm {
 	}
 
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "pca_simd.inl"
+#endif
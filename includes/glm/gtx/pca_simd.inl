@@ -0,0 +1,171 @@
+/// @ref gtx_pca
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// The points of a block are accumulated 4 at once: transposed to x, y and z lanes, each lane sums its own points,
+	// then the lanes of the 3 sums and of the 6 distinct products of the deviations are added at the end of each pass.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void covariance_load4(vec<3, float, Q> const* p, glm_vec4 out[3])
+	{
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			float const* v = &p[0].x;
+			glm_vec4 const in[3] = {_mm_loadu_ps(v), _mm_loadu_ps(v + 4), _mm_loadu_ps(v + 8)};
+			glm_vec4_deinterleave3(in, out);
+		}
+		else
+		{
+			glm_vec4 const in[4] = {_mm_loadu_ps(&p[0].x), _mm_loadu_ps(&p[1].x), _mm_loadu_ps(&p[2].x), _mm_loadu_ps(&p[3].x)};
+			glm_vec4 Transposed[4];
+			glm_mat4_transpose(in, Transposed);
+			out[0] = Transposed[0];
+			out[1] = Transposed[1];
+			out[2] = Transposed[2];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER float covariance_hadd(glm_vec4 x)
+	{
+		glm_vec4 const s = _mm_add_ps(x, _mm_movehl_ps(x, x));
+		return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+	}
+
+	template<qualifier Q>
+	struct compute_covariance_block<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(covariance_accumulator<3, float, Q>& acc, vec<3, float, Q> const* v, size_t n)
+		{
+			size_t const n4 = n & ~static_cast<size_t>(3);
+
+			glm_vec4 Sum[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+			for(size_t i = 0; i < n4; i += 4)
+			{
+				glm_vec4 P[3];
+				covariance_load4(v + i, P);
+				Sum[0] = _mm_add_ps(Sum[0], P[0]);
+				Sum[1] = _mm_add_ps(Sum[1], P[1]);
+				Sum[2] = _mm_add_ps(Sum[2], P[2]);
+			}
+			vec<3, float, Q> sum(covariance_hadd(Sum[0]), covariance_hadd(Sum[1]), covariance_hadd(Sum[2]));
+			for(size_t i = n4; i < n; ++i)
+				sum += v[i];
+			vec<3, float, Q> const mean = sum / static_cast<float>(n);
+
+			glm_vec4 const Mean[3] = {_mm_set1_ps(mean.x), _mm_set1_ps(mean.y), _mm_set1_ps(mean.z)};
+			glm_vec4 Prod[6] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+			for(size_t i = 0; i < n4; i += 4)
+			{
+				glm_vec4 P[3];
+				covariance_load4(v + i, P);
+				glm_vec4 const Dx = _mm_sub_ps(P[0], Mean[0]);
+				glm_vec4 const Dy = _mm_sub_ps(P[1], Mean[1]);
+				glm_vec4 const Dz = _mm_sub_ps(P[2], Mean[2]);
+				Prod[0] = glm_vec4_fma(Dx, Dx, Prod[0]);
+				Prod[1] = glm_vec4_fma(Dy, Dx, Prod[1]);
+				Prod[2] = glm_vec4_fma(Dz, Dx, Prod[2]);
+				Prod[3] = glm_vec4_fma(Dy, Dy, Prod[3]);
+				Prod[4] = glm_vec4_fma(Dz, Dy, Prod[4]);
+				Prod[5] = glm_vec4_fma(Dz, Dz, Prod[5]);
+			}
+			float s[6];
+			for(length_t k = 0; k < 6; ++k)
+				s[k] = covariance_hadd(Prod[k]);
+			for(size_t i = n4; i < n; ++i)
+			{
+				vec<3, float, Q> const d = v[i] - mean;
+				s[0] += d.x * d.x;
+				s[1] += d.y * d.x;
+				s[2] += d.z * d.x;
+				s[3] += d.y * d.y;
+				s[4] += d.z * d.y;
+				s[5] += d.z * d.z;
+			}
+
+			mat<3, 3, float, Q> const m2(s[0], s[1], s[2], s[1], s[3], s[4], s[2], s[4], s[5]);
+			_internal_::mergeCovariance(acc, n, mean, m2);
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void covariance_load4(vec<3, float, Q> const* p, float32x4_t out[3])
+	{
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			float32x4x3_t const In = vld3q_f32(&p[0].x);
+			out[0] = In.val[0];
+			out[1] = In.val[1];
+			out[2] = In.val[2];
+		}
+		else
+		{
+			float32x4x4_t const In = vld4q_f32(&p[0].x);
+			out[0] = In.val[0];
+			out[1] = In.val[1];
+			out[2] = In.val[2];
+		}
+	}
+
+	template<qualifier Q>
+	struct compute_covariance_block<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(covariance_accumulator<3, float, Q>& acc, vec<3, float, Q> const* v, size_t n)
+		{
+			size_t const n4 = n & ~static_cast<size_t>(3);
+
+			float32x4_t Sum[3] = {vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f)};
+			for(size_t i = 0; i < n4; i += 4)
+			{
+				float32x4_t P[3];
+				covariance_load4(v + i, P);
+				Sum[0] = vaddq_f32(Sum[0], P[0]);
+				Sum[1] = vaddq_f32(Sum[1], P[1]);
+				Sum[2] = vaddq_f32(Sum[2], P[2]);
+			}
+			vec<3, float, Q> sum(vaddvq_f32(Sum[0]), vaddvq_f32(Sum[1]), vaddvq_f32(Sum[2]));
+			for(size_t i = n4; i < n; ++i)
+				sum += v[i];
+			vec<3, float, Q> const mean = sum / static_cast<float>(n);
+
+			float32x4_t const Mean[3] = {vdupq_n_f32(mean.x), vdupq_n_f32(mean.y), vdupq_n_f32(mean.z)};
+			float32x4_t Prod[6] = {vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f), vdupq_n_f32(0.0f)};
+			for(size_t i = 0; i < n4; i += 4)
+			{
+				float32x4_t P[3];
+				covariance_load4(v + i, P);
+				float32x4_t const Dx = vsubq_f32(P[0], Mean[0]);
+				float32x4_t const Dy = vsubq_f32(P[1], Mean[1]);
+				float32x4_t const Dz = vsubq_f32(P[2], Mean[2]);
+				Prod[0] = vfmaq_f32(Prod[0], Dx, Dx);
+				Prod[1] = vfmaq_f32(Prod[1], Dy, Dx);
+				Prod[2] = vfmaq_f32(Prod[2], Dz, Dx);
+				Prod[3] = vfmaq_f32(Prod[3], Dy, Dy);
+				Prod[4] = vfmaq_f32(Prod[4], Dz, Dy);
+				Prod[5] = vfmaq_f32(Prod[5], Dz, Dz);
+			}
+			float s[6];
+			for(length_t k = 0; k < 6; ++k)
+				s[k] = vaddvq_f32(Prod[k]);
+			for(size_t i = n4; i < n; ++i)
+			{
+				vec<3, float, Q> const d = v[i] - mean;
+				s[0] += d.x * d.x;
+				s[1] += d.y * d.x;
+				s[2] += d.z * d.x;
+				s[3] += d.y * d.y;
+				s[4] += d.z * d.y;
+				s[5] += d.z * d.z;
+			}
+
+			mat<3, 3, float, Q> const m2(s[0], s[1], s[2], s[1], s[3], s[4], s[2], s[4], s[5]);
+			_internal_::mergeCovariance(acc, n, mean, m2);
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
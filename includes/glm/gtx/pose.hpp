@@ -0,0 +1,98 @@
+/// @ref gtx_pose
+/// @file glm/gtx/pose.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_dual_quaternion (dependence)
+/// @see gtx_matrix_affine (dependence)
+///
+/// @defgroup gtx_pose GLM_GTX_pose
+/// @ingroup gtx
+///
+/// Include <glm/gtx/pose.hpp> to use the features of this extension.
+///
+/// Blending and hierarchical propagation of skeleton poses stored as arrays of joints.
+/// A pose is an array of jointCount rotations or vec3 tracks, the functions blend several poses joint by joint,
+/// compose the blended tracks to local transforms, propagate them from parent to child and build skinning palettes.
+/// Nothing is allocated: every array is owned by the caller.
+/// The SIMD paths transpose 4 joints at a time so that a blend is computed on component lanes.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include "../gtx/matrix_affine.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_pose is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_pose extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_pose
+	/// @{
+
+	/// Normalized linear blend of poseCount rotation poses: out[j] = normalize(sum of weights[k] * poses[k][j]).
+	/// Each rotation is negated when it lies in the opposite hemisphere of poses[0][j] so that the blend takes the short way.
+	/// A blend of zero length returns the identity. out may be one of the poses.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void blendRotations(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t jointCount);
+
+	/// Spherical blend of poseCount rotation poses computed as a chain of slerp:
+	/// out[j] = slerp(... slerp(poses[0][j], poses[1][j], w1 / (w0 + w1)) ..., poses[k][j], wk / (w0 + ... + wk)).
+	/// Weights must not be negative. out may be one of the poses.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void slerpRotations(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t jointCount);
+
+	/// Weighted sum of poseCount translation or scale poses: out[j] = sum of weights[k] * poses[k][j].
+	/// out may be one of the poses.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void blendVectors(vec<3, T, Q> const* const* poses, T const* weights, std::size_t poseCount, vec<3, T, Q>* out, std::size_t jointCount);
+
+	/// Computes out[i] = translate(translations[i]) * mat4_cast(rotations[i]) * scale(scales[i]) for i in [0, count).
+	/// scales may be null for rigid transforms.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void composeTransforms(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, vec<3, T, Q> const* scales, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = tdualquat(rotations[i], translations[i]) for i in [0, count).
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void composeTransforms(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, tdualquat<T, Q>* out, std::size_t count);
+
+	/// Computes the model transforms of a joint hierarchy: model[i] = model[parents[i]] * local[i], or local[i] when parents[i] is negative.
+	/// Joints must be sorted so that parents[i] < i. local[i] must be affine. local and model may be the same array.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void localToModel(int const* parents, mat<4, 4, T, Q> const* local, mat<4, 4, T, Q>* model, std::size_t count);
+
+	/// Computes the model transforms of a joint hierarchy: model[i] = model[parents[i]] * local[i], or local[i] when parents[i] is negative.
+	/// Joints must be sorted so that parents[i] < i. local and model may be the same array.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void localToModel(int const* parents, tdualquat<T, Q> const* local, tdualquat<T, Q>* model, std::size_t count);
+
+	/// Computes the skinning matrices out[i] = model[i] * inverseBind[i] for i in [0, count), all affine.
+	/// out may be model or inverseBind.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void skinningPalette(mat<4, 4, T, Q> const* model, mat<4, 4, T, Q> const* inverseBind, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes the skinning dual quaternions out[i] = model[i] * inverseBind[i] for i in [0, count).
+	/// out may be model or inverseBind.
+	/// @see gtx_pose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void skinningPalette(tdualquat<T, Q> const* model, tdualquat<T, Q> const* inverseBind, tdualquat<T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "pose.inl"
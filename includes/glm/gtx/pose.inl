@@ -0,0 +1,196 @@
+/// @ref gtx_pose
+
+namespace glm{
+namespace detail
+{
+	// Blends the joints [first, last) of the poses
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_nlerp
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t first, std::size_t last)
+		{
+			for(std::size_t j = first; j < last; ++j)
+			{
+				qua<T, Q> const Ref(poses[0][j]);
+				qua<T, Q> Result(Ref * weights[0]);
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					qua<T, Q> const& q = poses[k][j];
+					Result += q * (glm::dot(Ref, q) < static_cast<T>(0) ? -weights[k] : weights[k]);
+				}
+				out[j] = glm::normalize(Result);
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_slerp
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t first, std::size_t last)
+		{
+			for(std::size_t j = first; j < last; ++j)
+			{
+				qua<T, Q> Result(poses[0][j]);
+				T Acc = weights[0];
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					Acc += weights[k];
+					if(Acc > static_cast<T>(0))
+						Result = glm::slerp(Result, poses[k][j], weights[k] / Acc);
+				}
+				out[j] = Result;
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_blend_vec3
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, T, Q> const* const* poses, T const* weights, std::size_t poseCount, vec<3, T, Q>* out, std::size_t first, std::size_t last)
+		{
+			for(std::size_t j = first; j < last; ++j)
+			{
+				vec<3, T, Q> Result(poses[0][j] * weights[0]);
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result += poses[k][j] * weights[k];
+				out[j] = Result;
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_compose_mat4
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, vec<3, T, Q> const* scales, mat<4, 4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				mat<3, 3, T, Q> const R(glm::mat3_cast(rotations[i]));
+				vec<3, T, Q> const S(scales ? scales[i] : vec<3, T, Q>(static_cast<T>(1)));
+
+				out[i][0] = vec<4, T, Q>(R[0] * S.x, static_cast<T>(0));
+				out[i][1] = vec<4, T, Q>(R[1] * S.y, static_cast<T>(0));
+				out[i][2] = vec<4, T, Q>(R[2] * S.z, static_cast<T>(0));
+				out[i][3] = vec<4, T, Q>(translations[i], static_cast<T>(1));
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_compose_dualquat
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, tdualquat<T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = tdualquat<T, Q>(rotations[i], translations[i]);
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_hierarchy_mat4
+	{
+		GLM_FUNC_QUALIFIER static void call(int const* parents, mat<4, 4, T, Q> const* local, mat<4, 4, T, Q>* model, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				assert(parents[i] < static_cast<int>(i));
+				model[i] = parents[i] < 0 ? local[i] : affineMultiply(model[parents[i]], local[i]);
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_hierarchy_dualquat
+	{
+		GLM_FUNC_QUALIFIER static void call(int const* parents, tdualquat<T, Q> const* local, tdualquat<T, Q>* model, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				assert(parents[i] < static_cast<int>(i));
+				model[i] = parents[i] < 0 ? local[i] : model[parents[i]] * local[i];
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_palette_mat4
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const* model, mat<4, 4, T, Q> const* inverseBind, mat<4, 4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = affineMultiply(model[i], inverseBind[i]);
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_pose_palette_dualquat
+	{
+		GLM_FUNC_QUALIFIER static void call(tdualquat<T, Q> const* model, tdualquat<T, Q> const* inverseBind, tdualquat<T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = model[i] * inverseBind[i];
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void blendRotations(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t jointCount)
+	{
+		assert(poseCount > 0);
+		detail::compute_pose_nlerp<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(poses, weights, poseCount, out, 0, jointCount);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpRotations(qua<T, Q> const* const* poses, T const* weights, std::size_t poseCount, qua<T, Q>* out, std::size_t jointCount)
+	{
+		assert(poseCount > 0);
+		detail::compute_pose_slerp<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(poses, weights, poseCount, out, 0, jointCount);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void blendVectors(vec<3, T, Q> const* const* poses, T const* weights, std::size_t poseCount, vec<3, T, Q>* out, std::size_t jointCount)
+	{
+		assert(poseCount > 0);
+		detail::compute_pose_blend_vec3<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(poses, weights, poseCount, out, 0, jointCount);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void composeTransforms(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, vec<3, T, Q> const* scales, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		detail::compute_pose_compose_mat4<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(rotations, translations, scales, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void composeTransforms(qua<T, Q> const* rotations, vec<3, T, Q> const* translations, tdualquat<T, Q>* out, std::size_t count)
+	{
+		detail::compute_pose_compose_dualquat<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(rotations, translations, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void localToModel(int const* parents, mat<4, 4, T, Q> const* local, mat<4, 4, T, Q>* model, std::size_t count)
+	{
+		detail::compute_pose_hierarchy_mat4<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(parents, local, model, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void localToModel(int const* parents, tdualquat<T, Q> const* local, tdualquat<T, Q>* model, std::size_t count)
+	{
+		detail::compute_pose_hierarchy_dualquat<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(parents, local, model, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinningPalette(mat<4, 4, T, Q> const* model, mat<4, 4, T, Q> const* inverseBind, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		detail::compute_pose_palette_mat4<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(model, inverseBind, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void skinningPalette(tdualquat<T, Q> const* model, tdualquat<T, Q> const* inverseBind, tdualquat<T, Q>* out, std::size_t count)
+	{
+		detail::compute_pose_palette_dualquat<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(model, inverseBind, out, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "pose_simd.inl"
+#endif
@@ -0,0 +1,456 @@
+/// @ref gtx_pose
+
+#include "../simd/matrix.h"
+#include "../simd/quaternion.h"
+#include "../simd/trigonometric.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Loads 4 quaternions as 4 component lanes in storage order
+	GLM_FUNC_QUALIFIER void pose_load4(float const* p, glm_vec4 v[4])
+	{
+		glm_vec4 const in[4] = {_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), _mm_loadu_ps(p + 12)};
+		glm_mat4_transpose(in, v);
+	}
+
+	GLM_FUNC_QUALIFIER void pose_store4(float* p, glm_vec4 const v[4])
+	{
+		glm_vec4 out[4];
+		glm_mat4_transpose(v, out);
+		_mm_storeu_ps(p, out[0]);
+		_mm_storeu_ps(p + 4, out[1]);
+		_mm_storeu_ps(p + 8, out[2]);
+		_mm_storeu_ps(p + 12, out[3]);
+	}
+
+	GLM_FUNC_QUALIFIER glm_vec4 pose_dot4(glm_vec4 const x[4], glm_vec4 const y[4])
+	{
+		return glm_vec4_fma(x[3], y[3], glm_vec4_fma(x[2], y[2], glm_vec4_fma(x[1], y[1], glm_vec4_mul(x[0], y[0]))));
+	}
+
+	// Loads a quaternion in (x, y, z, w) lane order whatever the storage order
+	GLM_FUNC_QUALIFIER glm_vec4 pose_load_quat(float const* p)
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			glm_vec4 const q = _mm_loadu_ps(p);
+			return _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 3, 2, 1));
+#		else
+			return _mm_loadu_ps(p);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void pose_store_quat(float* p, glm_vec4 q)
+	{
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			_mm_storeu_ps(p, _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 1, 0, 3)));
+#		else
+			_mm_storeu_ps(p, q);
+#		endif
+	}
+
+	// out = p * q, out may be p or q
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void pose_dualquat_mul(tdualquat<float, Q> const& p, tdualquat<float, Q> const& q, tdualquat<float, Q>& out)
+	{
+		glm_vec4 const pr = pose_load_quat(&p.real[0]);
+		glm_vec4 const pd = pose_load_quat(&p.dual[0]);
+		glm_vec4 const qr = pose_load_quat(&q.real[0]);
+		glm_vec4 const qd = pose_load_quat(&q.dual[0]);
+
+		pose_store_quat(&out.real[0], glm_quat_mul(pr, qr));
+		pose_store_quat(&out.dual[0], glm_vec4_add(glm_quat_mul(pr, qd), glm_quat_mul(pd, qr)));
+	}
+
+	// out = p * q for affine matrices, out may be p or q
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void pose_affine_mul(mat<4, 4, float, Q> const& p, mat<4, 4, float, Q> const& q, mat<4, 4, float, Q>& out)
+	{
+		glm_vec4 const a[4] = {_mm_loadu_ps(&p[0][0]), _mm_loadu_ps(&p[1][0]), _mm_loadu_ps(&p[2][0]), _mm_loadu_ps(&p[3][0])};
+		glm_vec4 const b[4] = {_mm_loadu_ps(&q[0][0]), _mm_loadu_ps(&q[1][0]), _mm_loadu_ps(&q[2][0]), _mm_loadu_ps(&q[3][0])};
+		glm_vec4 r[4];
+		glm_mat4_affine_mul(a, b, r);
+		_mm_storeu_ps(&out[0][0], r[0]);
+		_mm_storeu_ps(&out[1][0], r[1]);
+		_mm_storeu_ps(&out[2][0], r[2]);
+		_mm_storeu_ps(&out[3][0], r[3]);
+	}
+
+	// Slerp of 4 pairs of quaternions held as component lanes, x = slerp(x, y, a)
+	GLM_FUNC_QUALIFIER void pose_slerp4(glm_vec4 x[4], glm_vec4 const y[4], float a)
+	{
+		glm_vec4 const one = _mm_set1_ps(1.0f);
+
+		// Lanes where cosTheta < 0 negate y and cosTheta so that the interpolation takes the short way around the sphere
+		glm_vec4 CosTheta = pose_dot4(x, y);
+		glm_vec4 const Sgn = _mm_and_ps(_mm_cmplt_ps(CosTheta, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+		CosTheta = _mm_xor_ps(CosTheta, Sgn);
+
+		// Lanes where cosTheta is close to 1 use a linear interpolation, the others may divide by 0 and are discarded
+		glm_vec4 const Lerp = _mm_cmpgt_ps(CosTheta, _mm_set1_ps(1.0f - glm::epsilon<float>()));
+
+		glm_vec4 const SinTheta = _mm_sqrt_ps(glm_vec4_mul(glm_vec4_sub(one, CosTheta), glm_vec4_add(one, CosTheta)));
+		glm_vec4 const Angle = glm_vec4_atan2(SinTheta, CosTheta);
+		glm_vec4 SinA, CosA;
+		glm_vec4_sincos(glm_vec4_mul(_mm_set1_ps(a), Angle), &SinA, &CosA);
+
+		// sin((1 - a) * angle) = sin(angle) * cos(a * angle) - cos(angle) * sin(a * angle)
+		glm_vec4 const Wy = glm_vec4_div(SinA, SinTheta);
+		glm_vec4 const Wx = glm_vec4_sub(CosA, glm_vec4_mul(CosTheta, Wy));
+
+		glm_vec4 const WeightX = glm_vec4_select(Lerp, _mm_set1_ps(1.0f - a), Wx);
+		glm_vec4 const WeightY = _mm_xor_ps(glm_vec4_select(Lerp, _mm_set1_ps(a), Wy), Sgn);
+		for(int c = 0; c < 4; ++c)
+			x[c] = glm_vec4_fma(y[c], WeightY, glm_vec4_mul(x[c], WeightX));
+	}
+
+	template<qualifier Q>
+	struct compute_pose_nlerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* const* poses, float const* weights, std::size_t poseCount, qua<float, Q>* out, std::size_t first, std::size_t last)
+		{
+			glm_vec4 const zero = _mm_setzero_ps();
+			glm_vec4 const one = _mm_set1_ps(1.0f);
+
+			std::size_t j = first;
+			for(; j + 4 <= last; j += 4)
+			{
+				glm_vec4 Ref[4];
+				pose_load4(&poses[0][j][0], Ref);
+
+				glm_vec4 const W0 = _mm_set1_ps(weights[0]);
+				glm_vec4 Acc[4] = {glm_vec4_mul(Ref[0], W0), glm_vec4_mul(Ref[1], W0), glm_vec4_mul(Ref[2], W0), glm_vec4_mul(Ref[3], W0)};
+
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					glm_vec4 q[4];
+					pose_load4(&poses[k][j][0], q);
+
+					// Negate the weight of the lanes in the opposite hemisphere of the first pose
+					glm_vec4 const Sgn = _mm_and_ps(_mm_cmplt_ps(pose_dot4(Ref, q), zero), _mm_set1_ps(-0.0f));
+					glm_vec4 const W = _mm_xor_ps(_mm_set1_ps(weights[k]), Sgn);
+					for(int c = 0; c < 4; ++c)
+						Acc[c] = glm_vec4_fma(q[c], W, Acc[c]);
+				}
+
+				glm_vec4 const Len2 = pose_dot4(Acc, Acc);
+				glm_vec4 const Valid = _mm_cmpgt_ps(Len2, zero);
+				glm_vec4 const Inv = glm_vec4_div(one, _mm_sqrt_ps(Len2));
+				for(int c = 0; c < 4; ++c)
+					Acc[c] = _mm_and_ps(glm_vec4_mul(Acc[c], Inv), Valid);
+
+				// Blends of zero length return the identity
+#				ifdef GLM_FORCE_QUAT_DATA_WXYZ
+					Acc[0] = _mm_or_ps(Acc[0], _mm_andnot_ps(Valid, one));
+#				else
+					Acc[3] = _mm_or_ps(Acc[3], _mm_andnot_ps(Valid, one));
+#				endif
+
+				pose_store4(&out[j][0], Acc);
+			}
+
+			compute_pose_nlerp<float, Q, false>::call(poses, weights, poseCount, out, j, last);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_slerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* const* poses, float const* weights, std::size_t poseCount, qua<float, Q>* out, std::size_t first, std::size_t last)
+		{
+			std::size_t j = first;
+			for(; j + 4 <= last; j += 4)
+			{
+				glm_vec4 Result[4];
+				pose_load4(&poses[0][j][0], Result);
+
+				float Acc = weights[0];
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					Acc += weights[k];
+					if(Acc <= 0.0f)
+						continue;
+
+					glm_vec4 q[4];
+					pose_load4(&poses[k][j][0], q);
+					pose_slerp4(Result, q, weights[k] / Acc);
+				}
+
+				pose_store4(&out[j][0], Result);
+			}
+
+			compute_pose_slerp<float, Q, false>::call(poses, weights, poseCount, out, j, last);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_blend_vec3<float, Q, true>
+	{
+		// Blends blocks of 4 or 8 joints as flat float arrays, padding included
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* const* poses, float const* weights, std::size_t poseCount, vec<3, float, Q>* out, std::size_t first, std::size_t last)
+		{
+			std::size_t const Lanes = sizeof(vec<3, float, Q>) / sizeof(float);
+
+			std::size_t j = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; j + 8 <= last; j += 8)
+			for(std::size_t i = 0; i < Lanes * 8; i += 8)
+			{
+				glm_vec8 Result = glm_vec8_mul(_mm256_loadu_ps(reinterpret_cast<float const*>(poses[0] + j) + i), _mm256_set1_ps(weights[0]));
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result = glm_vec8_fma(_mm256_loadu_ps(reinterpret_cast<float const*>(poses[k] + j) + i), _mm256_set1_ps(weights[k]), Result);
+				_mm256_storeu_ps(reinterpret_cast<float*>(out + j) + i, Result);
+			}
+#			endif
+			for(; j + 4 <= last; j += 4)
+			for(std::size_t i = 0; i < Lanes * 4; i += 4)
+			{
+				glm_vec4 Result = glm_vec4_mul(_mm_loadu_ps(reinterpret_cast<float const*>(poses[0] + j) + i), _mm_set1_ps(weights[0]));
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result = glm_vec4_fma(_mm_loadu_ps(reinterpret_cast<float const*>(poses[k] + j) + i), _mm_set1_ps(weights[k]), Result);
+				_mm_storeu_ps(reinterpret_cast<float*>(out + j) + i, Result);
+			}
+
+			for(std::size_t n = (last - first) % 4; n > 0; --n, ++j)
+			{
+				vec<3, float, Q> Result(poses[0][j] * weights[0]);
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result += poses[k][j] * weights[k];
+				out[j] = Result;
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_compose_mat4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* rotations, vec<3, float, Q> const* translations, vec<3, float, Q> const* scales, mat<4, 4, float, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				glm_vec4 R[3];
+				glm_quat_mat3_cast(pose_load_quat(&rotations[i][0]), R);
+				if(scales)
+				{
+					R[0] = glm_vec4_mul(R[0], _mm_set1_ps(scales[i].x));
+					R[1] = glm_vec4_mul(R[1], _mm_set1_ps(scales[i].y));
+					R[2] = glm_vec4_mul(R[2], _mm_set1_ps(scales[i].z));
+				}
+
+				_mm_storeu_ps(&out[i][0][0], R[0]);
+				_mm_storeu_ps(&out[i][1][0], R[1]);
+				_mm_storeu_ps(&out[i][2][0], R[2]);
+				_mm_storeu_ps(&out[i][3][0], _mm_setr_ps(translations[i].x, translations[i].y, translations[i].z, 1.0f));
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_compose_dualquat<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* rotations, vec<3, float, Q> const* translations, tdualquat<float, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				// dual = 0.5 * translation * real
+				glm_vec4 const Real = pose_load_quat(&rotations[i][0]);
+				glm_vec4 const Half = _mm_mul_ps(_mm_setr_ps(translations[i].x, translations[i].y, translations[i].z, 0.0f), _mm_set1_ps(0.5f));
+
+				pose_store_quat(&out[i].real[0], Real);
+				pose_store_quat(&out[i].dual[0], glm_quat_mul(Half, Real));
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_hierarchy_mat4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(int const* parents, mat<4, 4, float, Q> const* local, mat<4, 4, float, Q>* model, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				assert(parents[i] < static_cast<int>(i));
+				if(parents[i] < 0)
+					model[i] = local[i];
+				else
+					pose_affine_mul(model[parents[i]], local[i], model[i]);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_hierarchy_dualquat<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(int const* parents, tdualquat<float, Q> const* local, tdualquat<float, Q>* model, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				assert(parents[i] < static_cast<int>(i));
+				if(parents[i] < 0)
+					model[i] = local[i];
+				else
+					pose_dualquat_mul(model[parents[i]], local[i], model[i]);
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_palette_mat4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const* model, mat<4, 4, float, Q> const* inverseBind, mat<4, 4, float, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				pose_affine_mul(model[i], inverseBind[i], out[i]);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_palette_dualquat<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(tdualquat<float, Q> const* model, tdualquat<float, Q> const* inverseBind, tdualquat<float, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				pose_dualquat_mul(model[i], inverseBind[i], out[i]);
+		}
+	};
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	GLM_FUNC_QUALIFIER float32x4_t pose_dot4(float32x4x4_t const& x, float32x4x4_t const& y)
+	{
+		return vfmaq_f32(vfmaq_f32(vfmaq_f32(vmulq_f32(x.val[0], y.val[0]), x.val[1], y.val[1]), x.val[2], y.val[2]), x.val[3], y.val[3]);
+	}
+
+	// Slerp of 4 pairs of quaternions held as component lanes, x = slerp(x, y, a)
+	GLM_FUNC_QUALIFIER void pose_slerp4(float32x4x4_t& x, float32x4x4_t const& y, float a)
+	{
+		float32x4_t const one = vdupq_n_f32(1.0f);
+
+		// Lanes where cosTheta < 0 negate y and cosTheta so that the interpolation takes the short way around the sphere
+		float32x4_t CosTheta = pose_dot4(x, y);
+		uint32x4_t const Sgn = vandq_u32(vcltq_f32(CosTheta, vdupq_n_f32(0.0f)), vdupq_n_u32(0x80000000u));
+		CosTheta = neon::xor_sign(CosTheta, Sgn);
+
+		// Lanes where cosTheta is close to 1 use a linear interpolation, the others may divide by 0 and are discarded
+		uint32x4_t const Lerp = vcgtq_f32(CosTheta, vdupq_n_f32(1.0f - glm::epsilon<float>()));
+
+		float32x4_t const SinTheta = vsqrtq_f32(vmulq_f32(vsubq_f32(one, CosTheta), vaddq_f32(one, CosTheta)));
+		float32x4_t const Angle = glm_vec4_atan2(SinTheta, CosTheta);
+		float32x4_t SinA, CosA;
+		glm_vec4_sincos(vmulq_n_f32(Angle, a), &SinA, &CosA);
+
+		// sin((1 - a) * angle) = sin(angle) * cos(a * angle) - cos(angle) * sin(a * angle)
+		float32x4_t const Wy = vdivq_f32(SinA, SinTheta);
+		float32x4_t const Wx = vfmsq_f32(CosA, CosTheta, Wy);
+
+		float32x4_t const WeightX = vbslq_f32(Lerp, vdupq_n_f32(1.0f - a), Wx);
+		float32x4_t const WeightY = neon::xor_sign(vbslq_f32(Lerp, vdupq_n_f32(a), Wy), Sgn);
+		for(int c = 0; c < 4; ++c)
+			x.val[c] = vfmaq_f32(vmulq_f32(x.val[c], WeightX), y.val[c], WeightY);
+	}
+
+	template<qualifier Q>
+	struct compute_pose_nlerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* const* poses, float const* weights, std::size_t poseCount, qua<float, Q>* out, std::size_t first, std::size_t last)
+		{
+			float32x4_t const zero = vdupq_n_f32(0.0f);
+			float32x4_t const one = vdupq_n_f32(1.0f);
+
+			std::size_t j = first;
+			for(; j + 4 <= last; j += 4)
+			{
+				// vld4q and vst4q transpose 4 quaternions to component lanes and back
+				float32x4x4_t const Ref = vld4q_f32(&poses[0][j][0]);
+				float32x4x4_t Acc;
+				for(int c = 0; c < 4; ++c)
+					Acc.val[c] = vmulq_n_f32(Ref.val[c], weights[0]);
+
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					float32x4x4_t const q = vld4q_f32(&poses[k][j][0]);
+
+					// Negate the weight of the lanes in the opposite hemisphere of the first pose
+					uint32x4_t const Sgn = vandq_u32(vcltq_f32(pose_dot4(Ref, q), zero), vdupq_n_u32(0x80000000u));
+					float32x4_t const W = neon::xor_sign(vdupq_n_f32(weights[k]), Sgn);
+					for(int c = 0; c < 4; ++c)
+						Acc.val[c] = vfmaq_f32(Acc.val[c], q.val[c], W);
+				}
+
+				float32x4_t const Len2 = pose_dot4(Acc, Acc);
+				uint32x4_t const Valid = vcgtq_f32(Len2, zero);
+				float32x4_t const Inv = vdivq_f32(one, vsqrtq_f32(Len2));
+				for(int c = 0; c < 4; ++c)
+					Acc.val[c] = vbslq_f32(Valid, vmulq_f32(Acc.val[c], Inv), zero);
+
+				// Blends of zero length return the identity
+#				ifdef GLM_FORCE_QUAT_DATA_WXYZ
+					Acc.val[0] = vbslq_f32(Valid, Acc.val[0], one);
+#				else
+					Acc.val[3] = vbslq_f32(Valid, Acc.val[3], one);
+#				endif
+
+				vst4q_f32(&out[j][0], Acc);
+			}
+
+			compute_pose_nlerp<float, Q, false>::call(poses, weights, poseCount, out, j, last);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_slerp<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* const* poses, float const* weights, std::size_t poseCount, qua<float, Q>* out, std::size_t first, std::size_t last)
+		{
+			std::size_t j = first;
+			for(; j + 4 <= last; j += 4)
+			{
+				float32x4x4_t Result = vld4q_f32(&poses[0][j][0]);
+
+				float Acc = weights[0];
+				for(std::size_t k = 1; k < poseCount; ++k)
+				{
+					Acc += weights[k];
+					if(Acc <= 0.0f)
+						continue;
+
+					pose_slerp4(Result, vld4q_f32(&poses[k][j][0]), weights[k] / Acc);
+				}
+
+				vst4q_f32(&out[j][0], Result);
+			}
+
+			compute_pose_slerp<float, Q, false>::call(poses, weights, poseCount, out, j, last);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_pose_blend_vec3<float, Q, true>
+	{
+		// Blends blocks of 4 joints as flat float arrays, padding included
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* const* poses, float const* weights, std::size_t poseCount, vec<3, float, Q>* out, std::size_t first, std::size_t last)
+		{
+			std::size_t const Lanes = sizeof(vec<3, float, Q>) / sizeof(float);
+
+			std::size_t j = first;
+			for(; j + 4 <= last; j += 4)
+			for(std::size_t i = 0; i < Lanes * 4; i += 4)
+			{
+				float32x4_t Result = vmulq_n_f32(vld1q_f32(reinterpret_cast<float const*>(poses[0] + j) + i), weights[0]);
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result = vfmaq_n_f32(Result, vld1q_f32(reinterpret_cast<float const*>(poses[k] + j) + i), weights[k]);
+				vst1q_f32(reinterpret_cast<float*>(out + j) + i, Result);
+			}
+
+			for(std::size_t n = (last - first) % 4; n > 0; --n, ++j)
+			{
+				vec<3, float, Q> Result(poses[0][j] * weights[0]);
+				for(std::size_t k = 1; k < poseCount; ++k)
+					Result += poses[k][j] * weights[k];
+				out[j] = Result;
+			}
+		}
+	};
+#endif//GLM_ARCH
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,186 @@
+/// @ref gtx_random
+/// @file glm/gtx/random.hpp
+///
+/// @see core (dependence)
+/// @see gtc_random (dependence)
+///
+/// @defgroup gtx_random GLM_GTX_random
+/// @ingroup gtx
+///
+/// Include <glm/gtx/random.hpp> to use the features of this extension.
+///
+/// Explicit random generator for the distributions of gtc_random.
+///
+/// The functions of gtc_random share the global state of std::rand: they can't be seeded per use,
+/// they can't be called from several threads and they are slow. xoshiro128 is a small generator
+/// (xoshiro128** of Blackman and Vigna, 128 bits of state, period 2^128 - 1) passed explicitly to
+/// overloads of linearRand, gaussRand, circularRand, sphericalRand, diskRand and ballRand.
+/// A generator is used by a single thread: each thread builds its own with the same seed and its own stream index.
+///
+/// The *RandArray functions fill arrays from 8 generators seeded by the given one and run side by side,
+/// with SSE2, AVX2 or NEON when available. The generated values don't depend on the instruction set, up to the
+/// rounding of the multiply-adds the compiler may contract, but they are not those of the repeated calls of the scalar overloads.
+///
+/// @code
+/// #include <glm/gtx/random.hpp>
+///
+/// glm::xoshiro128 Generator(Seed, ThreadIndex);
+/// glm::vec3 const Position = glm::ballRand(Generator, 2.0f);
+/// glm::linearRandArray(Generator, glm::vec3(-1.0f), glm::vec3(1.0f), Velocities, Count);
+/// @endcode
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtc/random.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_random is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_random extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_random
+	/// @{
+
+	/// xoshiro128** generator of 32 bits unsigned integers.
+	/// It meets the requirements of the standard uniform random bit generators and may be used with the distributions of <random>.
+	///
+	/// @see gtx_random
+	struct xoshiro128
+	{
+		typedef uint32 result_type;
+
+		/// Builds the generator of the seed 0 and the stream 0
+		GLM_FUNC_DISCARD_DECL xoshiro128();
+
+		/// Builds the generator of a seed and a stream. The stream k starts k * 2^64 values after the stream 0,
+		/// so the streams of a seed don't overlap. The construction costs O(stream): use small stream indices, like thread indices.
+		GLM_FUNC_DISCARD_DECL explicit xoshiro128(uint64 seed, uint64 stream = 0);
+
+		// The distributions of <random> use min() and max() in constant expressions, with or without GLM_CONSTEXPR
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			GLM_FUNC_QUALIFIER static constexpr result_type min(){return 0u;}
+			GLM_FUNC_QUALIFIER static constexpr result_type max(){return 0xFFFFFFFFu;}
+#		else
+			GLM_FUNC_QUALIFIER static result_type min(){return 0u;}
+			GLM_FUNC_QUALIFIER static result_type max(){return 0xFFFFFFFFu;}
+#		endif
+
+		/// Returns the next value and advances the state
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advances the state by 2^64 values
+		GLM_FUNC_DISCARD_DECL void jump();
+
+		uint32 state[4];
+	};
+
+	/// Generates a random number in the interval [Min, Max], according a linear distribution.
+	/// Integers are drawn without bias. Floating-point values are Min + u * (Max - Min) with u uniform in [0, 1),
+	/// which can round to Max: like gtc/random, both bounds are included.
+	///
+	/// @tparam genType Value type. Supported: floating-point and integer scalars.
+	/// @see gtx_random
+	template<typename genType>
+	GLM_FUNC_DECL genType linearRand(xoshiro128& Generator, genType Min, genType Max);
+
+	/// Generates random numbers in the interval [Min, Max], according a linear distribution, component by component.
+	///
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
+
+	/// Generates a random number according a gaussian distribution of mean Mean and standard deviation Deviation.
+	///
+	/// @tparam genType Value type. Supported: floating-point scalars.
+	/// @see gtx_random
+	template<typename genType>
+	GLM_FUNC_DECL genType gaussRand(xoshiro128& Generator, genType Mean, genType Deviation);
+
+	/// Generates random numbers according gaussian distributions, component by component.
+	///
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> gaussRand(xoshiro128& Generator, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation);
+
+	/// Generates a random 2D vector which coordinates are regularly distributed on a circle of a given radius.
+	///
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(xoshiro128& Generator, T Radius);
+
+	/// Generates a random 3D vector which coordinates are regularly distributed on a sphere of a given radius.
+	///
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(xoshiro128& Generator, T Radius);
+
+	/// Generates a random 2D vector which coordinates are regularly distributed within the area of a disk of a given radius.
+	///
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(xoshiro128& Generator, T Radius);
+
+	/// Generates a random 3D vector which coordinates are regularly distributed within the volume of a ball of a given radius.
+	///
+	/// @see gtx_random
+	template<typename T>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(xoshiro128& Generator, T Radius);
+
+	/// Fills out[i] for i in [0, count) with linearRand values, in [Min, Max] as well.
+	///
+	/// @see gtx_random
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void linearRandArray(xoshiro128& Generator, genType Min, genType Max, genType* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with linearRand vectors.
+	///
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void linearRandArray(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with gaussRand values.
+	///
+	/// @see gtx_random
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void gaussRandArray(xoshiro128& Generator, genType Mean, genType Deviation, genType* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with gaussRand vectors.
+	///
+	/// @see gtx_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void gaussRandArray(xoshiro128& Generator, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, vec<L, T, Q>* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with circularRand vectors.
+	///
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRandArray(xoshiro128& Generator, T Radius, vec<2, T, Q>* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with sphericalRand vectors.
+	///
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRandArray(xoshiro128& Generator, T Radius, vec<3, T, Q>* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with diskRand vectors.
+	///
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRandArray(xoshiro128& Generator, T Radius, vec<2, T, Q>* out, std::size_t count);
+
+	/// Fills out[i] for i in [0, count) with ballRand vectors.
+	///
+	/// @see gtx_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void ballRandArray(xoshiro128& Generator, T Radius, vec<3, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "random.inl"
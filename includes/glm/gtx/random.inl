@@ -0,0 +1,485 @@
+/// @ref gtx_random
+
+namespace glm{
+namespace detail
+{
+	GLM_FUNC_QUALIFIER uint64 random_splitmix64(uint64& x)
+	{
+		x += static_cast<uint64>(0x9E3779B97F4A7C15ull);
+		uint64 z = x;
+		z = (z ^ (z >> 30)) * static_cast<uint64>(0xBF58476D1CE4E5B9ull);
+		z = (z ^ (z >> 27)) * static_cast<uint64>(0x94D049BB133111EBull);
+		return z ^ (z >> 31);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 random_rotl(uint32 x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+	GLM_FUNC_QUALIFIER uint32 random_xoshiro128_next(uint32& s0, uint32& s1, uint32& s2, uint32& s3)
+	{
+		uint32 const Result = random_rotl(s1 * 5u, 7) * 9u;
+		uint32 const t = s1 << 9;
+
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = random_rotl(s3, 11);
+
+		return Result;
+	}
+
+	// Uniform floating-point values in [0, 1) from the high bits of the generated integers
+	template<typename G>
+	GLM_FUNC_QUALIFIER float random_unit_float(G& Generator)
+	{
+		return static_cast<float>(Generator() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	template<typename G>
+	GLM_FUNC_QUALIFIER double random_unit_double(G& Generator)
+	{
+		uint64 const Hi = Generator();
+		uint64 const Lo = Generator();
+		return static_cast<double>(((Hi << 32) | Lo) >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+	// Integers of 32 bits or less: Lemire's multiply and shift with rejection of the biased values
+	template<typename T, bool Wide = (sizeof(T) > 4)>
+	struct compute_linearRand_generator
+	{
+		template<typename G>
+		GLM_FUNC_QUALIFIER static T call(G& Generator, T Min, T Max)
+		{
+			uint32 const Range = static_cast<uint32>(static_cast<uint32>(Max) - static_cast<uint32>(Min)) + 1u;
+			if(Range == 0u)
+				return static_cast<T>(Generator());
+
+			uint64 m = static_cast<uint64>(Generator()) * Range;
+			uint32 l = static_cast<uint32>(m);
+			if(l < Range)
+			{
+				uint32 const Threshold = (0u - Range) % Range;
+				while(l < Threshold)
+				{
+					m = static_cast<uint64>(Generator()) * Range;
+					l = static_cast<uint32>(m);
+				}
+			}
+			return static_cast<T>(static_cast<uint32>(Min) + static_cast<uint32>(m >> 32));
+		}
+	};
+
+	// 64 bits integers: rejection of the values below 2^64 mod Range
+	template<typename T>
+	struct compute_linearRand_generator<T, true>
+	{
+		template<typename G>
+		GLM_FUNC_QUALIFIER static T call(G& Generator, T Min, T Max)
+		{
+			uint64 const Range = static_cast<uint64>(Max) - static_cast<uint64>(Min) + static_cast<uint64>(1);
+			uint64 const Threshold = Range == static_cast<uint64>(0) ? static_cast<uint64>(0) : (static_cast<uint64>(0) - Range) % Range;
+
+			uint64 x = 0;
+			do
+			{
+				uint64 const Hi = Generator();
+				uint64 const Lo = Generator();
+				x = (Hi << 32) | Lo;
+			}
+			while(x < Threshold);
+
+			return static_cast<T>(Range == static_cast<uint64>(0) ? x : static_cast<uint64>(Min) + x % Range);
+		}
+	};
+
+	template<>
+	struct compute_linearRand_generator<float, false>
+	{
+		template<typename G>
+		GLM_FUNC_QUALIFIER static float call(G& Generator, float Min, float Max)
+		{
+			return random_unit_float(Generator) * (Max - Min) + Min;
+		}
+	};
+
+	template<>
+	struct compute_linearRand_generator<double, true>
+	{
+		template<typename G>
+		GLM_FUNC_QUALIFIER static double call(G& Generator, double Min, double Max)
+		{
+			return random_unit_double(Generator) * (Max - Min) + Min;
+		}
+	};
+
+	template<>
+	struct compute_linearRand_generator<long double, true>
+	{
+		template<typename G>
+		GLM_FUNC_QUALIFIER static long double call(G& Generator, long double Min, long double Max)
+		{
+			return static_cast<long double>(random_unit_double(Generator)) * (Max - Min) + Min;
+		}
+	};
+
+	// Marsaglia's polar method
+	template<typename T, typename G>
+	GLM_FUNC_QUALIFIER T random_gauss(G& Generator, T Mean, T Deviation)
+	{
+		T w, x1, x2;
+
+		do
+		{
+			x1 = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+			x2 = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+
+			w = x1 * x1 + x2 * x2;
+		} while(w >= T(1) || w <= T(0));
+
+		return x2 * Deviation * sqrt((T(-2) * log(w)) / w) + Mean;
+	}
+
+	// A point of the unit disk, other than the center, projected on the circle
+	template<typename T, qualifier Q, typename G>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> random_circular(G& Generator, T Radius)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		T x, y, r2;
+
+		do
+		{
+			x = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+			y = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+
+			r2 = x * x + y * y;
+		} while(r2 > T(1) || r2 <= T(0));
+
+		return vec<2, T, Q>(x, y) * (Radius / sqrt(r2));
+	}
+
+	// Marsaglia's method: a point (x, y) of the unit disk gives (2x sqrt(1 - s), 2y sqrt(1 - s), 1 - 2s) with s = x^2 + y^2
+	template<typename T, qualifier Q, typename G>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> random_spherical(G& Generator, T Radius)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		T x, y, s;
+
+		do
+		{
+			x = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+			y = compute_linearRand_generator<T>::call(Generator, T(-1), T(1));
+
+			s = x * x + y * y;
+		} while(s >= T(1));
+
+		T const h = T(2) * sqrt(T(1) - s);
+		return vec<3, T, Q>(x * h, y * h, T(1) - T(2) * s) * Radius;
+	}
+
+	template<length_t L, typename T, qualifier Q, typename G>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> random_ball(G& Generator, T Radius)
+	{
+		assert(Radius > static_cast<T>(0));
+
+		vec<L, T, Q> Result(T(0));
+
+		do
+		{
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = compute_linearRand_generator<T>::call(Generator, -Radius, Radius);
+		}
+		while(dot(Result, Result) > Radius * Radius);
+
+		return Result;
+	}
+
+	// 8 xoshiro128** generators run side by side, state[w][l] being the word w of the generator l
+	struct random_lanes
+	{
+		enum {size = 8};
+
+		uint32 state[4][size];
+	};
+
+	// The lanes are seeded with splitmix64 from 64 bits of the generator, as recommended for xoshiro generators
+	GLM_FUNC_QUALIFIER void random_lanes_seed(random_lanes& Lanes, xoshiro128& Generator)
+	{
+		uint64 const Hi = Generator();
+		uint64 const Lo = Generator();
+		uint64 Seed = (Hi << 32) | Lo;
+
+		for(length_t l = 0; l < random_lanes::size; ++l)
+		for(length_t w = 0; w < 4; w += 2)
+		{
+			uint64 const z = random_splitmix64(Seed);
+			Lanes.state[w + 0][l] = static_cast<uint32>(z);
+			Lanes.state[w + 1][l] = static_cast<uint32>(z >> 32);
+		}
+	}
+
+	// Writes count values, a multiple of random_lanes::size: out[size * j + l] is the j-th value of the generator l
+	template<bool UseSimd>
+	struct compute_random_lanes
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, uint32* out, std::size_t count)
+		{
+			for(std::size_t j = 0; j < count; j += random_lanes::size)
+			for(length_t l = 0; l < random_lanes::size; ++l)
+				out[j + l] = random_xoshiro128_next(Lanes.state[0][l], Lanes.state[1][l], Lanes.state[2][l], Lanes.state[3][l]);
+		}
+	};
+
+	// Same order as compute_random_lanes, with the values mapped to random_unit_float(x) * scale + offset
+	template<bool UseSimd>
+	struct compute_random_unit_lanes
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, float* out, std::size_t count, float scale, float offset)
+		{
+			for(std::size_t j = 0; j < count; j += random_lanes::size)
+			for(length_t l = 0; l < random_lanes::size; ++l)
+				out[j + l] = static_cast<float>(random_xoshiro128_next(Lanes.state[0][l], Lanes.state[1][l], Lanes.state[2][l], Lanes.state[3][l]) >> 8) * (1.0f / 16777216.0f) * scale + offset;
+		}
+	};
+
+	// Generator of the values of the lanes in their order, computed by blocks
+	template<bool UseSimd>
+	struct random_lanes_generator
+	{
+		typedef uint32 result_type;
+
+		enum {block = 256};
+
+		GLM_FUNC_QUALIFIER explicit random_lanes_generator(xoshiro128& Generator)
+			: index(block)
+		{
+			random_lanes_seed(lanes, Generator);
+		}
+
+		GLM_FUNC_QUALIFIER result_type operator()()
+		{
+			if(index == block)
+			{
+				compute_random_lanes<UseSimd>::call(lanes, values, block);
+				index = 0;
+			}
+			return values[index++];
+		}
+
+		random_lanes lanes;
+		uint32 values[block];
+		std::size_t index;
+	};
+
+	template<typename T, bool UseSimd>
+	struct compute_linearRandArray
+	{
+		GLM_FUNC_QUALIFIER static void call(xoshiro128& Generator, T Min, T Max, T* out, std::size_t count)
+		{
+			random_lanes_generator<UseSimd> Lanes(Generator);
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = compute_linearRand_generator<T>::call(Lanes, Min, Max);
+		}
+	};
+
+	template<bool UseSimd>
+	struct compute_linearRandArray<float, UseSimd>
+	{
+		GLM_FUNC_QUALIFIER static void call(xoshiro128& Generator, float Min, float Max, float* out, std::size_t count)
+		{
+			random_lanes Lanes;
+			random_lanes_seed(Lanes, Generator);
+
+			std::size_t const Whole = count - count % random_lanes::size;
+			compute_random_unit_lanes<UseSimd>::call(Lanes, out, Whole, Max - Min, Min);
+			if(Whole < count)
+			{
+				float Tail[random_lanes::size];
+				compute_random_unit_lanes<UseSimd>::call(Lanes, Tail, random_lanes::size, Max - Min, Min);
+				for(std::size_t i = Whole; i < count; ++i)
+					out[i] = Tail[i - Whole];
+			}
+		}
+	};
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128()
+	{
+		uint64 Seed = 0;
+		uint64 const a = detail::random_splitmix64(Seed);
+		uint64 const b = detail::random_splitmix64(Seed);
+		state[0] = static_cast<uint32>(a);
+		state[1] = static_cast<uint32>(a >> 32);
+		state[2] = static_cast<uint32>(b);
+		state[3] = static_cast<uint32>(b >> 32);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128::xoshiro128(uint64 seed, uint64 stream)
+	{
+		uint64 const a = detail::random_splitmix64(seed);
+		uint64 const b = detail::random_splitmix64(seed);
+		state[0] = static_cast<uint32>(a);
+		state[1] = static_cast<uint32>(a >> 32);
+		state[2] = static_cast<uint32>(b);
+		state[3] = static_cast<uint32>(b >> 32);
+
+		for(uint64 i = 0; i < stream; ++i)
+			this->jump();
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128::result_type xoshiro128::operator()()
+	{
+		return detail::random_xoshiro128_next(state[0], state[1], state[2], state[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128::jump()
+	{
+		uint32 const Jump[4] = {0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu};
+
+		uint32 s[4] = {0u, 0u, 0u, 0u};
+		for(length_t i = 0; i < 4; ++i)
+		for(int b = 0; b < 32; ++b)
+		{
+			if(Jump[i] & (1u << b))
+			{
+				s[0] ^= state[0];
+				s[1] ^= state[1];
+				s[2] ^= state[2];
+				s[3] ^= state[3];
+			}
+			detail::random_xoshiro128_next(state[0], state[1], state[2], state[3]);
+		}
+
+		state[0] = s[0];
+		state[1] = s[1];
+		state[2] = s[2];
+		state[3] = s[3];
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType linearRand(xoshiro128& Generator, genType Min, genType Max)
+	{
+		return detail::compute_linearRand_generator<genType>::call(Generator, Min, Max);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = detail::compute_linearRand_generator<T>::call(Generator, Min[i], Max[i]);
+		return Result;
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType gaussRand(xoshiro128& Generator, genType Mean, genType Deviation)
+	{
+		return detail::random_gauss(Generator, Mean, Deviation);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(xoshiro128& Generator, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = detail::random_gauss(Generator, Mean[i], Deviation[i]);
+		return Result;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::random_circular<T, defaultp>(Generator, Radius);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::random_spherical<T, defaultp>(Generator, Radius);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::random_ball<2, T, defaultp>(Generator, Radius);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(xoshiro128& Generator, T Radius)
+	{
+		return detail::random_ball<3, T, defaultp>(Generator, Radius);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void linearRandArray(xoshiro128& Generator, genType Min, genType Max, genType* out, std::size_t count)
+	{
+		detail::compute_linearRandArray<genType, GLM_CONFIG_SIMD == GLM_ENABLE>::call(Generator, Min, Max, out, count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void linearRandArray(xoshiro128& Generator, vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+		for(length_t c = 0; c < L; ++c)
+			out[i][c] = detail::compute_linearRand_generator<T>::call(Lanes, Min[c], Max[c]);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void gaussRandArray(xoshiro128& Generator, genType Mean, genType Deviation, genType* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::random_gauss(Lanes, Mean, Deviation);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void gaussRandArray(xoshiro128& Generator, vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, vec<L, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+		for(length_t c = 0; c < L; ++c)
+			out[i][c] = detail::random_gauss(Lanes, Mean[c], Deviation[c]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRandArray(xoshiro128& Generator, T Radius, vec<2, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::random_circular<T, Q>(Lanes, Radius);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRandArray(xoshiro128& Generator, T Radius, vec<3, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::random_spherical<T, Q>(Lanes, Radius);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRandArray(xoshiro128& Generator, T Radius, vec<2, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::random_ball<2, T, Q>(Lanes, Radius);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void ballRandArray(xoshiro128& Generator, T Radius, vec<3, T, Q>* out, std::size_t count)
+	{
+		detail::random_lanes_generator<GLM_CONFIG_SIMD == GLM_ENABLE> Lanes(Generator);
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::random_ball<3, T, Q>(Lanes, Radius);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
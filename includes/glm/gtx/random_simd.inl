@@ -0,0 +1,233 @@
+/// @ref gtx_random
+
+namespace glm{
+namespace detail
+{
+	// The 8 generators of random_lanes are stepped together: 2 registers of 4 lanes with SSE2 and NEON, 1 register of 8 lanes with AVX2.
+	// The multiplications by 5 and 9 of xoshiro128** are shifts and additions.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER glm_uvec4 random_rotl4(glm_uvec4 x, int k)
+	{
+		return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+	}
+
+	GLM_FUNC_QUALIFIER glm_uvec4 random_xoshiro128_next4(glm_uvec4 s[4])
+	{
+		glm_uvec4 const r = random_rotl4(_mm_add_epi32(s[1], _mm_slli_epi32(s[1], 2)), 7);
+		glm_uvec4 const Result = _mm_add_epi32(r, _mm_slli_epi32(r, 3));
+		glm_uvec4 const t = _mm_slli_epi32(s[1], 9);
+
+		s[2] = _mm_xor_si128(s[2], s[0]);
+		s[3] = _mm_xor_si128(s[3], s[1]);
+		s[1] = _mm_xor_si128(s[1], s[2]);
+		s[0] = _mm_xor_si128(s[0], s[3]);
+		s[2] = _mm_xor_si128(s[2], t);
+		s[3] = random_rotl4(s[3], 11);
+
+		return Result;
+	}
+
+	// random_unit_float(x) * Scale + Offset
+	GLM_FUNC_QUALIFIER glm_vec4 random_unit4(glm_uvec4 x, glm_vec4 Scale, glm_vec4 Offset)
+	{
+		glm_vec4 const Unit = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+		return _mm_add_ps(_mm_mul_ps(Unit, Scale), Offset);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER __m256i random_rotl8(__m256i x, int k)
+	{
+		return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+	}
+
+	GLM_FUNC_QUALIFIER __m256i random_xoshiro128_next8(__m256i s[4])
+	{
+		__m256i const r = random_rotl8(_mm256_add_epi32(s[1], _mm256_slli_epi32(s[1], 2)), 7);
+		__m256i const Result = _mm256_add_epi32(r, _mm256_slli_epi32(r, 3));
+		__m256i const t = _mm256_slli_epi32(s[1], 9);
+
+		s[2] = _mm256_xor_si256(s[2], s[0]);
+		s[3] = _mm256_xor_si256(s[3], s[1]);
+		s[1] = _mm256_xor_si256(s[1], s[2]);
+		s[0] = _mm256_xor_si256(s[0], s[3]);
+		s[2] = _mm256_xor_si256(s[2], t);
+		s[3] = random_rotl8(s[3], 11);
+
+		return Result;
+	}
+
+	template<>
+	struct compute_random_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, uint32* out, std::size_t count)
+		{
+			__m256i s[4];
+			for(length_t w = 0; w < 4; ++w)
+				s[w] = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Lanes.state[w]));
+
+			for(std::size_t j = 0; j < count; j += 8)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), random_xoshiro128_next8(s));
+
+			for(length_t w = 0; w < 4; ++w)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Lanes.state[w]), s[w]);
+		}
+	};
+
+	template<>
+	struct compute_random_unit_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, float* out, std::size_t count, float scale, float offset)
+		{
+			__m256i s[4];
+			for(length_t w = 0; w < 4; ++w)
+				s[w] = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(Lanes.state[w]));
+
+			glm_vec8 const Scale = _mm256_set1_ps(scale);
+			glm_vec8 const Offset = _mm256_set1_ps(offset);
+			for(std::size_t j = 0; j < count; j += 8)
+			{
+				glm_vec8 const Unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(random_xoshiro128_next8(s), 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+				_mm256_storeu_ps(out + j, _mm256_add_ps(_mm256_mul_ps(Unit, Scale), Offset));
+			}
+
+			for(length_t w = 0; w < 4; ++w)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Lanes.state[w]), s[w]);
+		}
+	};
+#	else
+	template<>
+	struct compute_random_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, uint32* out, std::size_t count)
+		{
+			glm_uvec4 Lo[4], Hi[4];
+			for(length_t w = 0; w < 4; ++w)
+			{
+				Lo[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Lanes.state[w] + 0));
+				Hi[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Lanes.state[w] + 4));
+			}
+
+			for(std::size_t j = 0; j < count; j += 8)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + j + 0), random_xoshiro128_next4(Lo));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + j + 4), random_xoshiro128_next4(Hi));
+			}
+
+			for(length_t w = 0; w < 4; ++w)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Lanes.state[w] + 0), Lo[w]);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Lanes.state[w] + 4), Hi[w]);
+			}
+		}
+	};
+
+	template<>
+	struct compute_random_unit_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, float* out, std::size_t count, float scale, float offset)
+		{
+			glm_uvec4 Lo[4], Hi[4];
+			for(length_t w = 0; w < 4; ++w)
+			{
+				Lo[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Lanes.state[w] + 0));
+				Hi[w] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Lanes.state[w] + 4));
+			}
+
+			glm_vec4 const Scale = _mm_set1_ps(scale);
+			glm_vec4 const Offset = _mm_set1_ps(offset);
+			for(std::size_t j = 0; j < count; j += 8)
+			{
+				_mm_storeu_ps(out + j + 0, random_unit4(random_xoshiro128_next4(Lo), Scale, Offset));
+				_mm_storeu_ps(out + j + 4, random_unit4(random_xoshiro128_next4(Hi), Scale, Offset));
+			}
+
+			for(length_t w = 0; w < 4; ++w)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Lanes.state[w] + 0), Lo[w]);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Lanes.state[w] + 4), Hi[w]);
+			}
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	GLM_FUNC_QUALIFIER uint32x4_t random_xoshiro128_next4(uint32x4_t s[4])
+	{
+		uint32x4_t const x = vaddq_u32(s[1], vshlq_n_u32(s[1], 2));
+		uint32x4_t const r = vorrq_u32(vshlq_n_u32(x, 7), vshrq_n_u32(x, 25));
+		uint32x4_t const Result = vaddq_u32(r, vshlq_n_u32(r, 3));
+		uint32x4_t const t = vshlq_n_u32(s[1], 9);
+
+		s[2] = veorq_u32(s[2], s[0]);
+		s[3] = veorq_u32(s[3], s[1]);
+		s[1] = veorq_u32(s[1], s[2]);
+		s[0] = veorq_u32(s[0], s[3]);
+		s[2] = veorq_u32(s[2], t);
+		s[3] = vorrq_u32(vshlq_n_u32(s[3], 11), vshrq_n_u32(s[3], 21));
+
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER float32x4_t random_unit4(uint32x4_t x, float32x4_t Scale, float32x4_t Offset)
+	{
+		float32x4_t const Unit = vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(x, 8)), vdupq_n_f32(1.0f / 16777216.0f));
+		return vaddq_f32(vmulq_f32(Unit, Scale), Offset);
+	}
+
+	template<>
+	struct compute_random_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, uint32* out, std::size_t count)
+		{
+			uint32x4_t Lo[4], Hi[4];
+			for(length_t w = 0; w < 4; ++w)
+			{
+				Lo[w] = vld1q_u32(Lanes.state[w] + 0);
+				Hi[w] = vld1q_u32(Lanes.state[w] + 4);
+			}
+
+			for(std::size_t j = 0; j < count; j += 8)
+			{
+				vst1q_u32(out + j + 0, random_xoshiro128_next4(Lo));
+				vst1q_u32(out + j + 4, random_xoshiro128_next4(Hi));
+			}
+
+			for(length_t w = 0; w < 4; ++w)
+			{
+				vst1q_u32(Lanes.state[w] + 0, Lo[w]);
+				vst1q_u32(Lanes.state[w] + 4, Hi[w]);
+			}
+		}
+	};
+
+	template<>
+	struct compute_random_unit_lanes<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(random_lanes& Lanes, float* out, std::size_t count, float scale, float offset)
+		{
+			uint32x4_t Lo[4], Hi[4];
+			for(length_t w = 0; w < 4; ++w)
+			{
+				Lo[w] = vld1q_u32(Lanes.state[w] + 0);
+				Hi[w] = vld1q_u32(Lanes.state[w] + 4);
+			}
+
+			float32x4_t const Scale = vdupq_n_f32(scale);
+			float32x4_t const Offset = vdupq_n_f32(offset);
+			for(std::size_t j = 0; j < count; j += 8)
+			{
+				vst1q_f32(out + j + 0, random_unit4(random_xoshiro128_next4(Lo), Scale, Offset));
+				vst1q_f32(out + j + 4, random_unit4(random_xoshiro128_next4(Hi), Scale, Offset));
+			}
+
+			for(length_t w = 0; w < 4; ++w)
+			{
+				vst1q_u32(Lanes.state[w] + 0, Lo[w]);
+				vst1q_u32(Lanes.state[w] + 4, Hi[w]);
+			}
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,60 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+///
+/// @see core (dependence)
+/// @see gtx_dual_quaternion (dependence)
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// Include <glm/gtx/skinning.hpp> to use the features of this extension.
+///
+/// Skinning of vertex arrays by a palette of bone transforms, with linear blending of matrices or dual quaternions.
+/// Each vertex is influenced by the same number of bones, its bone indices and weights are stored contiguously:
+/// the bones of vertex i are indices[i * influences + k] weighted by weights[i * influences + k] for k in [0, influences).
+/// Vertices are independent: a vertex array can be split in chunks skinned on different threads.
+/// The SIMD paths skin 4 vertices per iteration, 8 with AVX.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_skinning is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_skinning extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	/// Linear blend skinning: outPositions[i] = vec3(M * vec4(positions[i], 1)) and outNormals[i] = normalize(mat3(M) * normals[i])
+	/// for i in [0, count), where M is the weighted sum of the affine bone matrices of vertex i.
+	/// normals and outNormals may be null. The output arrays may be the input arrays.
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DISCARD_DECL void linearBlendSkinning(
+		mat<4, 4, T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count);
+
+	/// Dual quaternion skinning: outPositions[i] = B * positions[i] and outNormals[i] = B.real * normals[i] for i in [0, count),
+	/// where B is the normalized weighted sum of the unit bone dual quaternions of vertex i.
+	/// Bones in the opposite hemisphere of the first bone of a vertex are negated before the sum so that the blend takes the short way.
+	/// normals and outNormals may be null. The output arrays may be the input arrays.
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DISCARD_DECL void dualQuaternionSkinning(
+		tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
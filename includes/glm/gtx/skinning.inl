@@ -0,0 +1,85 @@
+/// @ref gtx_skinning
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, typename I, bool UseSimd>
+	struct compute_skin_linear
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			mat<4, 4, T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+			vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+			vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				I const* Index = indices + i * static_cast<std::size_t>(influences);
+				T const* Weight = weights + i * static_cast<std::size_t>(influences);
+
+				mat<4, 4, T, Q> Blend(palette[Index[0]] * Weight[0]);
+				for(length_t k = 1; k < influences; ++k)
+					Blend += palette[Index[k]] * Weight[k];
+
+				if(normals)
+					outNormals[i] = normalize(mat<3, 3, T, Q>(Blend) * normals[i]);
+				outPositions[i] = vec<3, T, Q>(Blend * vec<4, T, Q>(positions[i], static_cast<T>(1)));
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, typename I, bool UseSimd>
+	struct compute_skin_dualquat
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+			vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+			vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				I const* Index = indices + i * static_cast<std::size_t>(influences);
+				T const* Weight = weights + i * static_cast<std::size_t>(influences);
+
+				tdualquat<T, Q> const& First = palette[Index[0]];
+				tdualquat<T, Q> Blend(First * Weight[0]);
+				for(length_t k = 1; k < influences; ++k)
+				{
+					tdualquat<T, Q> const& Bone = palette[Index[k]];
+					Blend = Blend + Bone * (glm::dot(First.real, Bone.real) < static_cast<T>(0) ? -Weight[k] : Weight[k]);
+				}
+				Blend = glm::normalize(Blend);
+
+				if(normals)
+					outNormals[i] = Blend.real * normals[i];
+				outPositions[i] = Blend * positions[i];
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linearBlendSkinning(
+		mat<4, 4, T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count)
+	{
+		assert(influences > 0);
+		detail::compute_skin_linear<T, Q, I, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			palette, indices, weights, influences, positions, normals, outPositions, outNormals, count);
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void dualQuaternionSkinning(
+		tdualquat<T, Q> const* palette, I const* indices, T const* weights, length_t influences,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals, std::size_t count)
+	{
+		assert(influences > 0);
+		detail::compute_skin_dualquat<T, Q, I, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			palette, indices, weights, influences, positions, normals, outPositions, outNormals, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "skinning_simd.inl"
+#endif
@@ -0,0 +1,433 @@
+/// @ref gtx_skinning
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Loads 4 vec3 as x, y and z lanes
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_load(vec<3, float, Q> const* p, glm_vec4 v[3])
+	{
+		float const* f = &p[0].x;
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			glm_vec4 const in[3] = {_mm_loadu_ps(f), _mm_loadu_ps(f + 4), _mm_loadu_ps(f + 8)};
+			glm_vec4_deinterleave3(in, v);
+		}
+		else
+		{
+			glm_vec4 const in[4] = {_mm_loadu_ps(f), _mm_loadu_ps(f + 4), _mm_loadu_ps(f + 8), _mm_loadu_ps(f + 12)};
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+			v[0] = out[0];
+			v[1] = out[1];
+			v[2] = out[2];
+		}
+	}
+
+	// Stores x, y and z lanes as 4 vec3
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_store(vec<3, float, Q>* p, glm_vec4 const v[3])
+	{
+		float* f = &p[0].x;
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			glm_vec4 out[3];
+			glm_vec4_interleave3(v, out);
+			_mm_storeu_ps(f, out[0]);
+			_mm_storeu_ps(f + 4, out[1]);
+			_mm_storeu_ps(f + 8, out[2]);
+		}
+		else
+		{
+			glm_vec4 const in[4] = {v[0], v[1], v[2], _mm_setzero_ps()};
+			glm_vec4 out[4];
+			glm_mat4_transpose(in, out);
+			_mm_storeu_ps(f, out[0]);
+			_mm_storeu_ps(f + 4, out[1]);
+			_mm_storeu_ps(f + 8, out[2]);
+			_mm_storeu_ps(f + 12, out[3]);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_normalize(glm_vec4 v[3])
+	{
+		glm_vec4 const Dot = glm_vec4_fma(v[2], v[2], glm_vec4_fma(v[1], v[1], glm_vec4_mul(v[0], v[0])));
+		glm_vec4 const Inv = glm_vec4_div(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot));
+		v[0] = glm_vec4_mul(v[0], Inv);
+		v[1] = glm_vec4_mul(v[1], Inv);
+		v[2] = glm_vec4_mul(v[2], Inv);
+	}
+
+	// Loads the dual quaternions b[0 - 3] as x, y, z and w lanes of their real and dual parts
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_gather(tdualquat<float, Q> const* const b[4], glm_vec4 r[4], glm_vec4 d[4])
+	{
+		glm_vec4 const InR[4] = {_mm_loadu_ps(&b[0]->real[0]), _mm_loadu_ps(&b[1]->real[0]), _mm_loadu_ps(&b[2]->real[0]), _mm_loadu_ps(&b[3]->real[0])};
+		glm_vec4 const InD[4] = {_mm_loadu_ps(&b[0]->dual[0]), _mm_loadu_ps(&b[1]->dual[0]), _mm_loadu_ps(&b[2]->dual[0]), _mm_loadu_ps(&b[3]->dual[0])};
+
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			glm_vec4 R[4], D[4];
+			glm_mat4_transpose(InR, R);
+			glm_mat4_transpose(InD, D);
+			r[0] = R[1]; r[1] = R[2]; r[2] = R[3]; r[3] = R[0];
+			d[0] = D[1]; d[1] = D[2]; d[2] = D[3]; d[3] = D[0];
+#		else
+			glm_mat4_transpose(InR, r);
+			glm_mat4_transpose(InD, d);
+#		endif
+	}
+
+	// Normalized sum of the weighted bones of 4 vertices, with the bones in the opposite hemisphere of the first one negated
+	template<qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void skin_blend(tdualquat<float, Q> const* palette, I const* indices, float const* weights, std::size_t influences, glm_vec4 r[4], glm_vec4 d[4])
+	{
+		std::size_t const n = influences;
+
+		tdualquat<float, Q> const* const First[4] = {
+			palette + indices[0], palette + indices[n], palette + indices[n * 2], palette + indices[n * 3]};
+		glm_vec4 R0[4], D0[4];
+		skin_gather(First, R0, D0);
+
+		glm_vec4 const W0 = _mm_setr_ps(weights[0], weights[n], weights[n * 2], weights[n * 3]);
+		for(int c = 0; c < 4; ++c)
+		{
+			r[c] = glm_vec4_mul(R0[c], W0);
+			d[c] = glm_vec4_mul(D0[c], W0);
+		}
+
+		for(std::size_t k = 1; k < n; ++k)
+		{
+			tdualquat<float, Q> const* const Bone[4] = {
+				palette + indices[k], palette + indices[n + k], palette + indices[n * 2 + k], palette + indices[n * 3 + k]};
+			glm_vec4 R[4], D[4];
+			skin_gather(Bone, R, D);
+
+			glm_vec4 const Dot = glm_vec4_fma(R0[3], R[3], glm_vec4_fma(R0[2], R[2], glm_vec4_fma(R0[1], R[1], glm_vec4_mul(R0[0], R[0]))));
+			glm_vec4 const Sgn = _mm_and_ps(_mm_cmplt_ps(Dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+			glm_vec4 const W = _mm_xor_ps(_mm_setr_ps(weights[k], weights[n + k], weights[n * 2 + k], weights[n * 3 + k]), Sgn);
+			for(int c = 0; c < 4; ++c)
+			{
+				r[c] = glm_vec4_fma(R[c], W, r[c]);
+				d[c] = glm_vec4_fma(D[c], W, d[c]);
+			}
+		}
+
+		glm_vec4 const Len2 = glm_vec4_fma(r[3], r[3], glm_vec4_fma(r[2], r[2], glm_vec4_fma(r[1], r[1], glm_vec4_mul(r[0], r[0]))));
+		glm_vec4 const Inv = glm_vec4_div(_mm_set1_ps(1.0f), _mm_sqrt_ps(Len2));
+		for(int c = 0; c < 4; ++c)
+		{
+			r[c] = glm_vec4_mul(r[c], Inv);
+			d[c] = glm_vec4_mul(d[c], Inv);
+		}
+	}
+
+	// v = v + 2 * cross(r, cross(r, v) + r.w * v), the rotation of v by the unit quaternion r
+	GLM_FUNC_QUALIFIER void skin_rotate(glm_vec4 const r[4], glm_vec4 v[3])
+	{
+		glm_vec4 const Cx = glm_vec4_fma(r[3], v[0], glm_vec4_sub(glm_vec4_mul(r[1], v[2]), glm_vec4_mul(r[2], v[1])));
+		glm_vec4 const Cy = glm_vec4_fma(r[3], v[1], glm_vec4_sub(glm_vec4_mul(r[2], v[0]), glm_vec4_mul(r[0], v[2])));
+		glm_vec4 const Cz = glm_vec4_fma(r[3], v[2], glm_vec4_sub(glm_vec4_mul(r[0], v[1]), glm_vec4_mul(r[1], v[0])));
+
+		glm_vec4 const two = _mm_set1_ps(2.0f);
+		v[0] = glm_vec4_fma(two, glm_vec4_sub(glm_vec4_mul(r[1], Cz), glm_vec4_mul(r[2], Cy)), v[0]);
+		v[1] = glm_vec4_fma(two, glm_vec4_sub(glm_vec4_mul(r[2], Cx), glm_vec4_mul(r[0], Cz)), v[1]);
+		v[2] = glm_vec4_fma(two, glm_vec4_sub(glm_vec4_mul(r[0], Cy), glm_vec4_mul(r[1], Cx)), v[2]);
+	}
+
+	// v = v + 2 * (cross(r, cross(r, v) + r.w * v + d) + r.w * d - d.w * r), as operator*(tdualquat, vec3)
+	GLM_FUNC_QUALIFIER void skin_transform(glm_vec4 const r[4], glm_vec4 const d[4], glm_vec4 v[3])
+	{
+		glm_vec4 const Cx = glm_vec4_add(glm_vec4_fma(r[3], v[0], glm_vec4_sub(glm_vec4_mul(r[1], v[2]), glm_vec4_mul(r[2], v[1]))), d[0]);
+		glm_vec4 const Cy = glm_vec4_add(glm_vec4_fma(r[3], v[1], glm_vec4_sub(glm_vec4_mul(r[2], v[0]), glm_vec4_mul(r[0], v[2]))), d[1]);
+		glm_vec4 const Cz = glm_vec4_add(glm_vec4_fma(r[3], v[2], glm_vec4_sub(glm_vec4_mul(r[0], v[1]), glm_vec4_mul(r[1], v[0]))), d[2]);
+
+		glm_vec4 const Ex = glm_vec4_sub(glm_vec4_fma(r[3], d[0], glm_vec4_sub(glm_vec4_mul(r[1], Cz), glm_vec4_mul(r[2], Cy))), glm_vec4_mul(d[3], r[0]));
+		glm_vec4 const Ey = glm_vec4_sub(glm_vec4_fma(r[3], d[1], glm_vec4_sub(glm_vec4_mul(r[2], Cx), glm_vec4_mul(r[0], Cz))), glm_vec4_mul(d[3], r[1]));
+		glm_vec4 const Ez = glm_vec4_sub(glm_vec4_fma(r[3], d[2], glm_vec4_sub(glm_vec4_mul(r[0], Cy), glm_vec4_mul(r[1], Cx))), glm_vec4_mul(d[3], r[2]));
+
+		glm_vec4 const two = _mm_set1_ps(2.0f);
+		v[0] = glm_vec4_fma(two, Ex, v[0]);
+		v[1] = glm_vec4_fma(two, Ey, v[1]);
+		v[2] = glm_vec4_fma(two, Ez, v[2]);
+	}
+
+	// Blends the affine bone matrices of 1 vertex, returns the transformed position and normal in (x, y, z, w) lanes
+	template<qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void skin_linear(mat<4, 4, float, Q> const* palette, I const* indices, float const* weights, std::size_t influences, vec<3, float, Q> const& p, vec<3, float, Q> const* n, glm_vec4& outP, glm_vec4& outN)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			// Columns 0 and 1 in A, 2 and 3 in B
+			glm_vec8 const W0 = _mm256_set1_ps(weights[0]);
+			glm_vec8 A = glm_vec8_mul(_mm256_loadu_ps(&palette[indices[0]][0][0]), W0);
+			glm_vec8 B = glm_vec8_mul(_mm256_loadu_ps(&palette[indices[0]][2][0]), W0);
+			for(std::size_t k = 1; k < influences; ++k)
+			{
+				glm_vec8 const W = _mm256_set1_ps(weights[k]);
+				A = glm_vec8_fma(_mm256_loadu_ps(&palette[indices[k]][0][0]), W, A);
+				B = glm_vec8_fma(_mm256_loadu_ps(&palette[indices[k]][2][0]), W, B);
+			}
+
+			glm_vec8 const P = glm_vec8_fma(A,
+				_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(p.x)), _mm_set1_ps(p.y), 1), glm_vec8_mul(B,
+				_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(p.z)), _mm_set1_ps(1.0f), 1)));
+			outP = glm_vec4_add(_mm256_castps256_ps128(P), _mm256_extractf128_ps(P, 1));
+			if(n)
+			{
+				glm_vec8 const N = glm_vec8_fma(A,
+					_mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(n->x)), _mm_set1_ps(n->y), 1),
+					_mm256_insertf128_ps(_mm256_castps128_ps256(glm_vec4_mul(_mm256_castps256_ps128(B), _mm_set1_ps(n->z))), _mm_setzero_ps(), 1));
+				outN = glm_vec4_add(_mm256_castps256_ps128(N), _mm256_extractf128_ps(N, 1));
+			}
+#		else
+			glm_vec4 C[4];
+			glm_vec4 const W0 = _mm_set1_ps(weights[0]);
+			for(length_t c = 0; c < 4; ++c)
+				C[c] = glm_vec4_mul(_mm_loadu_ps(&palette[indices[0]][c][0]), W0);
+			for(std::size_t k = 1; k < influences; ++k)
+			{
+				glm_vec4 const W = _mm_set1_ps(weights[k]);
+				for(length_t c = 0; c < 4; ++c)
+					C[c] = glm_vec4_fma(_mm_loadu_ps(&palette[indices[k]][c][0]), W, C[c]);
+			}
+
+			outP = glm_vec4_fma(C[0], _mm_set1_ps(p.x), glm_vec4_fma(C[1], _mm_set1_ps(p.y), glm_vec4_fma(C[2], _mm_set1_ps(p.z), C[3])));
+			if(n)
+				outN = glm_vec4_fma(C[0], _mm_set1_ps(n->x), glm_vec4_fma(C[1], _mm_set1_ps(n->y), glm_vec4_mul(C[2], _mm_set1_ps(n->z))));
+#		endif
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER glm_vec8 skin_combine(glm_vec4 lo, glm_vec4 hi)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+	}
+
+	// Loads 8 vec3 as x, y and z lanes
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_load(vec<3, float, Q> const* p, glm_vec8 v[3])
+	{
+		glm_vec4 lo[3], hi[3];
+		skin_load(p, lo);
+		skin_load(p + 4, hi);
+		v[0] = skin_combine(lo[0], hi[0]);
+		v[1] = skin_combine(lo[1], hi[1]);
+		v[2] = skin_combine(lo[2], hi[2]);
+	}
+
+	// Stores x, y and z lanes as 8 vec3
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_store(vec<3, float, Q>* p, glm_vec8 const v[3])
+	{
+		glm_vec4 const lo[3] = {_mm256_castps256_ps128(v[0]), _mm256_castps256_ps128(v[1]), _mm256_castps256_ps128(v[2])};
+		glm_vec4 const hi[3] = {_mm256_extractf128_ps(v[0], 1), _mm256_extractf128_ps(v[1], 1), _mm256_extractf128_ps(v[2], 1)};
+		skin_store(p, lo);
+		skin_store(p + 4, hi);
+	}
+
+	// Loads the dual quaternions b[0 - 7] as x, y, z and w lanes of their real and dual parts
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void skin_gather(tdualquat<float, Q> const* const b[8], glm_vec8 r[4], glm_vec8 d[4])
+	{
+		// The real and dual parts are contiguous, each dual quaternion is a row of 8 floats
+		glm_vec8 In[8];
+		for(int i = 0; i < 8; ++i)
+			In[i] = _mm256_loadu_ps(&b[i]->real[0]);
+
+		glm_vec8 Out[8];
+		glm_vec8_transpose8(In, Out);
+
+#		ifdef GLM_FORCE_QUAT_DATA_WXYZ
+			r[0] = Out[1]; r[1] = Out[2]; r[2] = Out[3]; r[3] = Out[0];
+			d[0] = Out[5]; d[1] = Out[6]; d[2] = Out[7]; d[3] = Out[4];
+#		else
+			r[0] = Out[0]; r[1] = Out[1]; r[2] = Out[2]; r[3] = Out[3];
+			d[0] = Out[4]; d[1] = Out[5]; d[2] = Out[6]; d[3] = Out[7];
+#		endif
+	}
+
+	// Normalized sum of the weighted bones of 8 vertices, with the bones in the opposite hemisphere of the first one negated
+	template<qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void skin_blend(tdualquat<float, Q> const* palette, I const* indices, float const* weights, std::size_t influences, glm_vec8 r[4], glm_vec8 d[4])
+	{
+		std::size_t const n = influences;
+
+		tdualquat<float, Q> const* First[8];
+		float W0[8];
+		for(std::size_t i = 0; i < 8; ++i)
+		{
+			First[i] = palette + indices[n * i];
+			W0[i] = weights[n * i];
+		}
+
+		glm_vec8 R0[4], D0[4];
+		skin_gather(First, R0, D0);
+
+		glm_vec8 const w0 = _mm256_loadu_ps(W0);
+		for(int c = 0; c < 4; ++c)
+		{
+			r[c] = glm_vec8_mul(R0[c], w0);
+			d[c] = glm_vec8_mul(D0[c], w0);
+		}
+
+		for(std::size_t k = 1; k < n; ++k)
+		{
+			tdualquat<float, Q> const* Bone[8];
+			float Wk[8];
+			for(std::size_t i = 0; i < 8; ++i)
+			{
+				Bone[i] = palette + indices[n * i + k];
+				Wk[i] = weights[n * i + k];
+			}
+
+			glm_vec8 R[4], D[4];
+			skin_gather(Bone, R, D);
+
+			glm_vec8 const Dot = glm_vec8_fma(R0[3], R[3], glm_vec8_fma(R0[2], R[2], glm_vec8_fma(R0[1], R[1], glm_vec8_mul(R0[0], R[0]))));
+			glm_vec8 const Sgn = _mm256_and_ps(_mm256_cmp_ps(Dot, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+			glm_vec8 const W = _mm256_xor_ps(_mm256_loadu_ps(Wk), Sgn);
+			for(int c = 0; c < 4; ++c)
+			{
+				r[c] = glm_vec8_fma(R[c], W, r[c]);
+				d[c] = glm_vec8_fma(D[c], W, d[c]);
+			}
+		}
+
+		glm_vec8 const Len2 = glm_vec8_fma(r[3], r[3], glm_vec8_fma(r[2], r[2], glm_vec8_fma(r[1], r[1], glm_vec8_mul(r[0], r[0]))));
+		glm_vec8 const Inv = glm_vec8_div(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Len2));
+		for(int c = 0; c < 4; ++c)
+		{
+			r[c] = glm_vec8_mul(r[c], Inv);
+			d[c] = glm_vec8_mul(d[c], Inv);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void skin_normalize(glm_vec8 v[3])
+	{
+		glm_vec8 const Dot = glm_vec8_fma(v[2], v[2], glm_vec8_fma(v[1], v[1], glm_vec8_mul(v[0], v[0])));
+		glm_vec8 const Inv = glm_vec8_div(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(Dot));
+		v[0] = glm_vec8_mul(v[0], Inv);
+		v[1] = glm_vec8_mul(v[1], Inv);
+		v[2] = glm_vec8_mul(v[2], Inv);
+	}
+
+	GLM_FUNC_QUALIFIER void skin_rotate(glm_vec8 const r[4], glm_vec8 v[3])
+	{
+		glm_vec8 const Cx = glm_vec8_fma(r[3], v[0], glm_vec8_sub(glm_vec8_mul(r[1], v[2]), glm_vec8_mul(r[2], v[1])));
+		glm_vec8 const Cy = glm_vec8_fma(r[3], v[1], glm_vec8_sub(glm_vec8_mul(r[2], v[0]), glm_vec8_mul(r[0], v[2])));
+		glm_vec8 const Cz = glm_vec8_fma(r[3], v[2], glm_vec8_sub(glm_vec8_mul(r[0], v[1]), glm_vec8_mul(r[1], v[0])));
+
+		glm_vec8 const two = _mm256_set1_ps(2.0f);
+		v[0] = glm_vec8_fma(two, glm_vec8_sub(glm_vec8_mul(r[1], Cz), glm_vec8_mul(r[2], Cy)), v[0]);
+		v[1] = glm_vec8_fma(two, glm_vec8_sub(glm_vec8_mul(r[2], Cx), glm_vec8_mul(r[0], Cz)), v[1]);
+		v[2] = glm_vec8_fma(two, glm_vec8_sub(glm_vec8_mul(r[0], Cy), glm_vec8_mul(r[1], Cx)), v[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void skin_transform(glm_vec8 const r[4], glm_vec8 const d[4], glm_vec8 v[3])
+	{
+		glm_vec8 const Cx = glm_vec8_add(glm_vec8_fma(r[3], v[0], glm_vec8_sub(glm_vec8_mul(r[1], v[2]), glm_vec8_mul(r[2], v[1]))), d[0]);
+		glm_vec8 const Cy = glm_vec8_add(glm_vec8_fma(r[3], v[1], glm_vec8_sub(glm_vec8_mul(r[2], v[0]), glm_vec8_mul(r[0], v[2]))), d[1]);
+		glm_vec8 const Cz = glm_vec8_add(glm_vec8_fma(r[3], v[2], glm_vec8_sub(glm_vec8_mul(r[0], v[1]), glm_vec8_mul(r[1], v[0]))), d[2]);
+
+		glm_vec8 const Ex = glm_vec8_sub(glm_vec8_fma(r[3], d[0], glm_vec8_sub(glm_vec8_mul(r[1], Cz), glm_vec8_mul(r[2], Cy))), glm_vec8_mul(d[3], r[0]));
+		glm_vec8 const Ey = glm_vec8_sub(glm_vec8_fma(r[3], d[1], glm_vec8_sub(glm_vec8_mul(r[2], Cx), glm_vec8_mul(r[0], Cz))), glm_vec8_mul(d[3], r[1]));
+		glm_vec8 const Ez = glm_vec8_sub(glm_vec8_fma(r[3], d[2], glm_vec8_sub(glm_vec8_mul(r[0], Cy), glm_vec8_mul(r[1], Cx))), glm_vec8_mul(d[3], r[2]));
+
+		glm_vec8 const two = _mm256_set1_ps(2.0f);
+		v[0] = glm_vec8_fma(two, Ex, v[0]);
+		v[1] = glm_vec8_fma(two, Ey, v[1]);
+		v[2] = glm_vec8_fma(two, Ez, v[2]);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<qualifier Q, typename I>
+	struct compute_skin_linear<float, Q, I, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			mat<4, 4, float, Q> const* palette, I const* indices, float const* weights, length_t influences,
+			vec<3, float, Q> const* positions, vec<3, float, Q> const* normals,
+			vec<3, float, Q>* outPositions, vec<3, float, Q>* outNormals, std::size_t count)
+		{
+			std::size_t const n = static_cast<std::size_t>(influences);
+
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				// Blends 1 vertex at a time then transposes the 4 results to lanes
+				glm_vec4 P[4], N[4];
+				for(std::size_t l = 0; l < 4; ++l)
+					skin_linear(palette, indices + (i + l) * n, weights + (i + l) * n, n, positions[i + l], normals ? normals + i + l : normals, P[l], N[l]);
+
+				glm_vec4 Lanes[4];
+				glm_mat4_transpose(P, Lanes);
+				skin_store(outPositions + i, Lanes);
+				if(normals)
+				{
+					glm_mat4_transpose(N, Lanes);
+					skin_normalize(Lanes);
+					skin_store(outNormals + i, Lanes);
+				}
+			}
+
+			compute_skin_linear<float, Q, I, false>::call(
+				palette, indices + i * n, weights + i * n, influences,
+				positions + i, normals ? normals + i : normals,
+				outPositions + i, outNormals ? outNormals + i : outNormals, count - i);
+		}
+	};
+
+	template<qualifier Q, typename I>
+	struct compute_skin_dualquat<float, Q, I, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(
+			tdualquat<float, Q> const* palette, I const* indices, float const* weights, length_t influences,
+			vec<3, float, Q> const* positions, vec<3, float, Q> const* normals,
+			vec<3, float, Q>* outPositions, vec<3, float, Q>* outNormals, std::size_t count)
+		{
+			std::size_t const n = static_cast<std::size_t>(influences);
+
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= count; i += 8)
+			{
+				glm_vec8 R[4], D[4], V[3];
+				skin_blend(palette, indices + i * n, weights + i * n, n, R, D);
+
+				if(normals)
+				{
+					skin_load(normals + i, V);
+					skin_rotate(R, V);
+					skin_store(outNormals + i, V);
+				}
+				skin_load(positions + i, V);
+				skin_transform(R, D, V);
+				skin_store(outPositions + i, V);
+			}
+#			endif
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 R[4], D[4], V[3];
+				skin_blend(palette, indices + i * n, weights + i * n, n, R, D);
+
+				if(normals)
+				{
+					skin_load(normals + i, V);
+					skin_rotate(R, V);
+					skin_store(outNormals + i, V);
+				}
+				skin_load(positions + i, V);
+				skin_transform(R, D, V);
+				skin_store(outPositions + i, V);
+			}
+
+			compute_skin_dualquat<float, Q, I, false>::call(
+				palette, indices + i * n, weights + i * n, influences,
+				positions + i, normals ? normals + i : normals,
+				outPositions + i, outNormals ? outNormals + i : outNormals, count - i);
+		}
+	};
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
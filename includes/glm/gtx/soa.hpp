@@ -0,0 +1,427 @@
+/// @ref gtx_soa
+/// @file glm/gtx/soa.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_soa GLM_GTX_soa
+/// @ingroup gtx
+///
+/// Include <glm/gtx/soa.hpp> to use the features of this extension.
+///
+/// Structure of arrays vector types: soa<L, T, W> holds W vectors of L components
+/// as one lane of W values per component, so that each operation processes W vectors at once.
+/// With SIMD enabled, the float lanes of 4 and 8 values are processed with SSE, AVX or NEON instructions.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_soa is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_soa extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_soa
+	/// @{
+
+	/// W vectors of L components of type T, stored by component.
+	/// soa<1, T, W> is a lane of W scalars and the component type of the other sizes.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	struct soa;
+
+	template<typename T, length_t W>
+	struct soa<1, T, W>
+	{
+		typedef T value_type;
+		typedef soa<1, T, W> type;
+		typedef soa<1, T, W> lane_type;
+
+		T data[W];
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 1;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t width(){return W;}
+
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL soa() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL explicit soa(T scalar);
+
+		GLM_FUNC_DECL T & operator[](length_t i);
+		GLM_FUNC_DECL T const& operator[](length_t i) const;
+	};
+
+	template<typename T, length_t W>
+	struct soa<2, T, W>
+	{
+		typedef T value_type;
+		typedef soa<2, T, W> type;
+		typedef soa<1, T, W> lane_type;
+
+		lane_type x, y;
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 2;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t width(){return W;}
+
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL soa() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL explicit soa(lane_type const& s);
+		GLM_FUNC_DECL soa(lane_type const& x, lane_type const& y);
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa(vec<2, T, Q> const& v);
+
+		/// Returns the lane of the component c
+		GLM_FUNC_DECL lane_type & operator[](length_t c);
+		GLM_FUNC_DECL lane_type const& operator[](length_t c) const;
+
+		/// Returns the vector i of the W vectors
+		GLM_FUNC_DECL vec<2, T, defaultp> get(length_t i) const;
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void set(length_t i, vec<2, T, Q> const& v);
+	};
+
+	template<typename T, length_t W>
+	struct soa<3, T, W>
+	{
+		typedef T value_type;
+		typedef soa<3, T, W> type;
+		typedef soa<1, T, W> lane_type;
+
+		lane_type x, y, z;
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 3;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t width(){return W;}
+
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL soa() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL explicit soa(lane_type const& s);
+		GLM_FUNC_DECL soa(lane_type const& x, lane_type const& y, lane_type const& z);
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa(vec<3, T, Q> const& v);
+
+		/// Returns the lane of the component c
+		GLM_FUNC_DECL lane_type & operator[](length_t c);
+		GLM_FUNC_DECL lane_type const& operator[](length_t c) const;
+
+		/// Returns the vector i of the W vectors
+		GLM_FUNC_DECL vec<3, T, defaultp> get(length_t i) const;
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void set(length_t i, vec<3, T, Q> const& v);
+	};
+
+	template<typename T, length_t W>
+	struct soa<4, T, W>
+	{
+		typedef T value_type;
+		typedef soa<4, T, W> type;
+		typedef soa<1, T, W> lane_type;
+
+		lane_type x, y, z, w;
+
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t length(){return 4;}
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_t width(){return W;}
+
+		GLM_DEFAULTED_DEFAULT_CTOR_DECL soa() GLM_DEFAULT_CTOR;
+		GLM_FUNC_DECL explicit soa(lane_type const& s);
+		GLM_FUNC_DECL soa(lane_type const& x, lane_type const& y, lane_type const& z, lane_type const& w);
+		template<qualifier Q>
+		GLM_FUNC_DECL explicit soa(vec<4, T, Q> const& v);
+
+		/// Returns the lane of the component c
+		GLM_FUNC_DECL lane_type & operator[](length_t c);
+		GLM_FUNC_DECL lane_type const& operator[](length_t c) const;
+
+		/// Returns the vector i of the W vectors
+		GLM_FUNC_DECL vec<4, T, defaultp> get(length_t i) const;
+		template<qualifier Q>
+		GLM_FUNC_DISCARD_DECL void set(length_t i, vec<4, T, Q> const& v);
+	};
+
+	typedef soa<1, float, 4>	float_soa4;
+	typedef soa<1, float, 8>	float_soa8;
+	typedef soa<2, float, 4>	vec2_soa4;
+	typedef soa<2, float, 8>	vec2_soa8;
+	typedef soa<3, float, 4>	vec3_soa4;
+	typedef soa<3, float, 8>	vec3_soa8;
+	typedef soa<4, float, 4>	vec4_soa4;
+	typedef soa<4, float, 8>	vec4_soa8;
+
+	/// The widest lanes processed by a single instruction: 8 floats with AVX, 4 otherwise
+#	if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_AVX_BIT)
+		typedef float_soa8			float_soa;
+		typedef vec2_soa8			vec2_soa;
+		typedef vec3_soa8			vec3_soa;
+		typedef vec4_soa8			vec4_soa;
+#	else
+		typedef float_soa4			float_soa;
+		typedef vec2_soa4			vec2_soa;
+		typedef vec3_soa4			vec3_soa;
+		typedef vec4_soa4			vec4_soa;
+#	endif
+
+	// -- Lane operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator-(soa<1, T, W> const& a);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator+(soa<1, T, W> const& a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator+(soa<1, T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator+(T a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator-(soa<1, T, W> const& a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator-(soa<1, T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator-(T a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator*(soa<1, T, W> const& a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator*(soa<1, T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator*(T a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator/(soa<1, T, W> const& a, soa<1, T, W> const& b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator/(soa<1, T, W> const& a, T b);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> operator/(T a, soa<1, T, W> const& b);
+
+	// -- Vector operators --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator-(soa<L, T, W> const& a);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator+(soa<L, T, W> const& a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator-(soa<L, T, W> const& a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator*(soa<L, T, W> const& a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator*(soa<L, T, W> const& a, soa<1, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator*(soa<1, T, W> const& a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator*(soa<L, T, W> const& a, T b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator*(T a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator/(soa<L, T, W> const& a, soa<L, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator/(soa<L, T, W> const& a, soa<1, T, W> const& b);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> operator/(soa<L, T, W> const& a, T b);
+
+	// -- Common functions --
+
+	/// Per lane abs.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> abs(soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> abs(soa<L, T, W> const& x);
+
+	/// Per lane floor.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> floor(soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> floor(soa<L, T, W> const& x);
+
+	/// Per lane ceil.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> ceil(soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> ceil(soa<L, T, W> const& x);
+
+	/// Per lane fract.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> fract(soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> fract(soa<L, T, W> const& x);
+
+	/// Per lane min.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> min(soa<1, T, W> const& x, soa<1, T, W> const& y);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> min(soa<L, T, W> const& x, soa<L, T, W> const& y);
+
+	/// Per lane max.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> max(soa<1, T, W> const& x, soa<1, T, W> const& y);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> max(soa<L, T, W> const& x, soa<L, T, W> const& y);
+
+	/// Per lane clamp.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> clamp(soa<1, T, W> const& x, soa<1, T, W> const& minVal, soa<1, T, W> const& maxVal);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> clamp(soa<1, T, W> const& x, T minVal, T maxVal);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> clamp(soa<L, T, W> const& x, soa<L, T, W> const& minVal, soa<L, T, W> const& maxVal);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> clamp(soa<L, T, W> const& x, T minVal, T maxVal);
+
+	/// Per lane linear blend x * (1 - a) + y * a.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> mix(soa<1, T, W> const& x, soa<1, T, W> const& y, soa<1, T, W> const& a);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> mix(soa<1, T, W> const& x, soa<1, T, W> const& y, T a);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, soa<L, T, W> const& a);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, soa<1, T, W> const& a);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, T a);
+
+	/// Per lane step, 0 if x < edge, 1 otherwise.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> step(soa<1, T, W> const& edge, soa<1, T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> step(T edge, soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> step(soa<L, T, W> const& edge, soa<L, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> step(T edge, soa<L, T, W> const& x);
+
+	/// Per lane smoothstep.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> smoothstep(soa<1, T, W> const& edge0, soa<1, T, W> const& edge1, soa<1, T, W> const& x);
+
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> smoothstep(T edge0, T edge1, soa<1, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> smoothstep(soa<L, T, W> const& edge0, soa<L, T, W> const& edge1, soa<L, T, W> const& x);
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> smoothstep(T edge0, T edge1, soa<L, T, W> const& x);
+
+	// -- Exponential functions --
+
+	/// Per lane square root.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> sqrt(soa<1, T, W> const& x);
+
+	/// Per lane reciprocal of the square root.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> inversesqrt(soa<1, T, W> const& x);
+
+	// -- Geometric functions --
+
+	/// Returns the W dot products of x and y.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> dot(soa<L, T, W> const& x, soa<L, T, W> const& y);
+
+	/// Returns the W lengths of x.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> length(soa<L, T, W> const& x);
+
+	/// Returns the W distances between p0 and p1.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<1, T, W> distance(soa<L, T, W> const& p0, soa<L, T, W> const& p1);
+
+	/// Returns the W cross products of x and y.
+	/// @see gtx_soa
+	template<typename T, length_t W>
+	GLM_FUNC_DECL soa<3, T, W> cross(soa<3, T, W> const& x, soa<3, T, W> const& y);
+
+	/// Returns the W vectors of x normalized.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> normalize(soa<L, T, W> const& x);
+
+	/// Per vector, returns N if dot(Nref, I) < 0, -N otherwise.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> faceforward(soa<L, T, W> const& N, soa<L, T, W> const& I, soa<L, T, W> const& Nref);
+
+	/// Per vector, returns the reflection direction I - 2 * dot(N, I) * N.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> reflect(soa<L, T, W> const& I, soa<L, T, W> const& N);
+
+	/// Per vector, returns the refraction vector for the ratio of indices of refraction eta, 0 on total internal reflection.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_DECL soa<L, T, W> refract(soa<L, T, W> const& I, soa<L, T, W> const& N, T eta);
+
+	// -- Array of structures conversions --
+
+	/// Loads the W vectors v[0], ..., v[W - 1] into a structure of arrays.
+	/// @see gtx_soa
+	template<length_t W, length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL soa<L, T, W> loadSoa(vec<L, T, Q> const* v);
+
+	/// Stores the W vectors of s to v[0], ..., v[W - 1].
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void storeSoa(soa<L, T, W> const& s, vec<L, T, Q>* v);
+
+	/// Transposes count vectors to (count + W - 1) / W structures of arrays, the lanes past count are set to 0.
+	/// @see gtx_soa
+	template<length_t L, typename T, qualifier Q, length_t W>
+	GLM_FUNC_DISCARD_DECL void aosToSoa(vec<L, T, Q> const* v, soa<L, T, W>* s, std::size_t count);
+
+	/// Transposes the first count vectors held by the structures of arrays s back to v.
+	/// @see gtx_soa
+	template<length_t L, typename T, length_t W, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void soaToAos(soa<L, T, W> const* s, vec<L, T, Q>* v, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "soa.inl"
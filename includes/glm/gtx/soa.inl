@@ -0,0 +1,821 @@
+/// @ref gtx_soa
+
+namespace glm{
+namespace detail
+{
+	template<typename T, length_t W, bool UseSimd>
+	struct compute_soa_lane
+	{
+		GLM_FUNC_QUALIFIER static void add(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = a[i] + b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void sub(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = a[i] - b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = a[i] * b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void div(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = a[i] / b[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void min(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = b[i] < a[i] ? b[i] : a[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void max(T* r, T const* a, T const* b)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = a[i] < b[i] ? b[i] : a[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void step(T* r, T const* edge, T const* x)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = x[i] < edge[i] ? static_cast<T>(0) : static_cast<T>(1);
+		}
+
+		GLM_FUNC_QUALIFIER static void abs(T* r, T const* x)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = glm::abs(x[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void floor(T* r, T const* x)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = std::floor(x[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void ceil(T* r, T const* x)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = std::ceil(x[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void sqrt(T* r, T const* x)
+		{
+			for(length_t i = 0; i < W; ++i)
+				r[i] = std::sqrt(x[i]);
+		}
+	};
+
+	// Transposes W vectors spaced by S values, S is L for packed types and 4 for aligned vec3
+	template<length_t L, typename T, length_t W, length_t S, bool UseSimd>
+	struct compute_soa_transpose
+	{
+		GLM_FUNC_QUALIFIER static void load(soa<L, T, W>& s, T const* v)
+		{
+			for(length_t i = 0; i < W; ++i)
+			for(length_t c = 0; c < L; ++c)
+				s[c][i] = v[i * S + c];
+		}
+
+		GLM_FUNC_QUALIFIER static void store(soa<L, T, W> const& s, T* v)
+		{
+			for(length_t i = 0; i < W; ++i)
+			for(length_t c = 0; c < L; ++c)
+				v[i * S + c] = s[c][i];
+		}
+	};
+}//namespace detail
+
+	// -- Lane constructors and accesses --
+
+#	if GLM_CONFIG_DEFAULTED_DEFAULT_CTOR == GLM_DISABLE
+		template<typename T, length_t W>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER soa<1, T, W>::soa()
+		{
+#			if GLM_CONFIG_CTOR_INIT != GLM_CTOR_INIT_DISABLE
+				for(length_t i = 0; i < W; ++i)
+					this->data[i] = static_cast<T>(0);
+#			endif
+		}
+
+		template<typename T, length_t W>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER soa<2, T, W>::soa()
+		{}
+
+		template<typename T, length_t W>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER soa<3, T, W>::soa()
+		{}
+
+		template<typename T, length_t W>
+		GLM_DEFAULTED_DEFAULT_CTOR_QUALIFIER soa<4, T, W>::soa()
+		{}
+#	endif
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W>::soa(T scalar)
+	{
+		for(length_t i = 0; i < W; ++i)
+			this->data[i] = scalar;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER T & soa<1, T, W>::operator[](length_t i)
+	{
+		GLM_ASSERT_LENGTH(i, W);
+		return this->data[i];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER T const& soa<1, T, W>::operator[](length_t i) const
+	{
+		GLM_ASSERT_LENGTH(i, W);
+		return this->data[i];
+	}
+
+	// -- Vector constructors and accesses --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<2, T, W>::soa(lane_type const& s)
+		: x(s), y(s)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<2, T, W>::soa(lane_type const& _x, lane_type const& _y)
+		: x(_x), y(_y)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa<2, T, W>::soa(vec<2, T, Q> const& v)
+		: x(v.x), y(v.y)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<2, T, W>::lane_type & soa<2, T, W>::operator[](length_t c)
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<2, T, W>::lane_type const& soa<2, T, W>::operator[](length_t c) const
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> soa<2, T, W>::get(length_t i) const
+	{
+		return vec<2, T, defaultp>(x[i], y[i]);
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa<2, T, W>::set(length_t i, vec<2, T, Q> const& v)
+	{
+		x[i] = v.x;
+		y[i] = v.y;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<3, T, W>::soa(lane_type const& s)
+		: x(s), y(s), z(s)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<3, T, W>::soa(lane_type const& _x, lane_type const& _y, lane_type const& _z)
+		: x(_x), y(_y), z(_z)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa<3, T, W>::soa(vec<3, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<3, T, W>::lane_type & soa<3, T, W>::operator[](length_t c)
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<3, T, W>::lane_type const& soa<3, T, W>::operator[](length_t c) const
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> soa<3, T, W>::get(length_t i) const
+	{
+		return vec<3, T, defaultp>(x[i], y[i], z[i]);
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa<3, T, W>::set(length_t i, vec<3, T, Q> const& v)
+	{
+		x[i] = v.x;
+		y[i] = v.y;
+		z[i] = v.z;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<4, T, W>::soa(lane_type const& s)
+		: x(s), y(s), z(s), w(s)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<4, T, W>::soa(lane_type const& _x, lane_type const& _y, lane_type const& _z, lane_type const& _w)
+		: x(_x), y(_y), z(_z), w(_w)
+	{}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER soa<4, T, W>::soa(vec<4, T, Q> const& v)
+		: x(v.x), y(v.y), z(v.z), w(v.w)
+	{}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<4, T, W>::lane_type & soa<4, T, W>::operator[](length_t c)
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER typename soa<4, T, W>::lane_type const& soa<4, T, W>::operator[](length_t c) const
+	{
+		GLM_ASSERT_LENGTH(c, this->length());
+		return (&x)[c];
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER vec<4, T, defaultp> soa<4, T, W>::get(length_t i) const
+	{
+		return vec<4, T, defaultp>(x[i], y[i], z[i], w[i]);
+	}
+
+	template<typename T, length_t W>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void soa<4, T, W>::set(length_t i, vec<4, T, Q> const& v)
+	{
+		x[i] = v.x;
+		y[i] = v.y;
+		z[i] = v.z;
+		w[i] = v.w;
+	}
+
+	// -- Lane operators --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator-(soa<1, T, W> const& a)
+	{
+		return a * static_cast<T>(-1);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator+(soa<1, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::add(Result.data, a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator+(soa<1, T, W> const& a, T b)
+	{
+		return a + soa<1, T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator+(T a, soa<1, T, W> const& b)
+	{
+		return soa<1, T, W>(a) + b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator-(soa<1, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::sub(Result.data, a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator-(soa<1, T, W> const& a, T b)
+	{
+		return a - soa<1, T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator-(T a, soa<1, T, W> const& b)
+	{
+		return soa<1, T, W>(a) - b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator*(soa<1, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(Result.data, a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator*(soa<1, T, W> const& a, T b)
+	{
+		return a * soa<1, T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator*(T a, soa<1, T, W> const& b)
+	{
+		return soa<1, T, W>(a) * b;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator/(soa<1, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::div(Result.data, a.data, b.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator/(soa<1, T, W> const& a, T b)
+	{
+		return a / soa<1, T, W>(b);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> operator/(T a, soa<1, T, W> const& b)
+	{
+		return soa<1, T, W>(a) / b;
+	}
+
+	// -- Vector operators --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator-(soa<L, T, W> const& a)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = -a[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator+(soa<L, T, W> const& a, soa<L, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] + b[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator-(soa<L, T, W> const& a, soa<L, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] - b[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator*(soa<L, T, W> const& a, soa<L, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] * b[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator*(soa<L, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] * b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator*(soa<1, T, W> const& a, soa<L, T, W> const& b)
+	{
+		return b * a;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator*(soa<L, T, W> const& a, T b)
+	{
+		return a * soa<1, T, W>(b);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator*(T a, soa<L, T, W> const& b)
+	{
+		return b * soa<1, T, W>(a);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator/(soa<L, T, W> const& a, soa<L, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] / b[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator/(soa<L, T, W> const& a, soa<1, T, W> const& b)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = a[c] / b;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> operator/(soa<L, T, W> const& a, T b)
+	{
+		return a / soa<1, T, W>(b);
+	}
+
+	// -- Common functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> abs(soa<1, T, W> const& x)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::abs(Result.data, x.data);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> abs(soa<L, T, W> const& x)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = abs(x[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> floor(soa<1, T, W> const& x)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::floor(Result.data, x.data);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> floor(soa<L, T, W> const& x)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = floor(x[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> ceil(soa<1, T, W> const& x)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::ceil(Result.data, x.data);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> ceil(soa<L, T, W> const& x)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = ceil(x[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> fract(soa<1, T, W> const& x)
+	{
+		return x - floor(x);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> fract(soa<L, T, W> const& x)
+	{
+		return x - floor(x);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> min(soa<1, T, W> const& x, soa<1, T, W> const& y)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::min(Result.data, x.data, y.data);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> min(soa<L, T, W> const& x, soa<L, T, W> const& y)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = min(x[c], y[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> max(soa<1, T, W> const& x, soa<1, T, W> const& y)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::max(Result.data, x.data, y.data);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> max(soa<L, T, W> const& x, soa<L, T, W> const& y)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = max(x[c], y[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> clamp(soa<1, T, W> const& x, soa<1, T, W> const& minVal, soa<1, T, W> const& maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> clamp(soa<1, T, W> const& x, T minVal, T maxVal)
+	{
+		return min(max(x, soa<1, T, W>(minVal)), soa<1, T, W>(maxVal));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> clamp(soa<L, T, W> const& x, soa<L, T, W> const& minVal, soa<L, T, W> const& maxVal)
+	{
+		return min(max(x, minVal), maxVal);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> clamp(soa<L, T, W> const& x, T minVal, T maxVal)
+	{
+		soa<1, T, W> const Min(minVal);
+		soa<1, T, W> const Max(maxVal);
+
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = min(max(x[c], Min), Max);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> mix(soa<1, T, W> const& x, soa<1, T, W> const& y, soa<1, T, W> const& a)
+	{
+		return x * (static_cast<T>(1) - a) + y * a;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> mix(soa<1, T, W> const& x, soa<1, T, W> const& y, T a)
+	{
+		return x * (static_cast<T>(1) - a) + y * a;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, soa<L, T, W> const& a)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = mix(x[c], y[c], a[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, soa<1, T, W> const& a)
+	{
+		soa<1, T, W> const b(static_cast<T>(1) - a);
+
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = x[c] * b + y[c] * a;
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> mix(soa<L, T, W> const& x, soa<L, T, W> const& y, T a)
+	{
+		return mix(x, y, soa<1, T, W>(a));
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> step(soa<1, T, W> const& edge, soa<1, T, W> const& x)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::step(Result.data, edge.data, x.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> step(T edge, soa<1, T, W> const& x)
+	{
+		return step(soa<1, T, W>(edge), x);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> step(soa<L, T, W> const& edge, soa<L, T, W> const& x)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = step(edge[c], x[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> step(T edge, soa<L, T, W> const& x)
+	{
+		soa<1, T, W> const Edge(edge);
+
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = step(Edge, x[c]);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> smoothstep(soa<1, T, W> const& edge0, soa<1, T, W> const& edge1, soa<1, T, W> const& x)
+	{
+		soa<1, T, W> const tmp(clamp((x - edge0) / (edge1 - edge0), static_cast<T>(0), static_cast<T>(1)));
+		return tmp * tmp * (static_cast<T>(3) - static_cast<T>(2) * tmp);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> smoothstep(T edge0, T edge1, soa<1, T, W> const& x)
+	{
+		return smoothstep(soa<1, T, W>(edge0), soa<1, T, W>(edge1), x);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> smoothstep(soa<L, T, W> const& edge0, soa<L, T, W> const& edge1, soa<L, T, W> const& x)
+	{
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = smoothstep(edge0[c], edge1[c], x[c]);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> smoothstep(T edge0, T edge1, soa<L, T, W> const& x)
+	{
+		soa<1, T, W> const Edge0(edge0);
+		soa<1, T, W> const Edge1(edge1);
+
+		soa<L, T, W> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = smoothstep(Edge0, Edge1, x[c]);
+		return Result;
+	}
+
+	// -- Exponential functions --
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> sqrt(soa<1, T, W> const& x)
+	{
+		soa<1, T, W> Result;
+		detail::compute_soa_lane<T, W, GLM_CONFIG_SIMD == GLM_ENABLE>::sqrt(Result.data, x.data);
+		return Result;
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> inversesqrt(soa<1, T, W> const& x)
+	{
+		return static_cast<T>(1) / sqrt(x);
+	}
+
+	// -- Geometric functions --
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> dot(soa<L, T, W> const& x, soa<L, T, W> const& y)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dot' accepts only floating-point inputs");
+
+		soa<1, T, W> Result(x[0] * y[0]);
+		for(length_t c = 1; c < L; ++c)
+			Result = Result + x[c] * y[c];
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> length(soa<L, T, W> const& x)
+	{
+		return sqrt(dot(x, x));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<1, T, W> distance(soa<L, T, W> const& p0, soa<L, T, W> const& p1)
+	{
+		return length(p1 - p0);
+	}
+
+	template<typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<3, T, W> cross(soa<3, T, W> const& x, soa<3, T, W> const& y)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'cross' accepts only floating-point inputs");
+
+		return soa<3, T, W>(
+			x.y * y.z - y.y * x.z,
+			x.z * y.x - y.z * x.x,
+			x.x * y.y - y.x * x.y);
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> normalize(soa<L, T, W> const& x)
+	{
+		return x * inversesqrt(dot(x, x));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> faceforward(soa<L, T, W> const& N, soa<L, T, W> const& I, soa<L, T, W> const& Nref)
+	{
+		return N * (static_cast<T>(1) - static_cast<T>(2) * step(static_cast<T>(0), dot(Nref, I)));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> reflect(soa<L, T, W> const& I, soa<L, T, W> const& N)
+	{
+		return I - N * (dot(N, I) * static_cast<T>(2));
+	}
+
+	template<length_t L, typename T, length_t W>
+	GLM_FUNC_QUALIFIER soa<L, T, W> refract(soa<L, T, W> const& I, soa<L, T, W> const& N, T eta)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'refract' accepts only floating-point inputs");
+
+		soa<1, T, W> const dotValue(dot(N, I));
+		soa<1, T, W> const k(static_cast<T>(1) - eta * eta * (static_cast<T>(1) - dotValue * dotValue));
+
+		// Lanes with k < 0 are total internal reflections, masked to 0 rather than branched on
+		soa<1, T, W> const mask(step(static_cast<T>(0), k));
+		soa<1, T, W> const root(sqrt(max(k, soa<1, T, W>(static_cast<T>(0)))));
+		return (eta * I - (eta * dotValue + root) * N) * mask;
+	}
+
+	// -- Array of structures conversions --
+
+	template<length_t W, length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER soa<L, T, W> loadSoa(vec<L, T, Q> const* v)
+	{
+		soa<L, T, W> Result;
+		detail::compute_soa_transpose<L, T, W, sizeof(vec<L, T, Q>) / sizeof(T), GLM_CONFIG_SIMD == GLM_ENABLE>::load(Result, &v[0].x);
+		return Result;
+	}
+
+	template<length_t L, typename T, length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER void storeSoa(soa<L, T, W> const& s, vec<L, T, Q>* v)
+	{
+		detail::compute_soa_transpose<L, T, W, sizeof(vec<L, T, Q>) / sizeof(T), GLM_CONFIG_SIMD == GLM_ENABLE>::store(s, &v[0].x);
+	}
+
+	template<length_t L, typename T, qualifier Q, length_t W>
+	GLM_FUNC_QUALIFIER void aosToSoa(vec<L, T, Q> const* v, soa<L, T, W>* s, std::size_t count)
+	{
+		std::size_t const Blocks = count / W;
+		for(std::size_t i = 0; i < Blocks; ++i)
+			s[i] = loadSoa<W>(v + i * W);
+
+		if(Blocks * W < count)
+		{
+			vec<L, T, Q> Tail[W];
+			for(std::size_t i = 0; i < static_cast<std::size_t>(W); ++i)
+				Tail[i] = Blocks * W + i < count ? v[Blocks * W + i] : vec<L, T, Q>(static_cast<T>(0));
+			s[Blocks] = loadSoa<W>(Tail);
+		}
+	}
+
+	template<length_t L, typename T, length_t W, qualifier Q>
+	GLM_FUNC_QUALIFIER void soaToAos(soa<L, T, W> const* s, vec<L, T, Q>* v, std::size_t count)
+	{
+		std::size_t const Blocks = count / W;
+		for(std::size_t i = 0; i < Blocks; ++i)
+			storeSoa(s[i], v + i * W);
+
+		for(std::size_t i = Blocks * W; i < count; ++i)
+			v[i] = s[Blocks].get(static_cast<length_t>(i - Blocks * W));
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "soa_simd.inl"
+#endif
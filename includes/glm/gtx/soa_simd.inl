@@ -0,0 +1,447 @@
+/// @ref gtx_soa
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct soa_op_add
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_add(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_add(a, b);}
+#		endif
+	};
+
+	struct soa_op_sub
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_sub(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_sub(a, b);}
+#		endif
+	};
+
+	struct soa_op_mul
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_mul(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_mul(a, b);}
+#		endif
+	};
+
+	struct soa_op_div
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return glm_vec4_div(a, b);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return glm_vec8_div(a, b);}
+#		endif
+	};
+
+	// min(a, b) is b < a ? b : a, _mm_min_ps(b, a) matches it for NaNs too
+	struct soa_op_min
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return _mm_min_ps(b, a);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return _mm256_min_ps(b, a);}
+#		endif
+	};
+
+	struct soa_op_max
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 a, glm_vec4 b){return _mm_max_ps(b, a);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 a, glm_vec8 b){return _mm256_max_ps(b, a);}
+#		endif
+	};
+
+	struct soa_op_step
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 edge, glm_vec4 x){return _mm_andnot_ps(_mm_cmplt_ps(x, edge), _mm_set1_ps(1.0f));}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 edge, glm_vec8 x){return _mm256_andnot_ps(_mm256_cmp_ps(x, edge, _CMP_LT_OQ), _mm256_set1_ps(1.0f));}
+#		endif
+	};
+
+	struct soa_op_abs
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x){return glm_vec4_abs(x);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 x){return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);}
+#		endif
+	};
+
+	// Without SSE4.1, rounds through integers below 2^23, larger values are already integers
+	struct soa_op_floor
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return _mm_floor_ps(x);
+#			else
+				glm_vec4 const t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+				glm_vec4 const f = glm_vec4_sub(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+				return glm_vec4_select(_mm_cmplt_ps(glm_vec4_abs(x), _mm_set1_ps(8388608.0f)), f, x);
+#			endif
+		}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 x){return _mm256_floor_ps(x);}
+#		endif
+	};
+
+	struct soa_op_ceil
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x)
+		{
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
+				return _mm_ceil_ps(x);
+#			else
+				glm_vec4 const t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+				glm_vec4 const c = glm_vec4_add(t, _mm_and_ps(_mm_cmplt_ps(t, x), _mm_set1_ps(1.0f)));
+				return glm_vec4_select(_mm_cmplt_ps(glm_vec4_abs(x), _mm_set1_ps(8388608.0f)), c, x);
+#			endif
+		}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 x){return _mm256_ceil_ps(x);}
+#		endif
+	};
+
+	struct soa_op_sqrt
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call(glm_vec4 x){return _mm_sqrt_ps(x);}
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_vec8 call(glm_vec8 x){return _mm256_sqrt_ps(x);}
+#		endif
+	};
+
+	// Processes the lanes 8 by 8 with AVX then 4 by 4, the generic code handles the remaining W % 4 lanes
+	template<typename op, length_t W>
+	GLM_FUNC_QUALIFIER void compute_soa_lane_binary(float* r, float const* a, float const* b)
+	{
+		length_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= W; i += 8)
+				_mm256_storeu_ps(r + i, op::call(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#		endif
+		for(; i + 4 <= W; i += 4)
+			_mm_storeu_ps(r + i, op::call(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	}
+
+	template<typename op, length_t W>
+	GLM_FUNC_QUALIFIER void compute_soa_lane_unary(float* r, float const* x)
+	{
+		length_t i = 0;
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= W; i += 8)
+				_mm256_storeu_ps(r + i, op::call(_mm256_loadu_ps(x + i)));
+#		endif
+		for(; i + 4 <= W; i += 4)
+			_mm_storeu_ps(r + i, op::call(_mm_loadu_ps(x + i)));
+	}
+
+	// Transposes 4 packed vec3 to x, y and z lanes and back
+	GLM_FUNC_QUALIFIER void soa_load3x4(float const* v, float* x, float* y, float* z)
+	{
+		glm_vec4 const in[3] = {_mm_loadu_ps(v), _mm_loadu_ps(v + 4), _mm_loadu_ps(v + 8)};
+		glm_vec4 out[3];
+		glm_vec4_deinterleave3(in, out);
+
+		_mm_storeu_ps(x, out[0]);
+		_mm_storeu_ps(y, out[1]);
+		_mm_storeu_ps(z, out[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void soa_store3x4(float const* x, float const* y, float const* z, float* v)
+	{
+		glm_vec4 const in[3] = {_mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z)};
+		glm_vec4 out[3];
+		glm_vec4_interleave3(in, out);
+
+		_mm_storeu_ps(v, out[0]);
+		_mm_storeu_ps(v + 4, out[1]);
+		_mm_storeu_ps(v + 8, out[2]);
+	}
+
+	// Transposes 4 vec4, or 4 aligned vec3 when w is null, to lanes and back
+	GLM_FUNC_QUALIFIER void soa_load4x4(float const* v, float* x, float* y, float* z, float* w)
+	{
+		glm_vec4 const in[4] = {_mm_loadu_ps(v), _mm_loadu_ps(v + 4), _mm_loadu_ps(v + 8), _mm_loadu_ps(v + 12)};
+		glm_vec4 out[4];
+		glm_mat4_transpose(in, out);
+
+		_mm_storeu_ps(x, out[0]);
+		_mm_storeu_ps(y, out[1]);
+		_mm_storeu_ps(z, out[2]);
+		if(w)
+			_mm_storeu_ps(w, out[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void soa_store4x4(float const* x, float const* y, float const* z, float const* w, float* v)
+	{
+		glm_vec4 const in[4] = {_mm_loadu_ps(x), _mm_loadu_ps(y), _mm_loadu_ps(z), w ? _mm_loadu_ps(w) : _mm_setzero_ps()};
+		glm_vec4 out[4];
+		glm_mat4_transpose(in, out);
+
+		_mm_storeu_ps(v, out[0]);
+		_mm_storeu_ps(v + 4, out[1]);
+		_mm_storeu_ps(v + 8, out[2]);
+		_mm_storeu_ps(v + 12, out[3]);
+	}
+
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	struct soa_op_add
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vaddq_f32(a, b);}
+	};
+
+	struct soa_op_sub
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vsubq_f32(a, b);}
+	};
+
+	struct soa_op_mul
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vmulq_f32(a, b);}
+	};
+
+	struct soa_op_div
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vdivq_f32(a, b);}
+	};
+
+	struct soa_op_min
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vbslq_f32(vcltq_f32(b, a), b, a);}
+	};
+
+	struct soa_op_max
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t a, float32x4_t b){return vbslq_f32(vcltq_f32(a, b), b, a);}
+	};
+
+	struct soa_op_step
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t edge, float32x4_t x){return vbslq_f32(vcltq_f32(x, edge), vdupq_n_f32(0.0f), vdupq_n_f32(1.0f));}
+	};
+
+	struct soa_op_abs
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t x){return vabsq_f32(x);}
+	};
+
+	struct soa_op_floor
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t x){return vrndmq_f32(x);}
+	};
+
+	struct soa_op_ceil
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t x){return vrndpq_f32(x);}
+	};
+
+	struct soa_op_sqrt
+	{
+		GLM_FUNC_QUALIFIER static float32x4_t call(float32x4_t x){return vsqrtq_f32(x);}
+	};
+
+	template<typename op, length_t W>
+	GLM_FUNC_QUALIFIER void compute_soa_lane_binary(float* r, float const* a, float const* b)
+	{
+		for(length_t i = 0; i + 4 <= W; i += 4)
+			vst1q_f32(r + i, op::call(vld1q_f32(a + i), vld1q_f32(b + i)));
+	}
+
+	template<typename op, length_t W>
+	GLM_FUNC_QUALIFIER void compute_soa_lane_unary(float* r, float const* x)
+	{
+		for(length_t i = 0; i + 4 <= W; i += 4)
+			vst1q_f32(r + i, op::call(vld1q_f32(x + i)));
+	}
+
+	GLM_FUNC_QUALIFIER void soa_load3x4(float const* v, float* x, float* y, float* z)
+	{
+		float32x4x3_t const t = vld3q_f32(v);
+		vst1q_f32(x, t.val[0]);
+		vst1q_f32(y, t.val[1]);
+		vst1q_f32(z, t.val[2]);
+	}
+
+	GLM_FUNC_QUALIFIER void soa_store3x4(float const* x, float const* y, float const* z, float* v)
+	{
+		float32x4x3_t t;
+		t.val[0] = vld1q_f32(x);
+		t.val[1] = vld1q_f32(y);
+		t.val[2] = vld1q_f32(z);
+		vst3q_f32(v, t);
+	}
+
+	GLM_FUNC_QUALIFIER void soa_load4x4(float const* v, float* x, float* y, float* z, float* w)
+	{
+		float32x4x4_t const t = vld4q_f32(v);
+		vst1q_f32(x, t.val[0]);
+		vst1q_f32(y, t.val[1]);
+		vst1q_f32(z, t.val[2]);
+		if(w)
+			vst1q_f32(w, t.val[3]);
+	}
+
+	GLM_FUNC_QUALIFIER void soa_store4x4(float const* x, float const* y, float const* z, float const* w, float* v)
+	{
+		float32x4x4_t t;
+		t.val[0] = vld1q_f32(x);
+		t.val[1] = vld1q_f32(y);
+		t.val[2] = vld1q_f32(z);
+		t.val[3] = w ? vld1q_f32(w) : vdupq_n_f32(0.0f);
+		vst4q_f32(v, t);
+	}
+#endif//GLM_ARCH
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) || (GLM_ARCH & GLM_ARCH_ARMV8_BIT)
+	template<length_t W>
+	struct compute_soa_lane<float, W, true>
+	{
+		typedef compute_soa_lane<float, W % 4, false> tail;
+
+		GLM_FUNC_QUALIFIER static void add(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_add, W>(r, a, b);
+			tail::add(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void sub(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_sub, W>(r, a, b);
+			tail::sub(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_mul, W>(r, a, b);
+			tail::mul(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void div(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_div, W>(r, a, b);
+			tail::div(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void min(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_min, W>(r, a, b);
+			tail::min(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void max(float* r, float const* a, float const* b)
+		{
+			compute_soa_lane_binary<soa_op_max, W>(r, a, b);
+			tail::max(r + W / 4 * 4, a + W / 4 * 4, b + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void step(float* r, float const* edge, float const* x)
+		{
+			compute_soa_lane_binary<soa_op_step, W>(r, edge, x);
+			tail::step(r + W / 4 * 4, edge + W / 4 * 4, x + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void abs(float* r, float const* x)
+		{
+			compute_soa_lane_unary<soa_op_abs, W>(r, x);
+			tail::abs(r + W / 4 * 4, x + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void floor(float* r, float const* x)
+		{
+			compute_soa_lane_unary<soa_op_floor, W>(r, x);
+			tail::floor(r + W / 4 * 4, x + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void ceil(float* r, float const* x)
+		{
+			compute_soa_lane_unary<soa_op_ceil, W>(r, x);
+			tail::ceil(r + W / 4 * 4, x + W / 4 * 4);
+		}
+
+		GLM_FUNC_QUALIFIER static void sqrt(float* r, float const* x)
+		{
+			compute_soa_lane_unary<soa_op_sqrt, W>(r, x);
+			tail::sqrt(r + W / 4 * 4, x + W / 4 * 4);
+		}
+	};
+
+	template<length_t W>
+	struct compute_soa_transpose<3, float, W, 3, true>
+	{
+		GLM_FUNC_QUALIFIER static void load(soa<3, float, W>& s, float const* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_load3x4(v + i * 3, s.x.data + i, s.y.data + i, s.z.data + i);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+				s.set(i, vec<3, float, packed_highp>(v[i * 3], v[i * 3 + 1], v[i * 3 + 2]));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(soa<3, float, W> const& s, float* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_store3x4(s.x.data + i, s.y.data + i, s.z.data + i, v + i * 3);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+			{
+				v[i * 3] = s.x[i];
+				v[i * 3 + 1] = s.y[i];
+				v[i * 3 + 2] = s.z[i];
+			}
+		}
+	};
+
+	// Aligned vec3 are padded to 4 floats, the padding is written with 0
+	template<length_t W>
+	struct compute_soa_transpose<3, float, W, 4, true>
+	{
+		GLM_FUNC_QUALIFIER static void load(soa<3, float, W>& s, float const* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_load4x4(v + i * 4, s.x.data + i, s.y.data + i, s.z.data + i, NULL);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+				s.set(i, vec<3, float, packed_highp>(v[i * 4], v[i * 4 + 1], v[i * 4 + 2]));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(soa<3, float, W> const& s, float* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_store4x4(s.x.data + i, s.y.data + i, s.z.data + i, NULL, v + i * 4);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+			{
+				v[i * 4] = s.x[i];
+				v[i * 4 + 1] = s.y[i];
+				v[i * 4 + 2] = s.z[i];
+			}
+		}
+	};
+
+	template<length_t W>
+	struct compute_soa_transpose<4, float, W, 4, true>
+	{
+		GLM_FUNC_QUALIFIER static void load(soa<4, float, W>& s, float const* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_load4x4(v + i * 4, s.x.data + i, s.y.data + i, s.z.data + i, s.w.data + i);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+				s.set(i, vec<4, float, packed_highp>(v[i * 4], v[i * 4 + 1], v[i * 4 + 2], v[i * 4 + 3]));
+		}
+
+		GLM_FUNC_QUALIFIER static void store(soa<4, float, W> const& s, float* v)
+		{
+			for(length_t i = 0; i + 4 <= W; i += 4)
+				soa_store4x4(s.x.data + i, s.y.data + i, s.z.data + i, s.w.data + i, v + i * 4);
+			for(length_t i = W / 4 * 4; i < W; ++i)
+			{
+				v[i * 4] = s.x[i];
+				v[i * 4 + 1] = s.y[i];
+				v[i * 4 + 2] = s.z[i];
+				v[i * 4 + 3] = s.w[i];
+			}
+		}
+	};
+#endif
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,104 @@
+/// @ref gtx_spatial_hash
+/// @file glm/gtx/spatial_hash.hpp
+///
+/// @see core (dependence)
+/// @see gtx_hash (dependence)
+///
+/// @defgroup gtx_spatial_hash GLM_GTX_spatial_hash
+/// @ingroup gtx
+///
+/// Include <glm/gtx/spatial_hash.hpp> to use the features of this extension.
+///
+/// Spatial hash grid of points: the points are bucketed in the cubic cells of a regular grid, and only the cells holding points are stored,
+/// in an open addressing hash table keyed on the integer coordinates of the cells, floor(position / cellSize).
+/// The points of a cell are contiguous, which makes the radius queries of particle systems and the welding of vertices cache friendly.
+/// The keys are hashed with hashArray of gtx_hash when the grid is built.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/hash.hpp"
+#include <cstddef>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_spatial_hash is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_spatial_hash extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_spatial_hash
+	/// @{
+
+	/// Spatial hash grid of points.
+	/// @see gtx_spatial_hash
+	template<typename T, qualifier Q = defaultp>
+	struct tspatial_hash
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+
+		/// A cell of the grid holding count points, indices[first] to indices[first + count - 1]
+		struct cell
+		{
+			vec<3, int, Q> key;
+			uint32 first;
+			uint32 count;
+		};
+
+		// -- Data --
+
+		/// Edge length of the cells
+		T cellSize;
+
+		/// The cells holding points, in the order of their first point
+		std::vector<cell> cells;
+
+		/// Hash table of the indices of the cells, with linear probing from the slot hashValue(key) & (table.size() - 1).
+		/// Its size is a power of two, at least twice the number of cells, and its empty slots hold 0xFFFFFFFF.
+		std::vector<uint32> table;
+
+		/// Indices of the points in the array the grid was built from, grouped by cell and increasing within a cell
+		std::vector<uint32> indices;
+	};
+
+	/// Returns the key of the cell of the grid containing position.
+	/// @see gtx_spatial_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, int, Q> spatialHashKey(tspatial_hash<T, Q> const& grid, vec<3, T, Q> const& position);
+
+	/// Builds the grid of cells of edge cellSize of the count points positions[i].
+	/// @see gtx_spatial_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void buildSpatialHash(tspatial_hash<T, Q>& grid, vec<3, T, Q> const* positions, std::size_t count, T cellSize);
+
+	/// Returns the indices of the points of the cell key, and their number in count.
+	/// Returns a null pointer and a count of 0 if the cell holds no point.
+	/// @see gtx_spatial_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL uint32 const* findSpatialHash(tspatial_hash<T, Q> const& grid, vec<3, int, Q> const& key, std::size_t& count);
+
+	/// Appends to result the indices of the points at a distance of at most radius of center, and returns their number.
+	/// positions is the array the grid was built from. The cells overlapping the sphere are visited in the order of their keys.
+	/// @see gtx_spatial_hash
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t querySpatialHash(
+		tspatial_hash<T, Q> const& grid, vec<3, T, Q> const* positions, vec<3, T, Q> const& center, T radius,
+		std::vector<uint32>& result);
+
+	/// Spatial hash grid of single-qualifier floating-point points.
+	/// @see gtx_spatial_hash
+	typedef tspatial_hash<float, defaultp>		spatial_hash;
+
+	/// Spatial hash grid of double-qualifier floating-point points.
+	/// @see gtx_spatial_hash
+	typedef tspatial_hash<double, defaultp>		dspatial_hash;
+
+	/// @}
+}//namespace glm
+
+#include "spatial_hash.inl"
@@ -0,0 +1,155 @@
+/// @ref gtx_spatial_hash
+
+namespace glm{
+namespace detail
+{
+	// The keys of the built grid and of the queries are computed the same way, with the same rounding
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, int, Q> spatial_hash_key(vec<3, T, Q> const& position, T Scale)
+	{
+		return vec<3, int, Q>(floor(position * Scale));
+	}
+
+	static const uint32 spatial_hash_empty = 0xFFFFFFFFu;
+
+	// Number of points whose keys are hashed together by buildSpatialHash
+	static const length_t spatial_hash_block = 256;
+
+	// Returns the slot of the table holding the cell key, or the empty slot where it would be inserted
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t spatial_hash_find(tspatial_hash<T, Q> const& grid, vec<3, int, Q> const& key, uint64 Hash)
+	{
+		std::size_t const Mask = grid.table.size() - 1;
+
+		std::size_t Slot = static_cast<std::size_t>(Hash) & Mask;
+		while(grid.table[Slot] != spatial_hash_empty && grid.cells[grid.table[Slot]].key != key)
+			Slot = (Slot + 1) & Mask;
+		return Slot;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void spatial_hash_resize(tspatial_hash<T, Q>& grid, std::size_t Size)
+	{
+		grid.table.assign(Size, spatial_hash_empty);
+		for(std::size_t i = 0; i < grid.cells.size(); ++i)
+			grid.table[spatial_hash_find(grid, grid.cells[i].key, hashValue(grid.cells[i].key))] = static_cast<uint32>(i);
+	}
+
+	// Returns the index of the cell key, added with no point if the grid doesn't hold it
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint32 spatial_hash_insert(tspatial_hash<T, Q>& grid, vec<3, int, Q> const& key, uint64 Hash)
+	{
+		typedef typename tspatial_hash<T, Q>::cell cell;
+
+		std::size_t Slot = spatial_hash_find(grid, key, Hash);
+		if(grid.table[Slot] != spatial_hash_empty)
+			return grid.table[Slot];
+
+		if((grid.cells.size() + 1) * 2 > grid.table.size())
+		{
+			spatial_hash_resize(grid, grid.table.size() * 2);
+			Slot = spatial_hash_find(grid, key, Hash);
+		}
+
+		cell Cell;
+		Cell.key = key;
+		Cell.first = 0;
+		Cell.count = 0;
+
+		grid.table[Slot] = static_cast<uint32>(grid.cells.size());
+		grid.cells.push_back(Cell);
+		return grid.table[Slot];
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, int, Q> spatialHashKey(tspatial_hash<T, Q> const& grid, vec<3, T, Q> const& position)
+	{
+		return detail::spatial_hash_key(position, static_cast<T>(1) / grid.cellSize);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildSpatialHash(tspatial_hash<T, Q>& grid, vec<3, T, Q> const* positions, std::size_t count, T cellSize)
+	{
+		grid.cellSize = cellSize;
+		grid.cells.clear();
+		grid.table.assign(16, detail::spatial_hash_empty);
+		grid.indices.resize(count);
+
+		// The table grows with the number of cells, which may be much smaller than the number of points.
+		// The keys are hashed by blocks, and the cell of each point is kept for the scatter.
+		T const Scale = static_cast<T>(1) / cellSize;
+		std::vector<uint32> Cells(count);
+		vec<3, int, Q> Keys[detail::spatial_hash_block];
+		uint64 Hashes[detail::spatial_hash_block];
+		for(std::size_t Base = 0; Base < count; Base += detail::spatial_hash_block)
+		{
+			std::size_t const Size = min(count - Base, static_cast<std::size_t>(detail::spatial_hash_block));
+			for(std::size_t i = 0; i < Size; ++i)
+				Keys[i] = detail::spatial_hash_key(positions[Base + i], Scale);
+			hashArray(Keys, Hashes, Size);
+
+			for(std::size_t i = 0; i < Size; ++i)
+			{
+				Cells[Base + i] = detail::spatial_hash_insert(grid, Keys[i], Hashes[i]);
+				++grid.cells[Cells[Base + i]].count;
+			}
+		}
+
+		uint32 First = 0;
+		for(std::size_t i = 0; i < grid.cells.size(); ++i)
+		{
+			grid.cells[i].first = First;
+			First += grid.cells[i].count;
+		}
+
+		// first is used as the cursor of the cell, and moved back to its start afterward
+		for(std::size_t i = 0; i < count; ++i)
+			grid.indices[grid.cells[Cells[i]].first++] = static_cast<uint32>(i);
+		for(std::size_t i = 0; i < grid.cells.size(); ++i)
+			grid.cells[i].first -= grid.cells[i].count;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint32 const* findSpatialHash(tspatial_hash<T, Q> const& grid, vec<3, int, Q> const& key, std::size_t& count)
+	{
+		count = 0;
+		if(grid.table.empty())
+			return GLM_NULLPTR;
+
+		uint32 const Cell = grid.table[detail::spatial_hash_find(grid, key, hashValue(key))];
+		if(Cell == detail::spatial_hash_empty)
+			return GLM_NULLPTR;
+
+		count = grid.cells[Cell].count;
+		return &grid.indices[grid.cells[Cell].first];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t querySpatialHash(
+		tspatial_hash<T, Q> const& grid, vec<3, T, Q> const* positions, vec<3, T, Q> const& center, T radius,
+		std::vector<uint32>& result)
+	{
+		T const Scale = static_cast<T>(1) / grid.cellSize;
+		vec<3, int, Q> const Min = detail::spatial_hash_key(center - radius, Scale);
+		vec<3, int, Q> const Max = detail::spatial_hash_key(center + radius, Scale);
+		T const Radius2 = radius * radius;
+
+		std::size_t const Size = result.size();
+		for(int z = Min.z; z <= Max.z; ++z)
+			for(int y = Min.y; y <= Max.y; ++y)
+				for(int x = Min.x; x <= Max.x; ++x)
+				{
+					std::size_t Count = 0;
+					uint32 const* Indices = findSpatialHash(grid, vec<3, int, Q>(x, y, z), Count);
+					for(std::size_t i = 0; i < Count; ++i)
+					{
+						vec<3, T, Q> const Delta(positions[Indices[i]] - center);
+						if(dot(Delta, Delta) <= Radius2)
+							result.push_back(Indices[i]);
+					}
+				}
+
+		return result.size() - Size;
+	}
+}//namespace glm
@@ -196,6 +196,26 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 	return mad0;
 }
 
+// Per lane, returns a where mask is all ones and b where mask is zero
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#	endif
+}
+
+// Per lane, returns a where mask is all ones and b where mask is zero
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_select(glm_ivec4 mask, glm_ivec4 a, glm_ivec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_epi8(b, a, mask);
+#	else
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
 {
 	glm_vec4 const cmp = _mm_cmple_ps(x, edge);
@@ -238,3 +258,106 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Paired vec4: the low 128 bits hold one vec4, the high 128 bits the next one
+
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_add(glm_vec8 a, glm_vec8 b)
+{
+	return _mm256_add_ps(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_sub(glm_vec8 a, glm_vec8 b)
+{
+	return _mm256_sub_ps(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_mul(glm_vec8 a, glm_vec8 b)
+{
+	return _mm256_mul_ps(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_div(glm_vec8 a, glm_vec8 b)
+{
+	return _mm256_div_ps(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_vec8 glm_vec8_fma(glm_vec8 a, glm_vec8 b, glm_vec8 c)
+{
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !(GLM_COMPILER & GLM_COMPILER_CLANG)
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return glm_vec8_add(glm_vec8_mul(a, b), c);
+#	endif
+}
+
+// Double-precision vec4: the 4 components fill the 256 bits
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_add(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_add_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_sub(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_sub_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_mul(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_mul_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_div(glm_dvec4 a, glm_dvec4 b)
+{
+	return _mm256_div_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fma(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !(GLM_COMPILER & GLM_COMPILER_CLANG)
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return glm_dvec4_add(glm_dvec4_mul(a, b), c);
+#	endif
+}
+
+// Broadcasts of one component, without AVX2 a vperm2f128 first duplicates the 128 bits half holding it
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_x(glm_dvec4 a)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(a, _MM_SHUFFLE(0, 0, 0, 0));
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x00), 0x0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_y(glm_dvec4 a)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(a, _MM_SHUFFLE(1, 1, 1, 1));
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x00), 0xF);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_z(glm_dvec4 a)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(a, _MM_SHUFFLE(2, 2, 2, 2));
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x11), 0x0);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_splat_w(glm_dvec4 a)
+{
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		return _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 3, 3, 3));
+#	else
+		return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x11), 0xF);
+#	endif
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -1,9 +1,16 @@
 /// @ref simd
-/// @file glm/simd/experimental.h
+/// @file glm/simd/exponential.h
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
+
+// Accuracy tiers, measured against double precision references:
+// - highp: exp, exp2, log, log2 and inversesqrt within 1 ULP; pow is evaluated in double precision and within 1 ULP
+// - mediump: exp2(y * log2(x)) in single precision for pow, its relative error grows with |y * log2(x)|, about 1e-5 near overflow;
+//   inversesqrt uses the hardware estimate refined by one Newton-Raphson step, within 4 ULP
+// - lowp: shorter polynomials with a relative error below 1e-4 for exp, exp2, log and log2, 1e-3 for pow;
+//   inversesqrt is the raw hardware estimate, about 4e-4
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +24,259 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt(glm_vec4 x)
+{
+	return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(x));
+}
+
+// One Newton-Raphson step refines the 12 bits estimate to about 22 bits, subnormals are scaled by 2^24 first
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_mediump(glm_vec4 x)
+{
+	glm_vec4 const tiny = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const xs = glm_vec4_select(tiny, glm_vec4_mul(x, _mm_set1_ps(16777216.0f)), x);
+	glm_vec4 const r = _mm_rsqrt_ps(xs);
+	glm_vec4 const hxr2 = glm_vec4_mul(glm_vec4_mul(_mm_set1_ps(0.5f), xs), glm_vec4_mul(r, r));
+	glm_vec4 Result = glm_vec4_mul(r, glm_vec4_sub(_mm_set1_ps(1.5f), hxr2));
+	Result = glm_vec4_mul(Result, glm_vec4_select(tiny, _mm_set1_ps(4096.0f), _mm_set1_ps(1.0f)));
+
+	// zero and infinity turn the refinement into 0 * inf, the estimate is already exact there
+	return glm_vec4_select(_mm_cmpunord_ps(Result, Result), r, Result);
+}
+
+// Subnormal inputs are treated as zero
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inversesqrt_lowp(glm_vec4 x)
+{
+	return _mm_rsqrt_ps(x);
+}
+
+// Returns x * 2^n for n in [-252, 254], overflowing to infinity and rounding once into the subnormal range
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_ldexp(glm_vec4 x, glm_ivec4 n)
+{
+	glm_ivec4 const n1 = _mm_srai_epi32(n, 1);
+	glm_ivec4 const n2 = _mm_sub_epi32(n, n1);
+	glm_vec4 const p1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23));
+	glm_vec4 const p2 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23));
+	return glm_vec4_mul(glm_vec4_mul(x, p1), p2);
+}
+
+// Returns e^r for |r| <= ln(2) / 2
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_reduced(glm_vec4 r)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	p = glm_vec4_fma(p, glm_vec4_mul(r, r), r);
+	return glm_vec4_add(p, _mm_set1_ps(1.0f));
+}
+
+// Returns 2^f for |f| <= 1 / 2
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_reduced_lowp(glm_vec4 f)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(5.583828295e-2f), f, _mm_set1_ps(2.426394785e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(6.931367339e-1f));
+	return glm_vec4_fma(p, f, _mm_set1_ps(9.999245570e-1f));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp(glm_vec4 x)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-104.0f)), _mm_set1_ps(89.0f));
+	glm_ivec4 const n = _mm_cvtps_epi32(glm_vec4_mul(c, _mm_set1_ps(1.44269504088896341f)));
+	glm_vec4 const nf = _mm_cvtepi32_ps(n);
+
+	// Cody-Waite reduction, ln(2) = 0.693359375 - 2.12194440e-4
+	glm_vec4 r = glm_vec4_fma(nf, _mm_set1_ps(-0.693359375f), c);
+	r = glm_vec4_fma(nf, _mm_set1_ps(2.12194440e-4f), r);
+
+	glm_vec4 const Result = glm_vec4_ldexp(glm_vec4_exp_reduced(r), n);
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2(glm_vec4 x)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-151.0f)), _mm_set1_ps(129.0f));
+	glm_ivec4 const n = _mm_cvtps_epi32(c);
+	glm_vec4 const f = glm_vec4_sub(c, _mm_cvtepi32_ps(n));
+
+	glm_vec4 const Result = glm_vec4_ldexp(glm_vec4_exp_reduced(glm_vec4_mul(f, _mm_set1_ps(0.693147180559945309f))), n);
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp2_lowp(glm_vec4 x)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-151.0f)), _mm_set1_ps(129.0f));
+	glm_ivec4 const n = _mm_cvtps_epi32(c);
+	glm_vec4 const f = glm_vec4_sub(c, _mm_cvtepi32_ps(n));
+
+	glm_vec4 Result = glm_vec4_ldexp(glm_vec4_exp2_reduced_lowp(f), n);
+	Result = glm_vec4_select(_mm_cmpge_ps(x, _mm_set1_ps(128.0f)), _mm_castsi128_ps(_mm_set1_epi32(0x7F800000)), Result);
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_exp_lowp(glm_vec4 x)
+{
+	return glm_vec4_exp2_lowp(glm_vec4_mul(x, _mm_set1_ps(1.44269504088896341f)));
+}
+
+// Splits a positive finite x into (1 + m) * 2^e with m in [sqrt(1/2) - 1, sqrt(2) - 1), exactly
+GLM_FUNC_QUALIFIER void glm_vec4_log_reduce(glm_vec4 x, glm_vec4* m, glm_vec4* e)
+{
+	// subnormals are scaled into the normal range first
+	glm_vec4 const tiny = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+	glm_vec4 const xs = glm_vec4_select(tiny, glm_vec4_mul(x, _mm_set1_ps(33554432.0f)), x);
+
+	glm_ivec4 const bits = _mm_castps_si128(xs);
+	glm_vec4 ef = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+	ef = glm_vec4_sub(ef, _mm_and_ps(tiny, _mm_set1_ps(25.0f)));
+
+	// mantissa in [0.5, 1), folded to [sqrt(1/2), sqrt(2)) then shifted by one
+	glm_vec4 mf = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+	glm_vec4 const lt = _mm_cmplt_ps(mf, _mm_set1_ps(0.707106781186547524f));
+	ef = glm_vec4_sub(ef, _mm_and_ps(lt, _mm_set1_ps(1.0f)));
+	mf = glm_vec4_sub(glm_vec4_add(mf, _mm_and_ps(lt, mf)), _mm_set1_ps(1.0f));
+
+	*m = mf;
+	*e = ef;
+}
+
+// Returns ln(1 + m) - m for m in [sqrt(1/2) - 1, sqrt(2) - 1)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_reduced(glm_vec4 m)
+{
+	glm_vec4 const z = glm_vec4_mul(m, m);
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(3.3333331174e-1f));
+	p = glm_vec4_mul(glm_vec4_mul(p, m), z);
+	return glm_vec4_fma(z, _mm_set1_ps(-0.5f), p);
+}
+
+// Returns log2(1 + m) / m for m in [sqrt(1/2) - 1, sqrt(2) - 1)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_reduced_lowp(glm_vec4 m)
+{
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(2.502878470e-1f), m, _mm_set1_ps(-3.896752238e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(4.857378424e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-7.206292159e-1f));
+	return glm_vec4_fma(p, m, _mm_set1_ps(1.442640464e+0f));
+}
+
+// log(0) = -inf, log(x < 0) = NaN, log(inf) = inf and NaN propagates
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_special(glm_vec4 x, glm_vec4 Result)
+{
+	glm_vec4 const inf = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	Result = glm_vec4_select(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), inf), Result);
+	Result = glm_vec4_select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_castsi128_ps(_mm_set1_epi32(0x7FC00000)), Result);
+	Result = glm_vec4_select(_mm_cmpeq_ps(x, inf), inf, Result);
+	return glm_vec4_select(_mm_cmpunord_ps(x, x), x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log(glm_vec4 x)
+{
+	glm_vec4 m, e;
+	glm_vec4_log_reduce(x, &m, &e);
+
+	// Cody-Waite, ln(2) = 0.693359375 - 2.12194440e-4
+	glm_vec4 Result = glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), glm_vec4_log_reduced(m));
+	Result = glm_vec4_add(Result, m);
+	Result = glm_vec4_fma(e, _mm_set1_ps(0.693359375f), Result);
+	return glm_vec4_log_special(x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2(glm_vec4 x)
+{
+	glm_vec4 m, e;
+	glm_vec4_log_reduce(x, &m, &e);
+
+	// log2(e) = 1 + 0.44269504088896340736, applied to the small terms first
+	glm_vec4 const l2ea = _mm_set1_ps(0.44269504088896340736f);
+	glm_vec4 const y = glm_vec4_log_reduced(m);
+	glm_vec4 Result = glm_vec4_mul(y, l2ea);
+	Result = glm_vec4_fma(m, l2ea, Result);
+	Result = glm_vec4_add(Result, y);
+	Result = glm_vec4_add(Result, m);
+	Result = glm_vec4_add(Result, e);
+	return glm_vec4_log_special(x, Result);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log2_lowp(glm_vec4 x)
+{
+	glm_vec4 m, e;
+	glm_vec4_log_reduce(x, &m, &e);
+	return glm_vec4_log_special(x, glm_vec4_fma(m, glm_vec4_log2_reduced_lowp(m), e));
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_log_lowp(glm_vec4 x)
+{
+	return glm_vec4_mul(glm_vec4_log2_lowp(x), _mm_set1_ps(0.693147180559945309f));
+}
+
+// Returns true when every lane has a positive finite base and a finite exponent, the domain of the pow kernels
+GLM_FUNC_QUALIFIER bool glm_vec4_pow_domain(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 const inf = _mm_castsi128_ps(_mm_set1_epi32(0x7F800000));
+	glm_vec4 const base = _mm_and_ps(_mm_cmpgt_ps(x, _mm_setzero_ps()), _mm_cmplt_ps(x, inf));
+	glm_vec4 const exponent = _mm_cmplt_ps(glm_vec4_abs(y), inf);
+	return _mm_movemask_ps(_mm_and_ps(base, exponent)) == 0xF;
+}
+
+// Computes 2^(y * log2((1 + m) * 2^e)) as p * 2^n in double precision, with p in [sqrt(1/2), sqrt(2)]
+GLM_FUNC_QUALIFIER glm_f64vec2 glm_dvec2_pow_split(glm_f64vec2 m, glm_f64vec2 e, glm_f64vec2 y, glm_ivec4* n)
+{
+	// ln(1 + m) = 2 * atanh(s) with s = m / (2 + m), |s| < 0.172
+	glm_f64vec2 const s = _mm_div_pd(m, _mm_add_pd(_mm_set1_pd(2.0), m));
+	glm_f64vec2 const s2 = _mm_mul_pd(s, s);
+	glm_f64vec2 q = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(1.0 / 13.0), s2), _mm_set1_pd(1.0 / 11.0));
+	q = _mm_add_pd(_mm_mul_pd(q, s2), _mm_set1_pd(1.0 / 9.0));
+	q = _mm_add_pd(_mm_mul_pd(q, s2), _mm_set1_pd(1.0 / 7.0));
+	q = _mm_add_pd(_mm_mul_pd(q, s2), _mm_set1_pd(1.0 / 5.0));
+	q = _mm_add_pd(_mm_mul_pd(q, s2), _mm_set1_pd(1.0 / 3.0));
+	q = _mm_add_pd(_mm_mul_pd(q, s2), _mm_set1_pd(1.0));
+	glm_f64vec2 const l = _mm_add_pd(_mm_mul_pd(_mm_mul_pd(s, q), _mm_set1_pd(2.0 * 1.4426950408889634)), e);
+
+	glm_f64vec2 const t = _mm_min_pd(_mm_max_pd(_mm_mul_pd(y, l), _mm_set1_pd(-200.0)), _mm_set1_pd(200.0));
+	*n = _mm_cvtpd_epi32(t);
+	glm_f64vec2 const r = _mm_mul_pd(_mm_sub_pd(t, _mm_cvtepi32_pd(*n)), _mm_set1_pd(0.6931471805599453));
+
+	// e^r truncated after r^9 / 9!, |r| <= ln(2) / 2
+	glm_f64vec2 p = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(2.7557319223985893e-6), r), _mm_set1_pd(2.48015873015873e-5));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(1.984126984126984e-4));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(1.388888888888889e-3));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(8.333333333333333e-3));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(4.1666666666666664e-2));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(1.6666666666666666e-1));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(0.5));
+	p = _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(1.0));
+	return _mm_add_pd(_mm_mul_pd(p, r), _mm_set1_pd(1.0));
+}
+
+// Only valid where glm_vec4_pow_domain holds
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow(glm_vec4 x, glm_vec4 y)
+{
+	glm_vec4 m, e;
+	glm_vec4_log_reduce(x, &m, &e);
+
+	glm_ivec4 n01, n23;
+	glm_f64vec2 const p01 = glm_dvec2_pow_split(_mm_cvtps_pd(m), _mm_cvtps_pd(e), _mm_cvtps_pd(y), &n01);
+	glm_f64vec2 const p23 = glm_dvec2_pow_split(_mm_cvtps_pd(_mm_movehl_ps(m, m)), _mm_cvtps_pd(_mm_movehl_ps(e, e)), _mm_cvtps_pd(_mm_movehl_ps(y, y)), &n23);
+	glm_vec4 const p = _mm_movelh_ps(_mm_cvtpd_ps(p01), _mm_cvtpd_ps(p23));
+	return glm_vec4_ldexp(p, _mm_unpacklo_epi64(n01, n23));
+}
+
+// Only valid where glm_vec4_pow_domain holds
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow_mediump(glm_vec4 x, glm_vec4 y)
+{
+	return glm_vec4_exp2(glm_vec4_mul(y, glm_vec4_log2(x)));
+}
+
+// Only valid where glm_vec4_pow_domain holds
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_pow_lowp(glm_vec4 x, glm_vec4 y)
+{
+	return glm_vec4_exp2_lowp(glm_vec4_mul(y, glm_vec4_log2_lowp(x)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
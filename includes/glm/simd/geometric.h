@@ -62,6 +62,18 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec1_dot(glm_vec4 v1, glm_vec4 v2)
 #	endif
 }
 
+// Dot product of the x, y and z lanes returned in the first lane, the w lane of the inputs is ignored
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_dot(glm_vec4 v1, glm_vec4 v2)
+{
+	// Faster than _mm_dp_ps, whose latency dominates determinant and inverse
+	glm_vec4 const mul0 = _mm_mul_ps(v1, v2);
+	glm_vec4 const swp0 = _mm_shuffle_ps(mul0, mul0, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const swp1 = _mm_movehl_ps(mul0, mul0);
+	glm_vec4 const add0 = _mm_add_ss(mul0, swp0);
+	glm_vec4 const add1 = _mm_add_ss(add0, swp1);
+	return add1;
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cross(glm_vec4 v1, glm_vec4 v2)
 {
 	glm_vec4 const swp0 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 0, 2, 1));
@@ -128,3 +140,16 @@ GLM_FUNC_QUALIFIER __m128 glm_vec4_refract(glm_vec4 I, glm_vec4 N, glm_vec4 eta)
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Returns the dot product in the 4 lanes
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_dot(glm_dvec4 v1, glm_dvec4 v2)
+{
+	glm_dvec4 const mul0 = _mm256_mul_pd(v1, v2);
+	glm_dvec4 const hadd0 = _mm256_hadd_pd(mul0, mul0);
+	glm_dvec4 const swp0 = _mm256_permute2f128_pd(hadd0, hadd0, 0x01);
+	return _mm256_add_pd(hadd0, swp0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
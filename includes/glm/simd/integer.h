@@ -112,4 +112,87 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Outer perfect shuffle of the bits of each 32 bits lane: the bit i of the low half moves to the bit 2i and the bit i of the high half to the bit 2i + 1.
+// It interleaves two 16 bits values in a lane, applied twice it interleaves the four bytes of a lane.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_shuffle(glm_uvec4 x)
+{
+	glm_uvec4 t;
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 8)), _mm_set1_epi32(0x0000FF00));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 4)), _mm_set1_epi32(0x00F000F0));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 1)), _mm_set1_epi32(0x22222222));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+
+	return x;
+}
+
+// Inverse of glm_i128_shuffle: the even bits of each 32 bits lane move to the low half and the odd bits to the high half.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_unshuffle(glm_uvec4 x)
+{
+	glm_uvec4 t;
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 1)), _mm_set1_epi32(0x22222222));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 4)), _mm_set1_epi32(0x00F000F0));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+
+	t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi32(x, 8)), _mm_set1_epi32(0x0000FF00));
+	x = _mm_xor_si128(x, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+
+	return x;
+}
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+GLM_FUNC_QUALIFIER __m256i glm_i256_shuffle(__m256i x)
+{
+	__m256i t;
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 8)), _mm256_set1_epi32(0x0000FF00));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 4)), _mm256_set1_epi32(0x00F000F0));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 1)), _mm256_set1_epi32(0x22222222));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+
+	return x;
+}
+
+GLM_FUNC_QUALIFIER __m256i glm_i256_unshuffle(__m256i x)
+{
+	__m256i t;
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 1)), _mm256_set1_epi32(0x22222222));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 4)), _mm256_set1_epi32(0x00F000F0));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+
+	t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi32(x, 8)), _mm256_set1_epi32(0x0000FF00));
+	x = _mm256_xor_si256(x, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+
+	return x;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -166,6 +166,55 @@ GLM_FUNC_QUALIFIER void glm_mat4_transpose(glm_vec4 const in[4], glm_vec4 out[4]
 	out[3] = _mm_shuffle_ps(tmp2, tmp3, 0xDD);
 }
 
+// Transposes 4 packed vec3 loaded as x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3 to their x, y and z lanes
+GLM_FUNC_QUALIFIER void glm_vec4_deinterleave3(glm_vec4 const in[3], glm_vec4 out[3])
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		// Blends gather each component in a rotated order that a single shuffle restores
+		glm_vec4 const x = _mm_blend_ps(_mm_blend_ps(in[0], in[1], 0x4), in[2], 0x2);	// x0 x3 x2 x1
+		glm_vec4 const y = _mm_blend_ps(_mm_blend_ps(in[0], in[1], 0x9), in[2], 0x4);	// y1 y0 y3 y2
+		glm_vec4 const z = _mm_blend_ps(_mm_blend_ps(in[0], in[1], 0x2), in[2], 0x9);	// z2 z1 z0 z3
+
+		out[0] = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+		out[1] = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+		out[2] = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+#	else
+		glm_vec4 const bc0 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 1, 2, 2));
+		glm_vec4 const ab1 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 1, 1));
+		glm_vec4 const bc1 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(2, 2, 3, 3));
+		glm_vec4 const ab2 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(1, 1, 2, 2));
+
+		out[0] = _mm_shuffle_ps(in[0], bc0, _MM_SHUFFLE(2, 0, 3, 0));
+		out[1] = _mm_shuffle_ps(ab1, bc1, _MM_SHUFFLE(2, 0, 2, 0));
+		out[2] = _mm_shuffle_ps(ab2, in[2], _MM_SHUFFLE(3, 0, 2, 0));
+#	endif
+}
+
+// Transposes x, y and z lanes to 4 packed vec3, the inverse of glm_vec4_deinterleave3
+GLM_FUNC_QUALIFIER void glm_vec4_interleave3(glm_vec4 const in[3], glm_vec4 out[3])
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		glm_vec4 const x = _mm_shuffle_ps(in[0], in[0], _MM_SHUFFLE(1, 2, 3, 0));	// x0 x3 x2 x1
+		glm_vec4 const y = _mm_shuffle_ps(in[1], in[1], _MM_SHUFFLE(2, 3, 0, 1));	// y1 y0 y3 y2
+		glm_vec4 const z = _mm_shuffle_ps(in[2], in[2], _MM_SHUFFLE(3, 0, 1, 2));	// z2 z1 z0 z3
+
+		out[0] = _mm_blend_ps(_mm_blend_ps(x, y, 0x2), z, 0x4);
+		out[1] = _mm_blend_ps(_mm_blend_ps(y, z, 0x2), x, 0x4);
+		out[2] = _mm_blend_ps(_mm_blend_ps(z, x, 0x2), y, 0x4);
+#	else
+		glm_vec4 const xy0 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+		glm_vec4 const zx1 = _mm_shuffle_ps(in[2], in[0], _MM_SHUFFLE(1, 1, 0, 0));
+		glm_vec4 const yz1 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+		glm_vec4 const xy2 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+		glm_vec4 const zx3 = _mm_shuffle_ps(in[2], in[0], _MM_SHUFFLE(3, 3, 2, 2));
+		glm_vec4 const yz3 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+
+		out[0] = _mm_shuffle_ps(xy0, zx1, _MM_SHUFFLE(2, 0, 2, 0));
+		out[1] = _mm_shuffle_ps(yz1, xy2, _MM_SHUFFLE(2, 0, 2, 0));
+		out[2] = _mm_shuffle_ps(zx3, yz3, _MM_SHUFFLE(2, 0, 2, 0));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_determinant_highp(glm_vec4 const in[4])
 {
 	__m128 Fac0;
@@ -1025,4 +1074,336 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// 3x3 matrices are stored as 3 padded vec3 columns, the w lane of the inputs is ignored and the w lane of the outputs is undefined
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_mul_vec3(glm_vec4 const m[3], glm_vec4 v)
+{
+	glm_vec4 const v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+	glm_vec4 const v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+	glm_vec4 const v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+
+	glm_vec4 const m0 = _mm_mul_ps(m[0], v0);
+	glm_vec4 const m1 = _mm_mul_ps(m[1], v1);
+	glm_vec4 const m2 = _mm_mul_ps(m[2], v2);
+
+	return _mm_add_ps(_mm_add_ps(m0, m1), m2);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_mul_mat3(glm_vec4 v, glm_vec4 const m[3])
+{
+	glm_vec4 const d0 = glm_vec3_dot(m[0], v);
+	glm_vec4 const d1 = glm_vec3_dot(m[1], v);
+	glm_vec4 const d2 = glm_vec3_dot(m[2], v);
+
+	glm_vec4 const d01 = _mm_unpacklo_ps(d0, d1);
+	return _mm_movelh_ps(d01, d2);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_mul(glm_vec4 const in1[3], glm_vec4 const in2[3], glm_vec4 out[3])
+{
+	out[0] = glm_mat3_mul_vec3(in1, in2[0]);
+	out[1] = glm_mat3_mul_vec3(in1, in2[1]);
+	out[2] = glm_mat3_mul_vec3(in1, in2[2]);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_transpose(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	glm_vec4 const tmp0 = _mm_unpacklo_ps(in[0], in[1]);	// a0 b0 a1 b1
+	glm_vec4 const tmp1 = _mm_unpackhi_ps(in[0], in[1]);	// a2 b2 a3 b3
+
+	out[0] = _mm_movelh_ps(tmp0, in[2]);
+	out[1] = _mm_shuffle_ps(tmp0, in[2], _MM_SHUFFLE(3, 1, 3, 2));
+	out[2] = _mm_shuffle_ps(tmp1, in[2], _MM_SHUFFLE(3, 2, 1, 0));
+}
+
+// Returns the determinant in the first lane
+GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant(glm_vec4 const in[3])
+{
+	return glm_vec3_dot(in[0], glm_vec4_cross(in[1], in[2]));
+}
+
+GLM_FUNC_QUALIFIER void glm_mat3_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	// The rows of the adjugate are the cross products of the columns
+	glm_vec4 Adj[3];
+	Adj[0] = glm_vec4_cross(in[1], in[2]);
+	Adj[1] = glm_vec4_cross(in[2], in[0]);
+	Adj[2] = glm_vec4_cross(in[0], in[1]);
+
+	glm_vec4 const Det = glm_vec3_dot(in[0], Adj[0]);
+	glm_vec4 const Rcp = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(Det, Det, _MM_SHUFFLE(0, 0, 0, 0)));
+
+	glm_vec4 Tmp[3];
+	glm_mat3_transpose(Adj, Tmp);
+
+	out[0] = _mm_mul_ps(Tmp[0], Rcp);
+	out[1] = _mm_mul_ps(Tmp[1], Rcp);
+	out[2] = _mm_mul_ps(Tmp[2], Rcp);
+}
+
+// Product of 2 affine matrices, whose bottom rows are assumed to be (0, 0, 0, 1) so that only the upper 3x4 blocks are multiplied
+GLM_FUNC_QUALIFIER void glm_mat4_affine_mul(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	out[0] = glm_mat3_mul_vec3(in1, in2[0]);
+	out[1] = glm_mat3_mul_vec3(in1, in2[1]);
+	out[2] = glm_mat3_mul_vec3(in1, in2[2]);
+	out[3] = _mm_add_ps(glm_mat3_mul_vec3(in1, in2[3]), in1[3]);
+}
+
+// Inverse of an affine matrix: the inverse of the upper 3x3 block from the cross products of its columns and -inverse(A) * t for the translation
+GLM_FUNC_QUALIFIER void glm_mat4_affine_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 Adj[4];
+	Adj[0] = glm_vec4_cross(in[1], in[2]);
+	Adj[1] = glm_vec4_cross(in[2], in[0]);
+	Adj[2] = glm_vec4_cross(in[0], in[1]);
+	Adj[3] = _mm_setzero_ps();
+
+	glm_vec4 const Det = glm_vec3_dot(in[0], Adj[0]);
+	glm_vec4 const Rcp = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(Det, Det, _MM_SHUFFLE(0, 0, 0, 0)));
+
+	// The w lanes of the cross products are 0 when the w lanes of the columns are
+	glm_vec4 Tmp[4];
+	glm_mat4_transpose(Adj, Tmp);
+
+	out[0] = _mm_mul_ps(Tmp[0], Rcp);
+	out[1] = _mm_mul_ps(Tmp[1], Rcp);
+	out[2] = _mm_mul_ps(Tmp[2], Rcp);
+	out[3] = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), glm_mat3_mul_vec3(out, in[3]));
+}
+
+// Inverse of a rotation and translation matrix: the transpose of the upper 3x3 block and -transpose(R) * t for the translation
+GLM_FUNC_QUALIFIER void glm_mat4_rigid_inverse(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	glm_vec4 Rot[4];
+	Rot[0] = in[0];
+	Rot[1] = in[1];
+	Rot[2] = in[2];
+	Rot[3] = _mm_setzero_ps();
+
+	glm_mat4_transpose(Rot, out);
+	out[3] = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), glm_mat3_mul_vec3(out, in[3]));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// glm_vec4_deinterleave3 on each 128 bits half: 8 packed vec3 where the low halves hold the vec3 0 to 3 and the high halves 4 to 7
+GLM_FUNC_QUALIFIER void glm_vec8_deinterleave3(glm_vec8 const in[3], glm_vec8 out[3])
+{
+	glm_vec8 const x = _mm256_blend_ps(_mm256_blend_ps(in[0], in[1], 0x44), in[2], 0x22);
+	glm_vec8 const y = _mm256_blend_ps(_mm256_blend_ps(in[0], in[1], 0x99), in[2], 0x44);
+	glm_vec8 const z = _mm256_blend_ps(_mm256_blend_ps(in[0], in[1], 0x22), in[2], 0x99);
+
+	out[0] = _mm256_permute_ps(x, _MM_SHUFFLE(1, 2, 3, 0));
+	out[1] = _mm256_permute_ps(y, _MM_SHUFFLE(2, 3, 0, 1));
+	out[2] = _mm256_permute_ps(z, _MM_SHUFFLE(3, 0, 1, 2));
+}
+
+// glm_vec4_interleave3 on each 128 bits half
+GLM_FUNC_QUALIFIER void glm_vec8_interleave3(glm_vec8 const in[3], glm_vec8 out[3])
+{
+	glm_vec8 const x = _mm256_permute_ps(in[0], _MM_SHUFFLE(1, 2, 3, 0));
+	glm_vec8 const y = _mm256_permute_ps(in[1], _MM_SHUFFLE(2, 3, 0, 1));
+	glm_vec8 const z = _mm256_permute_ps(in[2], _MM_SHUFFLE(3, 0, 1, 2));
+
+	out[0] = _mm256_blend_ps(_mm256_blend_ps(x, y, 0x22), z, 0x44);
+	out[1] = _mm256_blend_ps(_mm256_blend_ps(y, z, 0x22), x, 0x44);
+	out[2] = _mm256_blend_ps(_mm256_blend_ps(z, x, 0x22), y, 0x44);
+}
+
+// Transposes 8 rows of 8 floats, out[i] holds the element i of every row
+GLM_FUNC_QUALIFIER void glm_vec8_transpose8(glm_vec8 const in[8], glm_vec8 out[8])
+{
+	glm_vec8 const t0 = _mm256_unpacklo_ps(in[0], in[1]);
+	glm_vec8 const t1 = _mm256_unpackhi_ps(in[0], in[1]);
+	glm_vec8 const t2 = _mm256_unpacklo_ps(in[2], in[3]);
+	glm_vec8 const t3 = _mm256_unpackhi_ps(in[2], in[3]);
+	glm_vec8 const t4 = _mm256_unpacklo_ps(in[4], in[5]);
+	glm_vec8 const t5 = _mm256_unpackhi_ps(in[4], in[5]);
+	glm_vec8 const t6 = _mm256_unpacklo_ps(in[6], in[7]);
+	glm_vec8 const t7 = _mm256_unpackhi_ps(in[6], in[7]);
+
+	// Elements 0 to 3 of rows 0 to 3 in the low halves, elements 4 to 7 in the high halves
+	glm_vec8 const s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	glm_vec8 const s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	glm_vec8 const s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	glm_vec8 const s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	glm_vec8 const s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	glm_vec8 const s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	glm_vec8 const s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	glm_vec8 const s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	out[0] = _mm256_permute2f128_ps(s0, s4, 0x20);
+	out[1] = _mm256_permute2f128_ps(s1, s5, 0x20);
+	out[2] = _mm256_permute2f128_ps(s2, s6, 0x20);
+	out[3] = _mm256_permute2f128_ps(s3, s7, 0x20);
+	out[4] = _mm256_permute2f128_ps(s0, s4, 0x31);
+	out[5] = _mm256_permute2f128_ps(s1, s5, 0x31);
+	out[6] = _mm256_permute2f128_ps(s2, s6, 0x31);
+	out[7] = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+// Broadcast of m[Col][Row] loaded from memory, which unlike a vperm2f128 doesn't use the shuffle port
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_splat(glm_dvec4 const m[4], int Col, int Row)
+{
+	return _mm256_broadcast_sd(reinterpret_cast<double const*>(&m[Col]) + Row);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 const m0 = glm_dvec4_mul(m[0], glm_dvec4_splat_x(v));
+	glm_dvec4 const m1 = glm_dvec4_mul(m[1], glm_dvec4_splat_y(v));
+	glm_dvec4 const a0 = glm_dvec4_fma(m[2], glm_dvec4_splat_z(v), m0);
+	glm_dvec4 const a1 = glm_dvec4_fma(m[3], glm_dvec4_splat_w(v), m1);
+	return glm_dvec4_add(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	{
+		glm_dvec4 const m0 = glm_dvec4_mul(in1[0], glm_dmat4_splat(in2, 0, 0));
+		glm_dvec4 const m1 = glm_dvec4_mul(in1[1], glm_dmat4_splat(in2, 0, 1));
+		glm_dvec4 const a0 = glm_dvec4_fma(in1[2], glm_dmat4_splat(in2, 0, 2), m0);
+		glm_dvec4 const a1 = glm_dvec4_fma(in1[3], glm_dmat4_splat(in2, 0, 3), m1);
+		out[0] = glm_dvec4_add(a0, a1);
+	}
+
+	{
+		glm_dvec4 const m0 = glm_dvec4_mul(in1[0], glm_dmat4_splat(in2, 1, 0));
+		glm_dvec4 const m1 = glm_dvec4_mul(in1[1], glm_dmat4_splat(in2, 1, 1));
+		glm_dvec4 const a0 = glm_dvec4_fma(in1[2], glm_dmat4_splat(in2, 1, 2), m0);
+		glm_dvec4 const a1 = glm_dvec4_fma(in1[3], glm_dmat4_splat(in2, 1, 3), m1);
+		out[1] = glm_dvec4_add(a0, a1);
+	}
+
+	{
+		glm_dvec4 const m0 = glm_dvec4_mul(in1[0], glm_dmat4_splat(in2, 2, 0));
+		glm_dvec4 const m1 = glm_dvec4_mul(in1[1], glm_dmat4_splat(in2, 2, 1));
+		glm_dvec4 const a0 = glm_dvec4_fma(in1[2], glm_dmat4_splat(in2, 2, 2), m0);
+		glm_dvec4 const a1 = glm_dvec4_fma(in1[3], glm_dmat4_splat(in2, 2, 3), m1);
+		out[2] = glm_dvec4_add(a0, a1);
+	}
+
+	{
+		glm_dvec4 const m0 = glm_dvec4_mul(in1[0], glm_dmat4_splat(in2, 3, 0));
+		glm_dvec4 const m1 = glm_dvec4_mul(in1[1], glm_dmat4_splat(in2, 3, 1));
+		glm_dvec4 const a0 = glm_dvec4_fma(in1[2], glm_dmat4_splat(in2, 3, 2), m0);
+		glm_dvec4 const a1 = glm_dvec4_fma(in1[3], glm_dmat4_splat(in2, 3, 3), m1);
+		out[3] = glm_dvec4_add(a0, a1);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 const tmp0 = _mm256_unpacklo_pd(in[0], in[1]);
+	glm_dvec4 const tmp1 = _mm256_unpackhi_pd(in[0], in[1]);
+	glm_dvec4 const tmp2 = _mm256_unpacklo_pd(in[2], in[3]);
+	glm_dvec4 const tmp3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	out[0] = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+	out[1] = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+	out[2] = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+	out[3] = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+}
+
+// Same cofactor expansion as glm_mat4_determinant. The lanes are gathered with broadcasts and blends
+// because AVX has no shuffle of doubles across the 128 bits halves.
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant(glm_dvec4 const m[4])
+{
+	//T SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//T SubFactor01 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	//T SubFactor02 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	//T SubFactor03 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	//T SubFactor04 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	//T SubFactor05 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+	// Rows (2, 2, 1, 1), (3, 3, 3, 2) and (1, 0, 0, 0) of the columns 2 and 3
+	glm_dvec4 const Col2A = _mm256_blend_pd(glm_dmat4_splat(m, 2, 2), glm_dmat4_splat(m, 2, 1), 0xC);
+	glm_dvec4 const Col2B = _mm256_blend_pd(glm_dmat4_splat(m, 2, 3), glm_dmat4_splat(m, 2, 2), 0x8);
+	glm_dvec4 const Col2C = _mm256_blend_pd(glm_dmat4_splat(m, 2, 0), glm_dmat4_splat(m, 2, 1), 0x1);
+	glm_dvec4 const Col3A = _mm256_blend_pd(glm_dmat4_splat(m, 3, 2), glm_dmat4_splat(m, 3, 1), 0xC);
+	glm_dvec4 const Col3B = _mm256_blend_pd(glm_dmat4_splat(m, 3, 3), glm_dmat4_splat(m, 3, 2), 0x8);
+	glm_dvec4 const Col3C = _mm256_blend_pd(glm_dmat4_splat(m, 3, 0), glm_dmat4_splat(m, 3, 1), 0x1);
+
+	// (SubFactor00, SubFactor00, SubFactor01, SubFactor02)
+	glm_dvec4 const SubFacA = glm_dvec4_sub(glm_dvec4_mul(Col2A, Col3B), glm_dvec4_mul(Col3A, Col2B));
+	// (SubFactor01, SubFactor03, SubFactor03, SubFactor04)
+	glm_dvec4 const SubFacB = glm_dvec4_sub(glm_dvec4_mul(Col2C, Col3B), glm_dvec4_mul(Col3C, Col2B));
+	// (SubFactor02, SubFactor04, SubFactor05, SubFactor05)
+	glm_dvec4 const SubFacC = glm_dvec4_sub(glm_dvec4_mul(Col2C, Col3A), glm_dvec4_mul(Col3C, Col2A));
+
+	//vec<4, T, Q> DetCof(
+	//	+ (m[1][1] * SubFactor00 - m[1][2] * SubFactor01 + m[1][3] * SubFactor02),
+	//	- (m[1][0] * SubFactor00 - m[1][2] * SubFactor03 + m[1][3] * SubFactor04),
+	//	+ (m[1][0] * SubFactor01 - m[1][1] * SubFactor03 + m[1][3] * SubFactor05),
+	//	- (m[1][0] * SubFactor02 - m[1][1] * SubFactor04 + m[1][2] * SubFactor05));
+
+	glm_dvec4 const SwpFacA = _mm256_blend_pd(glm_dmat4_splat(m, 1, 0), glm_dmat4_splat(m, 1, 1), 0x1);
+	glm_dvec4 const SwpFacB = _mm256_blend_pd(glm_dmat4_splat(m, 1, 1), glm_dmat4_splat(m, 1, 2), 0x3);
+	glm_dvec4 const SwpFacC = _mm256_blend_pd(glm_dmat4_splat(m, 1, 2), glm_dmat4_splat(m, 1, 3), 0x7);
+
+	glm_dvec4 const SubRes = glm_dvec4_sub(glm_dvec4_mul(SwpFacA, SubFacA), glm_dvec4_mul(SwpFacB, SubFacB));
+	glm_dvec4 const AddRes = glm_dvec4_fma(SwpFacC, SubFacC, SubRes);
+	glm_dvec4 const DetCof = glm_dvec4_mul(AddRes, _mm256_setr_pd(1.0,-1.0, 1.0,-1.0));
+
+	return glm_dvec4_dot(m[0], DetCof);
+}
+
+// Same cofactor expansion as glm_mat4_inverse, with the lanes gathered by broadcasts and blends
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	// Swp0k = (m[2][k], m[2][k], m[1][k], m[1][k])
+	// Swp1k = (m[3][k], m[3][k], m[3][k], m[2][k])
+	glm_dvec4 const Splat20 = glm_dmat4_splat(in, 2, 0);
+	glm_dvec4 const Swp00 = _mm256_blend_pd(Splat20, glm_dmat4_splat(in, 1, 0), 0xC);
+	glm_dvec4 const Swp10 = _mm256_blend_pd(glm_dmat4_splat(in, 3, 0), Splat20, 0x8);
+	glm_dvec4 const Splat21 = glm_dmat4_splat(in, 2, 1);
+	glm_dvec4 const Swp01 = _mm256_blend_pd(Splat21, glm_dmat4_splat(in, 1, 1), 0xC);
+	glm_dvec4 const Swp11 = _mm256_blend_pd(glm_dmat4_splat(in, 3, 1), Splat21, 0x8);
+	glm_dvec4 const Splat22 = glm_dmat4_splat(in, 2, 2);
+	glm_dvec4 const Swp02 = _mm256_blend_pd(Splat22, glm_dmat4_splat(in, 1, 2), 0xC);
+	glm_dvec4 const Swp12 = _mm256_blend_pd(glm_dmat4_splat(in, 3, 2), Splat22, 0x8);
+	glm_dvec4 const Splat23 = glm_dmat4_splat(in, 2, 3);
+	glm_dvec4 const Swp03 = _mm256_blend_pd(Splat23, glm_dmat4_splat(in, 1, 3), 0xC);
+	glm_dvec4 const Swp13 = _mm256_blend_pd(glm_dmat4_splat(in, 3, 3), Splat23, 0x8);
+
+	//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+	//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+	glm_dvec4 const Fac0 = glm_dvec4_sub(glm_dvec4_mul(Swp02, Swp13), glm_dvec4_mul(Swp12, Swp03));
+	glm_dvec4 const Fac1 = glm_dvec4_sub(glm_dvec4_mul(Swp01, Swp13), glm_dvec4_mul(Swp11, Swp03));
+	glm_dvec4 const Fac2 = glm_dvec4_sub(glm_dvec4_mul(Swp01, Swp12), glm_dvec4_mul(Swp11, Swp02));
+	glm_dvec4 const Fac3 = glm_dvec4_sub(glm_dvec4_mul(Swp00, Swp13), glm_dvec4_mul(Swp10, Swp03));
+	glm_dvec4 const Fac4 = glm_dvec4_sub(glm_dvec4_mul(Swp00, Swp12), glm_dvec4_mul(Swp10, Swp02));
+	glm_dvec4 const Fac5 = glm_dvec4_sub(glm_dvec4_mul(Swp00, Swp11), glm_dvec4_mul(Swp10, Swp01));
+
+	// Veck = (m[1][k], m[0][k], m[0][k], m[0][k])
+	glm_dvec4 const Vec0 = _mm256_blend_pd(glm_dmat4_splat(in, 0, 0), glm_dmat4_splat(in, 1, 0), 0x1);
+	glm_dvec4 const Vec1 = _mm256_blend_pd(glm_dmat4_splat(in, 0, 1), glm_dmat4_splat(in, 1, 1), 0x1);
+	glm_dvec4 const Vec2 = _mm256_blend_pd(glm_dmat4_splat(in, 0, 2), glm_dmat4_splat(in, 1, 2), 0x1);
+	glm_dvec4 const Vec3 = _mm256_blend_pd(glm_dmat4_splat(in, 0, 3), glm_dmat4_splat(in, 1, 3), 0x1);
+
+	glm_dvec4 const SignA = _mm256_setr_pd(-1.0, 1.0,-1.0, 1.0);
+	glm_dvec4 const SignB = _mm256_setr_pd( 1.0,-1.0, 1.0,-1.0);
+
+	glm_dvec4 const Inv0 = glm_dvec4_mul(SignB, glm_dvec4_fma(Vec3, Fac2, glm_dvec4_sub(glm_dvec4_mul(Vec1, Fac0), glm_dvec4_mul(Vec2, Fac1))));
+	glm_dvec4 const Inv1 = glm_dvec4_mul(SignA, glm_dvec4_fma(Vec3, Fac4, glm_dvec4_sub(glm_dvec4_mul(Vec0, Fac0), glm_dvec4_mul(Vec2, Fac3))));
+	glm_dvec4 const Inv2 = glm_dvec4_mul(SignB, glm_dvec4_fma(Vec3, Fac5, glm_dvec4_sub(glm_dvec4_mul(Vec0, Fac1), glm_dvec4_mul(Vec1, Fac3))));
+	glm_dvec4 const Inv3 = glm_dvec4_mul(SignA, glm_dvec4_fma(Vec2, Fac5, glm_dvec4_sub(glm_dvec4_mul(Vec0, Fac2), glm_dvec4_mul(Vec1, Fac4))));
+
+	// (Inv0[0], Inv1[0], Inv2[0], Inv3[0])
+	glm_dvec4 const Row0 = _mm256_unpacklo_pd(Inv0, Inv1);
+	glm_dvec4 const Row1 = _mm256_unpacklo_pd(Inv2, Inv3);
+	glm_dvec4 const Row2 = _mm256_permute2f128_pd(Row0, Row1, 0x20);
+
+	glm_dvec4 const Det0 = glm_dvec4_dot(in[0], Row2);
+	glm_dvec4 const Rcp0 = glm_dvec4_div(_mm256_set1_pd(1.0), Det0);
+
+	out[0] = glm_dvec4_mul(Inv0, Rcp0);
+	out[1] = glm_dvec4_mul(Inv1, Rcp0);
+	out[2] = glm_dvec4_mul(Inv2, Rcp0);
+	out[3] = glm_dvec4_mul(Inv3, Rcp0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -150,6 +150,36 @@ namespace glm {
 			return vaddq_f32(acc, vmulq_f32(v, dupq_lane(vlane, lane)));
 #endif
 		}
+
+		// Returns (v.y, v.z, v.x, v.x)
+		static inline float32x4_t yzx(float32x4_t v) {
+			return copy_lane(vextq_f32(v, v, 1), 2, v, 0);
+		}
+
+		static inline float32x4_t cross(float32x4_t a, float32x4_t b) {
+			float32x4_t const t = vsubq_f32(vmulq_f32(a, yzx(b)), vmulq_f32(yzx(a), b));
+			return yzx(t);
+		}
+
+		// Dot product of the x, y and z lanes, the w lane is ignored
+		static inline float dot3(float32x4_t a, float32x4_t b) {
+			float32x4_t const p = vsetq_lane_f32(0.0f, vmulq_f32(a, b), 3);
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+			return vaddvq_f32(p);
+#else
+			float32x2_t v = vpadd_f32(vget_low_f32(p), vget_high_f32(p));
+			v = vpadd_f32(v, v);
+			return vget_lane_f32(v, 0);
+#endif
+		}
+
+		// Transposes the 3x3 matrix stored in the x, y and z lanes of 3 columns
+		static inline void transpose3(float32x4_t const in[3], float32x4_t out[3]) {
+			float32x4x2_t const t = vtrnq_f32(in[0], in[1]);
+			out[0] = vcombine_f32(vget_low_f32(t.val[0]), vget_low_f32(in[2]));
+			out[1] = vcombine_f32(vget_low_f32(t.val[1]), vget_low_f32(vextq_f32(in[2], in[2], 1)));
+			out[2] = vcombine_f32(vget_high_f32(t.val[0]), vget_high_f32(in[2]));
+		}
 	} //namespace neon
 } // namespace glm
 #endif // GLM_ARCH & GLM_ARCH_NEON_BIT
@@ -3,6 +3,143 @@
 
 #pragma once
 
+#include "common.h"
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Rounds half away from zero like round(), for |x| < 2^31
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_iround(glm_vec4 x)
+{
+	glm_ivec4 const t = _mm_cvttps_epi32(x);
+	glm_vec4 const f = glm_vec4_sub(x, _mm_cvtepi32_ps(t));
+	glm_ivec4 const up = _mm_castps_si128(_mm_cmpge_ps(f, _mm_set1_ps(0.5f)));
+	glm_ivec4 const down = _mm_castps_si128(_mm_cmple_ps(f, _mm_set1_ps(-0.5f)));
+	return _mm_add_epi32(_mm_sub_epi32(t, up), down);
+}
+
+// Returns round(clamp(v, 0, 1) * scale)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_unorm(glm_vec4 v, glm_vec4 scale)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	return glm_vec4_iround(glm_vec4_mul(c, scale));
+}
+
+// Returns round(clamp(v, -1, 1) * scale)
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_snorm(glm_vec4 v, glm_vec4 scale)
+{
+	glm_vec4 const c = _mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+	return glm_vec4_iround(glm_vec4_mul(c, scale));
+}
+
+// Returns clamp(v * scale, -1, 1)
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_snorm(glm_ivec4 v, glm_vec4 scale)
+{
+	glm_vec4 const f = glm_vec4_mul(_mm_cvtepi32_ps(v), scale);
+	return _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+}
+
+// Zero extends the 4 low bytes of v to 32 bits
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_u8(glm_ivec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_cvtepu8_epi32(v);
+#	else
+		glm_ivec4 const zero = _mm_setzero_si128();
+		return _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero);
+#	endif
+}
+
+// Sign extends the 4 low bytes of v to 32 bits
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_i8(glm_ivec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_cvtepi8_epi32(v);
+#	else
+		glm_ivec4 const b = _mm_unpacklo_epi8(v, v);
+		return _mm_srai_epi32(_mm_unpacklo_epi16(b, b), 24);
+#	endif
+}
+
+// Zero extends the 4 low 16 bits words of v to 32 bits
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_u16(glm_ivec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_cvtepu16_epi32(v);
+#	else
+		return _mm_unpacklo_epi16(v, _mm_setzero_si128());
+#	endif
+}
+
+// Sign extends the 4 low 16 bits words of v to 32 bits
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_unpack_i16(glm_ivec4 v)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_cvtepi16_epi32(v);
+#	else
+		return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+#	endif
+}
+
+// Returns the low 16 bits of the lanes 0 and 1 of v packed in a 32 bits integer
+GLM_FUNC_QUALIFIER int glm_ivec4_pack_16x2(glm_ivec4 v)
+{
+	return _mm_cvtsi128_si32(_mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 3, 2, 0)));
+}
+
+// Packs 8 lanes holding values in [0, 65535] to unsigned 16 bits integers
+GLM_FUNC_QUALIFIER glm_ivec4 glm_ivec4_packus_epi32(glm_ivec4 a, glm_ivec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_packus_epi32(a, b);
+#	else
+		glm_ivec4 const bias = _mm_set1_epi32(32768);
+		glm_ivec4 const p = _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias));
+		return _mm_xor_si128(p, _mm_set1_epi16(short(0x8000)));
+#	endif
+}
+
+// Converts the half precision values held by the low 16 bits of each lane to single precision,
+// exactly and with NaNs made quiet like F16C
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_from_half(glm_ivec4 h)
+{
+	glm_ivec4 const em = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+	glm_ivec4 const sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+
+	// Normalized numbers rebias the exponent from 15 to 127, infinities and NaNs map the exponent 31 to 255
+	glm_ivec4 const special = _mm_cmpgt_epi32(em, _mm_set1_epi32(0x7BFF));
+	glm_ivec4 const bias = _mm_add_epi32(_mm_set1_epi32((127 - 15) << 23), _mm_and_si128(special, _mm_set1_epi32((255 - 31 - 127 + 15) << 23)));
+	glm_ivec4 const quiet = _mm_and_si128(_mm_cmpgt_epi32(em, _mm_set1_epi32(0x7C00)), _mm_set1_epi32(0x00400000));
+	glm_vec4 const normal = _mm_castsi128_ps(_mm_or_si128(_mm_add_epi32(_mm_slli_epi32(em, 13), bias), quiet));
+
+	// Denormals are m * 2^-24, exact in single precision
+	glm_vec4 const denormal = glm_vec4_mul(_mm_cvtepi32_ps(em), _mm_set1_ps(5.9604644775390625e-8f));
+	glm_vec4 const isDenormal = _mm_castsi128_ps(_mm_cmplt_epi32(em, _mm_set1_epi32(0x0400)));
+
+	return _mm_or_ps(glm_vec4_select(isDenormal, denormal, normal), _mm_castsi128_ps(sign));
+}
+
+// Converts v to half precision in the low 16 bits of each lane, upper bits cleared.
+// Rounds to nearest even and makes NaNs quiet like F16C, assuming the default MXCSR rounding mode.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half(glm_vec4 v)
+{
+	glm_ivec4 const bits = _mm_castps_si128(v);
+	glm_ivec4 const sign = _mm_and_si128(bits, _mm_set1_epi32(int(0x80000000)));
+	glm_ivec4 const a = _mm_xor_si128(bits, sign);
+	glm_ivec4 const mantissa = _mm_srli_epi32(a, 13);
+
+	// Below 2^-14, adding 0.5 aligns the half denormal unit 2^-24 on the float ULP and the addition does the rounding
+	glm_vec4 const magic = _mm_set1_ps(0.5f);
+	glm_ivec4 const denormal = _mm_sub_epi32(_mm_castps_si128(glm_vec4_add(_mm_castsi128_ps(a), magic)), _mm_castps_si128(magic));
+
+	// Otherwise rebias the exponent, adding 0xFFF plus the odd bit rounds ties to even and carries into the exponent
+	glm_ivec4 const odd = _mm_and_si128(mantissa, _mm_set1_epi32(1));
+	glm_ivec4 const normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(a, _mm_set1_epi32(0xFFF - ((127 - 15) << 23))), odd), 13);
+
+	glm_ivec4 const nan = _mm_or_si128(_mm_set1_epi32(0x7E00), _mm_and_si128(mantissa, _mm_set1_epi32(0x03FF)));
+	glm_ivec4 Result = glm_ivec4_select(_mm_cmplt_epi32(a, _mm_set1_epi32(113 << 23)), denormal, normal);
+	Result = glm_ivec4_select(_mm_cmpgt_epi32(a, _mm_set1_epi32(((127 + 16) << 23) - 1)), _mm_set1_epi32(0x7C00), Result);
+	Result = glm_ivec4_select(_mm_cmpgt_epi32(a, _mm_set1_epi32(0x7F800000)), nan, Result);
+	return _mm_or_si128(Result, _mm_srli_epi32(sign, 16));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -452,8 +452,25 @@
 	typedef glm_f64vec2		glm_dvec2;
 #endif
 
+// F16C conversions are not implied by any GLM_ARCH level, GCC and Clang expose them with -mf16c and Visual C++ with /arch:AVX2
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_HAS_F16C 1
+#else
+#	define GLM_HAS_F16C 0
+#endif
+
+// BMI2 bit deposit and extract are not implied by any GLM_ARCH level either, GCC and Clang expose them with -mbmi2 and Visual C++ with /arch:AVX2.
+// Only the 64-bit forms are used, which require x86-64.
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__x86_64__) || defined(_M_X64)) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_AVX_BIT
+	typedef __m256			glm_f32vec8;
 	typedef __m256d			glm_f64vec4;
+	typedef glm_f32vec8		glm_vec8;
 	typedef glm_f64vec4		glm_dvec4;
 #endif
 
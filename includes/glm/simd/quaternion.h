@@ -0,0 +1,64 @@
+/// @ref simd
+/// @file glm/simd/quaternion.h
+
+#pragma once
+
+#include "common.h"
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Quaternions are held in (x, y, z, w) lane order, GLM_FORCE_QUAT_DATA_WXYZ storage has to be swizzled by the caller
+
+// Hamilton product p * q
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_mul(glm_vec4 p, glm_vec4 q)
+{
+	glm_vec4 const swp0 = _mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3));
+	glm_vec4 const swp1 = _mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2));
+	glm_vec4 const swp2 = _mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1));
+
+	// (qw, -qz, qy, -qx), (qz, qw, -qx, -qy) and (-qy, qx, qw, -qz)
+	glm_vec4 const sgn0 = _mm_xor_ps(swp0, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+	glm_vec4 const sgn1 = _mm_xor_ps(swp1, _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f));
+	glm_vec4 const sgn2 = _mm_xor_ps(swp2, _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+	glm_vec4 r = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), q);
+	r = glm_vec4_fma(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), sgn0, r);
+	r = glm_vec4_fma(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), sgn1, r);
+	r = glm_vec4_fma(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), sgn2, r);
+	return r;
+}
+
+// Columns of the rotation matrix of the unit quaternion q, their w lanes are 0
+GLM_FUNC_QUALIFIER void glm_quat_mat3_cast(glm_vec4 q, glm_vec4 out[3])
+{
+	glm_vec4 const q2 = _mm_add_ps(q, q);
+	glm_vec4 const sq = _mm_mul_ps(q, q2);
+
+	// Diagonal: 1 - 2 * (yy + zz), 1 - 2 * (xx + zz), 1 - 2 * (xx + yy), 0
+	glm_vec4 const sq0 = _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 0, 0, 1));
+	glm_vec4 const sq1 = _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 1, 2, 2));
+	glm_vec4 const dia = _mm_and_ps(
+		_mm_sub_ps(_mm_set1_ps(1.0f), _mm_add_ps(sq0, sq1)),
+		_mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+
+	// sum: 2 * (xz + wy), 2 * (xy + wz), 2 * (yz + wx)
+	// dif: 2 * (xz - wy), 2 * (xy - wz), 2 * (yz - wx)
+	glm_vec4 const pr0 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 1, 0, 0)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 2, 1, 2)));
+	glm_vec4 const pr1 = _mm_mul_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(3, 0, 2, 1)));
+	glm_vec4 const sum = _mm_add_ps(pr0, pr1);
+	glm_vec4 const dif = _mm_sub_ps(pr0, pr1);
+
+	// swp0: 2 * (xy + wz), 2 * (yz + wx), 2 * (xz - wy), 2 * (xy - wz)
+	// swp1: 2 * (xz + wy), 2 * (yz - wx)
+	glm_vec4 const swp0 = _mm_shuffle_ps(sum, dif, _MM_SHUFFLE(1, 0, 2, 1));
+	glm_vec4 const swp1 = _mm_shuffle_ps(sum, dif, _MM_SHUFFLE(2, 2, 0, 0));
+
+	glm_vec4 const col0 = _mm_shuffle_ps(dia, swp0, _MM_SHUFFLE(2, 0, 3, 0));
+	glm_vec4 const col1 = _mm_shuffle_ps(dia, swp0, _MM_SHUFFLE(1, 3, 3, 1));
+
+	out[0] = _mm_shuffle_ps(col0, col0, _MM_SHUFFLE(1, 3, 2, 0));
+	out[1] = _mm_shuffle_ps(col1, col1, _MM_SHUFFLE(1, 3, 0, 2));
+	out[2] = _mm_shuffle_ps(swp1, dia, _MM_SHUFFLE(3, 2, 2, 0));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
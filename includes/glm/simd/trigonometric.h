@@ -3,7 +3,223 @@
 
 #pragma once
 
+#include "common.h"
+
+// Single precision kernels using Cephes minimax polynomials on [-pi/4, pi/4]. The argument reduction
+// is carried in double precision, which requires SSE2 or AArch64; ARMv7 NEON keeps the scalar path.
+// Measured against double precision references:
+// - sin, cos: at most 2 ULP for |x| <= GLM_SIMD_SINCOS_MAX_INPUT, callers must handle larger inputs
+// - tan: at most 3 ULP for |x| <= GLM_SIMD_SINCOS_MAX_INPUT, callers must handle larger inputs
+// - atan2: at most 3 ULP, all inputs including zeros, infinities and NaNs
+
+#define GLM_SIMD_SINCOS_MAX_INPUT 1048576.0f
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
-#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_vec4 x, glm_vec4* s, glm_vec4* c)
+{
+	glm_vec4 const sgn = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const ax = _mm_andnot_ps(sgn, x);
+	glm_f64vec2 const x01 = _mm_cvtps_pd(ax);
+	glm_f64vec2 const x23 = _mm_cvtps_pd(_mm_movehl_ps(ax, ax));
+
+	// octant index rounded up to even so that the reduced argument lands in [-pi/4, pi/4]
+	glm_f64vec2 const fopi = _mm_set1_pd(1.2732395447351628);
+	glm_ivec4 j = _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_mul_pd(x01, fopi)), _mm_cvttpd_epi32(_mm_mul_pd(x23, fopi)));
+	j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+
+	glm_vec4 const sinSign = _mm_xor_ps(_mm_and_ps(x, sgn), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+	glm_vec4 const cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+	glm_vec4 const swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+	// pi/4 = P1 + P2 where P1 holds 32 significant bits so that x - y * P1 is exact in double precision
+	glm_f64vec2 const P1 = _mm_set1_pd(0.7853981633670628);
+	glm_f64vec2 const P2 = _mm_set1_pd(3.038550253253096e-11);
+	glm_f64vec2 const y01 = _mm_cvtepi32_pd(j);
+	glm_f64vec2 const y23 = _mm_cvtepi32_pd(_mm_unpackhi_epi64(j, j));
+	glm_f64vec2 const r01 = _mm_sub_pd(_mm_sub_pd(x01, _mm_mul_pd(y01, P1)), _mm_mul_pd(y01, P2));
+	glm_f64vec2 const r23 = _mm_sub_pd(_mm_sub_pd(x23, _mm_mul_pd(y23, P1)), _mm_mul_pd(y23, P2));
+	glm_vec4 const r = _mm_movelh_ps(_mm_cvtpd_ps(r01), _mm_cvtpd_ps(r23));
+	glm_vec4 const z = glm_vec4_mul(r, r);
+
+	glm_vec4 pc = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	pc = glm_vec4_fma(pc, z, _mm_set1_ps(4.166664568298827e-2f));
+	pc = glm_vec4_mul(glm_vec4_mul(pc, z), z);
+	pc = glm_vec4_add(glm_vec4_fma(z, _mm_set1_ps(-0.5f), pc), _mm_set1_ps(1.0f));
+
+	glm_vec4 ps = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	ps = glm_vec4_fma(ps, z, _mm_set1_ps(-1.6666654611e-1f));
+	ps = glm_vec4_fma(glm_vec4_mul(ps, z), r, r);
+
+	*s = _mm_xor_ps(glm_vec4_select(swap, ps, pc), sinSign);
+	*c = _mm_xor_ps(glm_vec4_select(swap, pc, ps), cosSign);
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_sin(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_cos(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_tan(glm_vec4 x)
+{
+	glm_vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return glm_vec4_div(s, c);
+}
+
+// Returns true when every lane is within the domain of glm_vec4_sincos. NaN lanes are out of the domain.
+GLM_FUNC_QUALIFIER bool glm_vec4_sincos_domain(glm_vec4 x)
+{
+	return _mm_movemask_ps(_mm_cmpnle_ps(glm_vec4_abs(x), _mm_set1_ps(GLM_SIMD_SINCOS_MAX_INPUT))) == 0;
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_atan2(glm_vec4 y, glm_vec4 x)
+{
+	glm_vec4 const sgn = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+	glm_vec4 const one = _mm_set1_ps(1.0f);
+	glm_vec4 const ax = glm_vec4_abs(x);
+	glm_vec4 const ay = glm_vec4_abs(y);
+	glm_vec4 const hi = _mm_max_ps(ax, ay);
+	glm_vec4 const lo = _mm_min_ps(ax, ay);
+
+	// atan(lo / hi) with 0 / 0 mapped to 0 and inf / inf mapped to 1
+	glm_vec4 a = glm_vec4_div(lo, hi);
+	a = _mm_andnot_ps(_mm_cmpeq_ps(hi, _mm_setzero_ps()), a);
+	a = glm_vec4_select(_mm_cmpeq_ps(lo, _mm_castsi128_ps(_mm_set1_epi32(0x7F800000))), one, a);
+
+	glm_vec4 const big = _mm_cmpgt_ps(a, _mm_set1_ps(0.4142135623730950f));
+	glm_vec4 const t = glm_vec4_select(big, glm_vec4_div(glm_vec4_sub(a, one), glm_vec4_add(a, one)), a);
+	glm_vec4 const z = glm_vec4_mul(t, t);
+
+	glm_vec4 p = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-3.33329491539e-1f));
+	p = glm_vec4_fma(glm_vec4_mul(p, z), t, t);
+	glm_vec4 r = glm_vec4_add(_mm_and_ps(big, _mm_set1_ps(0.78539816339744830962f)), p);
+
+	r = glm_vec4_select(_mm_cmpgt_ps(ay, ax), glm_vec4_sub(_mm_set1_ps(1.57079632679489661923f), r), r);
+	r = glm_vec4_select(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)), glm_vec4_sub(_mm_set1_ps(3.14159265358979323846f), r), r);
+	r = _mm_or_ps(r, _mm_and_ps(y, sgn));
+
+	return glm_vec4_select(_mm_cmpunord_ps(x, y), glm_vec4_add(x, y), r);
+}
 
+#elif GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+namespace glm {
+	namespace neon {
+		static inline float32x4_t xor_sign(float32x4_t a, uint32x4_t sign) {
+			return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), sign));
+		}
+	}//namespace neon
+}//namespace glm
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_f32vec4 x, glm_f32vec4* s, glm_f32vec4* c)
+{
+	uint32x4_t const sgn = vdupq_n_u32(0x80000000u);
+	glm_f32vec4 const ax = vabsq_f32(x);
+	float64x2_t const x01 = vcvt_f64_f32(vget_low_f32(ax));
+	float64x2_t const x23 = vcvt_high_f64_f32(ax);
+
+	// octant index rounded up to even so that the reduced argument lands in [-pi/4, pi/4]
+	float64x2_t const fopi = vdupq_n_f64(1.2732395447351628);
+	int32x4_t const q = vcombine_s32(vmovn_s64(vcvtq_s64_f64(vmulq_f64(x01, fopi))), vmovn_s64(vcvtq_s64_f64(vmulq_f64(x23, fopi))));
+	uint32x4_t const j = vandq_u32(vaddq_u32(vreinterpretq_u32_s32(q), vdupq_n_u32(1)), vdupq_n_u32(~1u));
+
+	uint32x4_t const sinSign = veorq_u32(vandq_u32(vreinterpretq_u32_f32(x), sgn), vshlq_n_u32(vandq_u32(j, vdupq_n_u32(4)), 29));
+	uint32x4_t const cosSign = vshlq_n_u32(vbicq_u32(vdupq_n_u32(4), vsubq_u32(j, vdupq_n_u32(2))), 29);
+	uint32x4_t const swap = vceqq_u32(vandq_u32(j, vdupq_n_u32(2)), vdupq_n_u32(0));
+
+	// pi/4 = P1 + P2 where P1 holds 32 significant bits so that x - y * P1 is exact in double precision
+	float64x2_t const P1 = vdupq_n_f64(0.7853981633670628);
+	float64x2_t const P2 = vdupq_n_f64(3.038550253253096e-11);
+	float64x2_t const y01 = vcvtq_f64_u64(vmovl_u32(vget_low_u32(j)));
+	float64x2_t const y23 = vcvtq_f64_u64(vmovl_u32(vget_high_u32(j)));
+	float64x2_t const r01 = vsubq_f64(vsubq_f64(x01, vmulq_f64(y01, P1)), vmulq_f64(y01, P2));
+	float64x2_t const r23 = vsubq_f64(vsubq_f64(x23, vmulq_f64(y23, P1)), vmulq_f64(y23, P2));
+	glm_f32vec4 const r = vcvt_high_f32_f64(vcvt_f32_f64(r01), r23);
+	glm_f32vec4 const z = vmulq_f32(r, r);
+
+	glm_f32vec4 pc = vfmaq_f32(vdupq_n_f32(-1.388731625493765e-3f), vdupq_n_f32(2.443315711809948e-5f), z);
+	pc = vfmaq_f32(vdupq_n_f32(4.166664568298827e-2f), pc, z);
+	pc = vmulq_f32(vmulq_f32(pc, z), z);
+	pc = vaddq_f32(vfmaq_f32(pc, z, vdupq_n_f32(-0.5f)), vdupq_n_f32(1.0f));
+
+	glm_f32vec4 ps = vfmaq_f32(vdupq_n_f32(8.3321608736e-3f), vdupq_n_f32(-1.9515295891e-4f), z);
+	ps = vfmaq_f32(vdupq_n_f32(-1.6666654611e-1f), ps, z);
+	ps = vfmaq_f32(r, vmulq_f32(ps, z), r);
+
+	*s = glm::neon::xor_sign(vbslq_f32(swap, ps, pc), sinSign);
+	*c = glm::neon::xor_sign(vbslq_f32(swap, pc, ps), cosSign);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_tan(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return vdivq_f32(s, c);
+}
+
+// Returns true when every lane is within the domain of glm_vec4_sincos. NaN lanes are out of the domain.
+GLM_FUNC_QUALIFIER bool glm_vec4_sincos_domain(glm_f32vec4 x)
+{
+	uint32x4_t const in = vcleq_f32(vabsq_f32(x), vdupq_n_f32(GLM_SIMD_SINCOS_MAX_INPUT));
+	uint32x2_t const m = vand_u32(vget_low_u32(in), vget_high_u32(in));
+	return (vget_lane_u32(m, 0) & vget_lane_u32(m, 1)) == ~0u;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_atan2(glm_f32vec4 y, glm_f32vec4 x)
+{
+	glm_f32vec4 const one = vdupq_n_f32(1.0f);
+	glm_f32vec4 const ax = vabsq_f32(x);
+	glm_f32vec4 const ay = vabsq_f32(y);
+	glm_f32vec4 const hi = vmaxq_f32(ax, ay);
+	glm_f32vec4 const lo = vminq_f32(ax, ay);
+
+	// atan(lo / hi) with 0 / 0 mapped to 0 and inf / inf mapped to 1
+	glm_f32vec4 a = vdivq_f32(lo, hi);
+	a = vbslq_f32(vceqq_f32(hi, vdupq_n_f32(0.0f)), vdupq_n_f32(0.0f), a);
+	a = vbslq_f32(vceqq_f32(lo, vreinterpretq_f32_u32(vdupq_n_u32(0x7F800000u))), one, a);
+
+	uint32x4_t const big = vcgtq_f32(a, vdupq_n_f32(0.4142135623730950f));
+	glm_f32vec4 const t = vbslq_f32(big, vdivq_f32(vsubq_f32(a, one), vaddq_f32(a, one)), a);
+	glm_f32vec4 const z = vmulq_f32(t, t);
+
+	glm_f32vec4 p = vfmaq_f32(vdupq_n_f32(-1.38776856032e-1f), vdupq_n_f32(8.05374449538e-2f), z);
+	p = vfmaq_f32(vdupq_n_f32(1.99777106478e-1f), p, z);
+	p = vfmaq_f32(vdupq_n_f32(-3.33329491539e-1f), p, z);
+	p = vfmaq_f32(t, vmulq_f32(p, z), t);
+	glm_f32vec4 r = vaddq_f32(vbslq_f32(big, vdupq_n_f32(0.78539816339744830962f), vdupq_n_f32(0.0f)), p);
+
+	r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(vdupq_n_f32(1.57079632679489661923f), r), r);
+	r = vbslq_f32(vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(x), 31)), vsubq_f32(vdupq_n_f32(3.14159265358979323846f), r), r);
+	r = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(r), vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000u))));
+
+	uint32x4_t const ordered = vandq_u32(vceqq_f32(x, x), vceqq_f32(y, y));
+	return vbslq_f32(ordered, r, vaddq_f32(x, y));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT